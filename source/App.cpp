@@ -22,10 +22,11 @@
 #include "repository/MovieRepositorySQL.h"
 #include "repository/IMovieRepository.h" // Added to ensure IMoviezRepository is known for MovieManagerService
 #include "repository/AuthenticationRepositorySQL.h" // Added for _authRepository initialization
+#include "core/ServiceBootstrap.h"
 
-App::App() : dbConn(nullptr) {} // Removed authRepo initialization
+App::App() {} // Removed authRepo initialization
 
-App::App(bool useMock = false) : dbConn(nullptr) { // Removed authRepo initialization
+App::App(bool useMock = false) { // Removed authRepo initialization
     if (useMock) {
         std::cout << "[App] Using mock repository (not implemented here).\n";
         // TODO: Implement mock repo if needed
@@ -44,31 +45,19 @@ bool App::initialize() {
     
     std::cout << "[Debug] Working dir: " << std::filesystem::current_path() << "\n";
 
-    dbConn = DatabaseConnection::getInstance();
-    if (!dbConn->connect("database.db")) { // Đường dẫn đến file database
-        std::cerr << "[App] Failed to connect to database.\n";
+    // Kiosk profile: WAL so seat maps are never blocked by a booking, no fsync per commit
+    try {
+        auto services = ServiceBootstrap::initialize( // Đường dẫn đến file database
+            "database.db", "./database/database.sql", ConnectionProfile::kiosk());
+        _connectionPool = services.connectionPool;
+        _authRepository = services.authRepository;
+        _movieRepository = services.movieRepository;
+        _bookingRepository = services.bookingRepository;
+    } catch (const std::exception& e) {
+        std::cerr << "[App] Failed to initialize services: " << e.what() << "\n";
         return false;
     }
 
-    // Nếu file chưa tồn tại hoặc mới tạo -> nên luôn chạy schema
-    if (!std::filesystem::exists("database.db") || dbConn->executeQuery("SELECT name FROM sqlite_master WHERE type='table';").empty()) {
-        std::cout << "[App] Running database schema setup...\n";
-        if (!dbConn->executeSQLFile("./database/database.sql")) {
-            std::cerr << "[App] Failed to initialize database schema.\n";
-            return false;
-        }
-    }    // Create and store shared repository instances
-    _authRepository = std::make_shared<AuthenticationRepositorySQL>(dbConn);
-    _movieRepository = std::make_shared<MovieRepositorySQL>("database.db"); 
-    _bookingRepository = std::make_shared<BookingRepository>("database.db"); // Changed to pass string filepath
-
-    // Register services with shared repository instances
-    ServiceRegistry::addSingleton<ILoginService>(std::make_shared<LoginService>(_authRepository.get())); // Use .get()
-    ServiceRegistry::addSingleton<IRegisterService>(std::make_shared<RegisterService>(_authRepository.get())); // Use .get()
-    ServiceRegistry::addSingleton<ILogoutService>(std::make_shared<LogoutService>());
-    ServiceRegistry::addSingleton<IBookingService>(std::make_shared<BookingService>(_bookingRepository));
-    ServiceRegistry::addSingleton<IMovieViewerService>(std::make_shared<MovieViewerService>(_movieRepository));
-    ServiceRegistry::addSingleton<IMovieManagerService>(std::make_shared<MovieManagerService>(_movieRepository));   
     sessionManager = std::make_shared<SessionManager>();
     
     // Initialize SFML UI Manager
@@ -98,12 +87,10 @@ void App::run() {
 
 void App::shutdown() {
     std::cout << "[App] Shutting down application...\n";
-    // ServiceRegistry::clear(); // Optional: Clear service registry if needed
-    if (dbConn) {
-        dbConn->disconnect();
-        // delete dbConn; // DatabaseConnection is a singleton, managed by itself or a smart pointer if applicable
-        // dbConn = nullptr; // No need if DatabaseConnection::getInstance() handles lifetime
-    }
+    // The registered services hold the repositories; release them first (the UI loop has ended)
+    ServiceRegistry::reset();
+    // Connections close when the last repository holding the pool is released
+    _connectionPool.reset();
     // delete authRepo; // Removed, _authRepository is a shared_ptr and manages its own lifetime
     // authRepo = nullptr; // Removed
 
@@ -16,7 +16,7 @@
 #include "repository/IMovieRepository.h" // Added for _movieRepository
 #include "repository/IBookingRepository.h" // Added for _bookingRepository
 #include "repository/AuthenticationRepositorySQL.h"
-#include "database/DatabaseConnection.h"
+#include "database/ConnectionPool.h"
 #include "IRegisterService.h"
 #include "ILoginService.h"
 #include "ILogoutService.h"
@@ -52,7 +52,7 @@
  * 
  * @see SessionManager
  * @see SFMLUIManager
- * @see DatabaseConnection
+ * @see ConnectionPool
  */
 class App {
 private:
@@ -73,12 +73,12 @@ private:
     std::unique_ptr<SFMLUIManager> uiManager;
     
     /**
-     * @brief Database connection instance
+     * @brief Database connections shared by all repositories
      * 
-     * Singleton instance for managing SQLite database connections and operations.
-     * @warning This is a raw pointer to a singleton - do not delete manually
+     * One writer and several reader connections on database.db, opened
+     * with the kiosk profile (WAL). Released in shutdown().
      */
-    DatabaseConnection* dbConn;
+    std::shared_ptr<ConnectionPool> _connectionPool;
     
     /**
      * @brief Authentication repository for user login/registration operations
@@ -0,0 +1,90 @@
+#include "MovieDetailsViewModel.h"
+
+MovieDetailsViewModel::MovieDetailsViewModel()
+    : loaded(false), movieId(-1), rating(0.0f) {
+}
+
+bool MovieDetailsViewModel::load(IMovieViewerService* service, int id) {
+    invalidate();
+    if (!service) {
+        return false;
+    }
+
+    auto movie = service->showMovieDetail(id);
+    if (!movie) {
+        return false;
+    }
+
+    movieId = movie->getId();
+    title = movie->getTitle();
+    genre = movie->getGenre();
+    description = movie->getDescription();
+    wrappedDescription = wrapText(description, DESCRIPTION_LINE_LENGTH);
+    rating = movie->getRating();
+    showTimes = service->showMovieShowTimes(id);
+    loaded = true;
+    return true;
+}
+
+void MovieDetailsViewModel::invalidate() {
+    loaded = false;
+    movieId = -1;
+    title.clear();
+    genre.clear();
+    description.clear();
+    wrappedDescription.clear();
+    rating = 0.0f;
+    showTimes.clear();
+}
+
+bool MovieDetailsViewModel::isLoaded() const {
+    return loaded;
+}
+
+int MovieDetailsViewModel::getMovieId() const {
+    return movieId;
+}
+
+const std::string& MovieDetailsViewModel::getTitle() const {
+    return title;
+}
+
+const std::string& MovieDetailsViewModel::getGenre() const {
+    return genre;
+}
+
+const std::string& MovieDetailsViewModel::getDescription() const {
+    return description;
+}
+
+const std::string& MovieDetailsViewModel::getWrappedDescription() const {
+    return wrappedDescription;
+}
+
+float MovieDetailsViewModel::getRating() const {
+    return rating;
+}
+
+const std::vector<ShowTime>& MovieDetailsViewModel::getShowTimes() const {
+    return showTimes;
+}
+
+std::string MovieDetailsViewModel::wrapText(const std::string& text, std::size_t lineLength) {
+    std::string wrapped = text;
+    if (wrapped.length() <= 100) {
+        return wrapped;
+    }
+
+    std::size_t pos = 0;
+    while (pos + lineLength < wrapped.length()) {
+        // Find a good place to break (space)
+        std::size_t breakPos = wrapped.rfind(' ', pos + lineLength);
+        if (breakPos != std::string::npos && breakPos > pos) {
+            wrapped.replace(breakPos, 1, "\n");
+            pos = breakPos + 1;
+        } else {
+            pos += lineLength;
+        }
+    }
+    return wrapped;
+}
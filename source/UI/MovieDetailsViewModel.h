@@ -0,0 +1,106 @@
+/**
+ * @file MovieDetailsViewModel.h
+ * @brief Data shown on the movie details screen, loaded once per visit
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef MOVIE_DETAILS_VIEW_MODEL_H
+#define MOVIE_DETAILS_VIEW_MODEL_H
+
+#include <string>
+#include <vector>
+#include "../service/IMovieViewerService.h"
+#include "../model/ShowTime.h"
+
+/**
+ * @class MovieDetailsViewModel
+ * @brief Snapshot of one movie and its showtimes for the details screen
+ *
+ * The UI redraws its screen up to 60 times a second. Rendering must not ask
+ * the service layer for data, so everything the details screen shows is
+ * loaded here once, when the user opens the screen, and read from memory by
+ * every frame after that. The description is also wrapped for display at
+ * load time instead of once per frame.
+ *
+ * @details
+ * - load() is the only method that talks to the service
+ * - invalidate() drops the snapshot, e.g. after an admin changed the movie;
+ *   the UI reloads it before the screen is drawn again
+ * - Has no SFML dependency, so it can be tested without a window
+ *
+ * @par Usage Example
+ * @code
+ * // On state change (mouse click on a movie card)
+ * movieDetails.load(movieService.get(), movies[i].id);
+ *
+ * // Every frame
+ * if (movieDetails.isLoaded()) {
+ *     drawText(movieDetails.getTitle());
+ *     drawText(movieDetails.getWrappedDescription());
+ * }
+ * @endcode
+ *
+ * @see SFMLUIManager::loadMovieDetails
+ * @see IMovieViewerService
+ */
+class MovieDetailsViewModel {
+private:
+    bool loaded;
+    int movieId;
+    std::string title;
+    std::string genre;
+    std::string description;
+    std::string wrappedDescription;
+    float rating;
+    std::vector<ShowTime> showTimes;
+
+public:
+    /**
+     * @brief Characters per line of the wrapped description
+     */
+    static constexpr std::size_t DESCRIPTION_LINE_LENGTH = 85;
+
+    MovieDetailsViewModel();
+
+    /**
+     * @brief Fetch a movie and its showtimes from the service
+     *
+     * @param service Viewer service of the current role, may be null
+     * @param id Movie to show
+     * @return true If the movie exists; false leaves the view-model unloaded
+     */
+    bool load(IMovieViewerService* service, int id);
+
+    /**
+     * @brief Drop the snapshot so the next visit loads fresh data
+     */
+    void invalidate();
+
+    /**
+     * @brief Whether a snapshot is available for rendering
+     */
+    bool isLoaded() const;
+
+    int getMovieId() const;
+    const std::string& getTitle() const;
+    const std::string& getGenre() const;
+    const std::string& getDescription() const;
+
+    /**
+     * @brief Description with line breaks inserted at word boundaries
+     */
+    const std::string& getWrappedDescription() const;
+    float getRating() const;
+    const std::vector<ShowTime>& getShowTimes() const;
+
+    /**
+     * @brief Insert line breaks so no line is much longer than lineLength
+     *
+     * Texts of up to 100 characters are returned unchanged.
+     */
+    static std::string wrapText(const std::string& text, std::size_t lineLength);
+};
+
+#endif // MOVIE_DETAILS_VIEW_MODEL_H
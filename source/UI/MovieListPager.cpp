@@ -0,0 +1,111 @@
+#include "MovieListPager.h"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+MovieListPager::MovieListPager(std::size_t pageSize, std::size_t maxCachedPages)
+    : pageSize(pageSize), maxCachedPages(maxCachedPages), knownRows(0), endReached(true) {
+    if (pageSize == 0) {
+        throw std::invalid_argument("MovieListPager page size must be positive.");
+    }
+}
+
+void MovieListPager::reset(PageLoader pageLoader) {
+    clear();
+    loader = std::move(pageLoader);
+    if (!loader) {
+        return;
+    }
+    endReached = false;
+    pageCursors.push_back(0);
+    loadPage(0);
+}
+
+void MovieListPager::clear() {
+    loader = nullptr;
+    pageCursors.clear();
+    pages.clear();
+    knownRows = 0;
+    endReached = true;
+}
+
+void MovieListPager::ensureLoaded(std::size_t first, std::size_t count) {
+    if (!loader || pageCursors.empty()) {
+        return;
+    }
+
+    std::size_t firstPage = first / pageSize;
+    std::size_t lastPage = (first + std::max<std::size_t>(count, 1) - 1) / pageSize + 1; // +1: prefetch
+
+    // Pages before the window are only loaded when their successor's cursor is still unknown
+    for (std::size_t page = std::min(firstPage, pageCursors.size() - 1);
+         page <= lastPage && page < pageCursors.size(); ++page) {
+        if (pages.find(page) == pages.end()) {
+            loadPage(page);
+        }
+    }
+    evictFarPages(firstPage, lastPage);
+}
+
+const MovieDTO* MovieListPager::at(std::size_t index) const {
+    auto it = pages.find(index / pageSize);
+    if (it == pages.end() || index % pageSize >= it->second.size()) {
+        return nullptr;
+    }
+    return &it->second[index % pageSize];
+}
+
+bool MovieListPager::hasRowsFrom(std::size_t index) const {
+    return index < knownRows || !endReached;
+}
+
+std::size_t MovieListPager::knownRowCount() const {
+    return knownRows;
+}
+
+bool MovieListPager::reachedEnd() const {
+    return endReached;
+}
+
+std::size_t MovieListPager::loadedPageCount() const {
+    return pages.size();
+}
+
+std::size_t MovieListPager::getPageSize() const {
+    return pageSize;
+}
+
+void MovieListPager::loadPage(std::size_t page) {
+    std::vector<MovieDTO> rows = loader(pageCursors[page], pageSize);
+
+    if (rows.size() < pageSize) {
+        endReached = true;
+        knownRows = page * pageSize + rows.size();
+        pageCursors.resize(page + 1);
+    } else {
+        if (page + 1 == pageCursors.size()) {
+            pageCursors.push_back(rows.back().id);
+        }
+        knownRows = std::max(knownRows, (page + 1) * pageSize);
+    }
+
+    if (!rows.empty()) {
+        pages[page] = std::move(rows);
+    }
+}
+
+void MovieListPager::evictFarPages(std::size_t firstPage, std::size_t lastPage) {
+    std::size_t limit = std::max(maxCachedPages, lastPage - firstPage + 1);
+    while (pages.size() > limit) {
+        auto distance = [firstPage, lastPage](std::size_t page) -> std::size_t {
+            if (page < firstPage) {
+                return firstPage - page;
+            }
+            return page > lastPage ? page - lastPage : 0;
+        };
+        auto farthest = std::max_element(pages.begin(), pages.end(), [&distance](const auto& a, const auto& b) {
+            return distance(a.first) < distance(b.first);
+        });
+        pages.erase(farthest);
+    }
+}
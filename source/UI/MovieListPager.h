@@ -0,0 +1,122 @@
+/**
+ * @file MovieListPager.h
+ * @brief Virtualized movie list: a bounded window of keyset-paginated pages
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef MOVIE_LIST_PAGER_H
+#define MOVIE_LIST_PAGER_H
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <vector>
+#include "../repository/MovieDTO.h"
+
+/**
+ * @class MovieListPager
+ * @brief Rows of the movie list, loaded a page at a time around what is visible
+ *
+ * Loading the whole catalog for a list that shows seven rows makes startup
+ * time and memory grow with the catalog. The pager instead loads fixed-size
+ * pages through a keyset page loader (movies after a given ID), only for
+ * the rows that are visible plus the page after them, so scrolling down
+ * never waits for the database. At most a few pages are kept; pages far
+ * from the visible rows are dropped and reloaded if the user scrolls back.
+ *
+ * @details
+ * - The first movie ID of every page reached so far is remembered (one int
+ *   per page), so any earlier page can be reloaded with a single range seek
+ * - ensureLoaded() is the only method that calls the loader; rendering reads
+ *   rows with at(), which never loads
+ * - The total number of movies is only known once the last page was loaded;
+ *   until then hasRowsFrom() answers "maybe" optimistically
+ * - Has no SFML dependency
+ *
+ * @par Usage Example
+ * @code
+ * pager.reset([service](int after, std::size_t limit) { return service->showMoviesPage(after, limit); });
+ * pager.ensureLoaded(scrollOffset, VISIBLE_ROWS);   // on open and on every scroll
+ *
+ * for (std::size_t i = scrollOffset; i < scrollOffset + VISIBLE_ROWS; ++i) {
+ *     if (const MovieDTO* movie = pager.at(i)) {
+ *         drawMovieCard(*movie, ...);
+ *     }
+ * }
+ * @endcode
+ *
+ * @see IMovieViewerService::showMoviesPage
+ */
+class MovieListPager {
+public:
+    /**
+     * @brief Loads up to @p limit movies with an ID greater than @p afterMovieId
+     */
+    using PageLoader = std::function<std::vector<MovieDTO>(int afterMovieId, std::size_t limit)>;
+
+    /**
+     * @param pageSize Movies per page
+     * @param maxCachedPages Pages kept in memory (raised if a visible window needs more)
+     *
+     * @throws std::invalid_argument If pageSize is 0
+     */
+    explicit MovieListPager(std::size_t pageSize = 20, std::size_t maxCachedPages = 4);
+
+    /**
+     * @brief Start over with a new loader and load the first page
+     */
+    void reset(PageLoader pageLoader);
+
+    /**
+     * @brief Forget every page and the loader
+     */
+    void clear();
+
+    /**
+     * @brief Load the pages holding rows [first, first + count) and the page after them
+     *
+     * Loads earlier pages first if their cursors are not known yet, then
+     * drops the pages farthest from the window beyond the cache limit.
+     */
+    void ensureLoaded(std::size_t first, std::size_t count);
+
+    /**
+     * @brief Row @p index, or nullptr if its page is not loaded (or past the end)
+     */
+    const MovieDTO* at(std::size_t index) const;
+
+    /**
+     * @brief Whether a row exists at @p index, or might once more pages are loaded
+     */
+    bool hasRowsFrom(std::size_t index) const;
+
+    /**
+     * @brief Rows known to exist so far (the total once reachedEnd())
+     */
+    std::size_t knownRowCount() const;
+
+    /**
+     * @brief Whether the last page of the catalog has been loaded
+     */
+    bool reachedEnd() const;
+
+    std::size_t loadedPageCount() const;
+    std::size_t getPageSize() const;
+
+private:
+    void loadPage(std::size_t page);
+    void evictFarPages(std::size_t firstPage, std::size_t lastPage);
+
+    std::size_t pageSize;
+    std::size_t maxCachedPages;
+    PageLoader loader;
+
+    std::vector<int> pageCursors;                          ///< pageCursors[p]: last ID before page p
+    std::map<std::size_t, std::vector<MovieDTO>> pages;    ///< Loaded pages by page number
+    std::size_t knownRows;
+    bool endReached;
+};
+
+#endif // MOVIE_LIST_PAGER_H
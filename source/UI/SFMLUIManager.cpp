@@ -1,14 +1,19 @@
 #include "SFMLUIManager.h"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <sstream>
+#include "../repository/SeatUnavailableException.h"
+#include "../repository/SeatHoldManager.h"
 
 SFMLUIManager::SFMLUIManager(std::shared_ptr<SessionManager> sessionMgr)
     : sessionManager(sessionMgr), currentState(UIState::GUEST_SCREEN), previousState(UIState::GUEST_SCREEN),
-      selectedMovieIndex(0), selectedShowTimeIndex(0), editingMovieId(-1), managingMovieId(-1),
+      selectedMovieId(-1), selectedShowTimeIndex(0), editingMovieId(-1), managingMovieId(-1),
       isInputtingUsername(true), isInputtingPassword(false), isInputtingEmail(false), isInputtingPhone(false),
       isEditingTitle(false), isEditingDescription(false), isEditingGenre(false), isEditingPrice(false),
       isEditingDate(false), isEditingStartTime(false), isEditingEndTime(false),
-      movieListScrollOffset(0), movieViewScrollOffset(0), isAddingShowtime(false) {
+      movieListScrollOffset(0), movieViewScrollOffset(0), isAddingShowtime(false),
+      renderOnDemand(true), dirty(true), renderedState(UIState::GUEST_SCREEN) {
 }
 
 SFMLUIManager::~SFMLUIManager() {
@@ -90,60 +95,115 @@ bool SFMLUIManager::initialize() {
 
 void SFMLUIManager::run() {
     while (window.isOpen()) {
+        if (renderOnDemand) {
+            waitForActivity();
+        }
         handleEvents();
         update();
-        render();
+        if (!renderOnDemand || dirty) {
+            render();
+            dirty = false;
+        }
+    }
+}
+
+void SFMLUIManager::setRenderOnDemand(bool enabled) {
+    renderOnDemand = enabled;
+    markDirty();
+}
+
+void SFMLUIManager::markDirty() {
+    dirty = true;
+}
+
+void SFMLUIManager::waitForActivity() {
+    if (dirty) {
+        return;
+    }
+
+    auto timer = timeUntilNextTimer();
+    if (!timer) {
+        // Nothing on screen changes until the user does something
+        sf::Event event;
+        if (window.waitEvent(event)) {
+            handleEvent(event);
+        }
+        return;
+    }
+
+    // SFML cannot wait for an event with a timeout: nap in short steps so input stays responsive
+    const sf::Time pollInterval = sf::milliseconds(20);
+    sf::Clock waited;
+    while (waited.getElapsedTime() < *timer) {
+        sf::Event event;
+        if (window.pollEvent(event)) {
+            handleEvent(event);
+            return;
+        }
+        sf::sleep(std::min(*timer - waited.getElapsedTime(), pollInterval));
     }
+    markDirty();
+}
+
+std::optional<sf::Time> SFMLUIManager::timeUntilNextTimer() const {
+    // Hold countdown on the seat map ticks once a second
+    if (currentState == UIState::SEAT_SELECTION && !selectedSeats.empty()) {
+        sf::Int64 remaining = holdTimeLeft().asMicroseconds();
+        if (remaining <= 0) {
+            return sf::Time::Zero;
+        }
+        sf::Int64 untilTick = remaining % 1000000;
+        return sf::microseconds(untilTick == 0 ? 1000000 : untilTick);
+    }
+    return std::nullopt;
+}
+
+sf::Time SFMLUIManager::holdTimeLeft() const {
+    auto ttl = std::chrono::duration_cast<std::chrono::milliseconds>(SeatHoldManager::DEFAULT_TTL);
+    return sf::milliseconds(static_cast<sf::Int32>(ttl.count())) - holdClock.getElapsedTime();
 }
 
 void SFMLUIManager::handleEvents() {
     sf::Event event;
     while (window.pollEvent(event)) {
-        if (event.type == sf::Event::Closed) {
-            window.close();
-        }
-        
-        if (event.type == sf::Event::TextEntered) {
-            handleTextInput(event.text.unicode);
+        handleEvent(event);
+    }
+}
+
+void SFMLUIManager::handleEvent(const sf::Event& event) {
+    // No hover effects: moving the mouse alone does not change the screen
+    if (event.type != sf::Event::MouseMoved) {
+        markDirty();
+    }
+
+    if (event.type == sf::Event::Closed) {
+        window.close();
+    }
+    
+    if (event.type == sf::Event::TextEntered) {
+        handleTextInput(event.text.unicode);
+    }
+    
+    if (event.type == sf::Event::KeyPressed) {
+        handleKeyPress(event.key.code);
+    }
+    
+    if (event.type == sf::Event::MouseButtonPressed) {
+        if (event.mouseButton.button == sf::Mouse::Left) {
+            handleMouseClick(sf::Vector2i(event.mouseButton.x, event.mouseButton.y));
         }
-        
-        if (event.type == sf::Event::KeyPressed) {
-            handleKeyPress(event.key.code);
+    }
+      // Handle mouse wheel scrolling for movie management and movie list screens
+    if (event.type == sf::Event::MouseWheelScrolled && 
+        event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel) {
+        
+        // Wheel up scrolls up
+        int delta = event.mouseWheelScroll.delta > 0 ? -1 : 1;
+        if (currentState == UIState::MOVIE_MANAGEMENT) {
+            scrollMovieList(movieListScrollOffset, delta, MOVIE_MANAGEMENT_ROWS);
         }
-        
-        if (event.type == sf::Event::MouseButtonPressed) {
-            if (event.mouseButton.button == sf::Mouse::Left) {
-                handleMouseClick(sf::Vector2i(event.mouseButton.x, event.mouseButton.y));
-            }
-        }
-          // Handle mouse wheel scrolling for movie management and movie list screens
-        if (event.type == sf::Event::MouseWheelScrolled && 
-            event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel) {
-            
-            const int maxVisibleMovies = 7;
-            
-            if (currentState == UIState::MOVIE_MANAGEMENT) {
-                if (event.mouseWheelScroll.delta > 0 && movieListScrollOffset > 0) {
-                    // Scroll up
-                    movieListScrollOffset--;
-                }
-                else if (event.mouseWheelScroll.delta < 0 && 
-                        (movieListScrollOffset + maxVisibleMovies < movies.size())) {
-                    // Scroll down
-                    movieListScrollOffset++;
-                }
-            }
-            else if (currentState == UIState::MOVIE_LIST) {
-                if (event.mouseWheelScroll.delta > 0 && movieViewScrollOffset > 0) {
-                    // Scroll up
-                    movieViewScrollOffset--;
-                }
-                else if (event.mouseWheelScroll.delta < 0 && 
-                        (movieViewScrollOffset + maxVisibleMovies < movies.size())) {
-                    // Scroll down
-                    movieViewScrollOffset++;
-                }
-            }
+        else if (currentState == UIState::MOVIE_LIST) {
+            scrollMovieList(movieViewScrollOffset, delta, MOVIE_LIST_ROWS);
         }
     }
 }
@@ -184,6 +244,10 @@ void SFMLUIManager::handleTextInput(unsigned int unicode) {
             } else if (isEditingEndTime) {
                 newShowtimeEndTime += inputChar;
             }
+        } else if (currentState == UIState::MOVIE_LIST) {
+            // The search box is the only input on the movie list: typing searches
+            movieSearchQuery += inputChar;
+            applyMovieSearch();
         } else if (currentState == UIState::SHOWTIME_MANAGEMENT) {
             if (isEditingDate) {
                 newShowtimeDate += inputChar;
@@ -229,6 +293,11 @@ void SFMLUIManager::handleKeyPress(sf::Keyboard::Key key) {
             } else if (isEditingEndTime && !newShowtimeEndTime.empty()) {
                 newShowtimeEndTime.pop_back();
             }
+        } else if (currentState == UIState::MOVIE_LIST) {
+            if (!movieSearchQuery.empty()) {
+                movieSearchQuery.pop_back();
+                applyMovieSearch();
+            }
         } else if (currentState == UIState::SHOWTIME_MANAGEMENT) {
             if (isEditingDate && !newShowtimeDate.empty()) {
                 newShowtimeDate.pop_back();
@@ -369,24 +438,23 @@ void SFMLUIManager::handleMouseClick(sf::Vector2i mousePos) {
                     currentState = UIState::GUEST_SCREEN;
                 }
                 break;
-            } else if (isButtonClicked(scrollUpBtn, mousePos) && movieViewScrollOffset > 0) {
-                movieViewScrollOffset--;
-            } else if (isButtonClicked(scrollDownBtn, mousePos) &&
-                       (movieViewScrollOffset + 6 < movies.size())) { // 6 is maxVisibleMovies from renderMovieList
-                movieViewScrollOffset++;
+            } else if (isButtonClicked(scrollUpBtn, mousePos)) {
+                scrollMovieList(movieViewScrollOffset, -1, MOVIE_LIST_ROWS);
+            } else if (isButtonClicked(scrollDownBtn, mousePos)) {
+                scrollMovieList(movieViewScrollOffset, 1, MOVIE_LIST_ROWS);
             } else {
                 // Check movie selection - Adjusted to match renderMovieList
-                const int maxVisibleMovies = 6; // Matches renderMovieList
-                int endIndex = std::min(movieViewScrollOffset + maxVisibleMovies, static_cast<int>(movies.size()));
-                
-                for (int i = movieViewScrollOffset; i < endIndex; ++i) {
-                    int displayIndex = i - movieListScrollOffset; // Display position
+                for (int i = movieViewScrollOffset; i < movieViewScrollOffset + MOVIE_LIST_ROWS; ++i) {
+                    const MovieDTO* movie = moviePages.at(i);
+                    if (!movie) {
+                        break;
+                    }
+                    int displayIndex = i - movieViewScrollOffset; // Display position
                     // Use coordinates and dimensions from renderMovieList for movieBtn
                     sf::RectangleShape movieBtn = createButton(100, 150 + displayIndex * 90, 800, 70);
                     if (isButtonClicked(movieBtn, mousePos)) {
-                        selectedMovieIndex = i;
-                        loadMovieDetails(movies[i].id); // Load details for the selected movie
-                        loadShowTimes(movies[i].id);    // Load showtimes for the selected movie
+                        selectedMovieId = movie->id;
+                        loadMovieDetails(movie->id); // Load details and showtimes once for the screen
                         currentState = UIState::MOVIE_DETAILS;
                         break; 
                     }
@@ -443,71 +511,15 @@ void SFMLUIManager::handleMouseClick(sf::Vector2i mousePos) {
             
             if (isButtonClicked(backBtn, mousePos)) {
                 currentState = UIState::BOOKING_SCREEN;
-                selectedSeats.clear();
+                releaseSelectedSeats();
             } else if (isButtonClicked(confirmBtn, mousePos) && !selectedSeats.empty()) {
                 createBooking();            
             } else {
                 // Check seat selection
-                int seatSize = 40;
-                int seatSpacing = 45;
-                int startX = 200;
-                int startY = 200;
-                
-                // Tạo map để nhóm ghế theo hàng
-                std::map<char, std::vector<std::pair<std::string, SeatStatus>>> seatsByRow;
-                
-                // Nhóm các ghế theo hàng
-                for (size_t i = 0; i < currentSeats.size(); ++i) {
-                    std::string seatId = currentSeats[i].seat->id();
-                    char row = seatId[0]; // Lấy chữ cái đầu tiên (hàng)
-                    seatsByRow[row].push_back({seatId, currentSeats[i].status});
-                }
-                
-                bool seatClicked = false;
-                int rowIndex = 0;
-                
-                // Kiểm tra các ghế theo hàng
-                for (const auto& rowPair : seatsByRow) {
-                    if (seatClicked) break;
-                    
-                    const auto& seats = rowPair.second;
-                    for (size_t i = 0; i < seats.size(); ++i) {
-                        const auto& [seatId, status] = seats[i];
-                        
-                        // Chỉ lấy số từ ID ghế
-                        int seatNumber = 0;
-                        if (seatId.length() > 1) {
-                            try {
-                                seatNumber = std::stoi(seatId.substr(1)) - 1;
-                            } catch (const std::exception&) {
-                                seatNumber = i;
-                            }
-                        }
-                          int seatX = startX + seatNumber * seatSpacing;
-                        int seatY = startY + rowIndex * seatSpacing;
-                        
-                        // Determine seat type for proper sizing
-                        SeatType type = SeatType::SINGLE; // Default
-                        for (const auto& currentSeat : currentSeats) {
-                            if (currentSeat.seat->id() == seatId) {
-                                type = currentSeat.seat->type();
-                                break;
-                            }
-                        }                          // Create hit detection area with uniform size for all seat types
-                        sf::RectangleShape seat;
-                        seat = createButton(seatX, seatY, seatSize, seatSize);
-                        
-                        if (isButtonClicked(seat, mousePos) && status == SeatStatus::AVAILABLE) {
-                            auto it = std::find(selectedSeats.begin(), selectedSeats.end(), seatId);
-                            if (it != selectedSeats.end()) {
-                                selectedSeats.erase(it);
-                            } else {
-                                selectedSeats.push_back(seatId);
-                            }
-                            seatClicked = true;
-                            break;
-                        }                    }
-                    rowIndex++;
+                int index = seatMap.seatAt(mousePos);
+                // Our own selections are reported as HELD, so they stay clickable to deselect them
+                if (index >= 0 && (seatMap.status(index) == SeatStatus::AVAILABLE || seatMap.isSelected(index))) {
+                    toggleSeat(seatMap.seatId(index));
                 }
             }
             break;
@@ -587,19 +599,19 @@ void SFMLUIManager::handleMouseClick(sf::Vector2i mousePos) {
                 clearEditingFields();
                 isEditingTitle = true;
                 currentState = UIState::EDIT_MOVIE;
-            } else if (isButtonClicked(scrollUpBtn, mousePos) && movieListScrollOffset > 0) {
+            } else if (isButtonClicked(scrollUpBtn, mousePos)) {
                 // Scroll up when there are movies to show above
-                movieListScrollOffset--;
-            } else if (isButtonClicked(scrollDownBtn, mousePos) && 
-                      (movieListScrollOffset + 7 < movies.size())) { // 7 is maxVisibleMovies
+                scrollMovieList(movieListScrollOffset, -1, MOVIE_MANAGEMENT_ROWS);
+            } else if (isButtonClicked(scrollDownBtn, mousePos)) {
                 // Scroll down when there are more movies below
-                movieListScrollOffset++;
+                scrollMovieList(movieListScrollOffset, 1, MOVIE_MANAGEMENT_ROWS);
             } else {
                 // Check for edit/delete buttons on movie cards (coordinates match renderMovieManagement)
-                const int maxVisibleMovies = 7;
-                int endIndex = std::min(movieListScrollOffset + maxVisibleMovies, static_cast<int>(movies.size()));
-                
-                for (int i = movieListScrollOffset; i < endIndex; ++i) {
+                for (int i = movieListScrollOffset; i < movieListScrollOffset + MOVIE_MANAGEMENT_ROWS; ++i) {
+                    const MovieDTO* movie = moviePages.at(i);
+                    if (!movie) {
+                        break;
+                    }
                     int displayIndex = i - movieListScrollOffset; // Display position
                     
                     sf::RectangleShape editBtn = createButton(920, 155 + displayIndex * 80, 80, 30);
@@ -607,15 +619,15 @@ void SFMLUIManager::handleMouseClick(sf::Vector2i mousePos) {
                     sf::RectangleShape showtimeBtn = createButton(1100, 155 + displayIndex * 80, 80, 25);
                     
                     if (isButtonClicked(editBtn, mousePos)) {
-                        editingMovieId = movies[i].id;
-                        editMovieTitle = movies[i].title;
-                        editMovieGenre = movies[i].genre;
+                        editingMovieId = movie->id;
+                        editMovieTitle = movie->title;
+                        editMovieGenre = movie->genre;
                         // Lấy description từ service (nếu có)
                         auto visitor = std::make_shared<MovieViewerServiceVisitor>();
                         sessionManager->getCurrentContext()->accept(visitor);
                         auto movieService = visitor->getMovieViewerService();
                         if (movieService) {
-                            auto detail = movieService->showMovieDetail(movies[i].id);
+                            auto detail = movieService->showMovieDetail(movie->id);
                             if (detail) {
                                 editMovieDescription = detail->getDescription();
                             } else {
@@ -624,18 +636,19 @@ void SFMLUIManager::handleMouseClick(sf::Vector2i mousePos) {
                         } else {
                             editMovieDescription = "";
                         }                        // Removed Movie Duration
-                        editMoviePrice = std::to_string(movies[i].rating); // Use actual movie rating
+                        editMoviePrice = std::to_string(movie->rating); // Use actual movie rating
                         resetEditingFlags();
                         isEditingTitle = true;
                         currentState = UIState::EDIT_MOVIE;
                         break;
                     } else if (isButtonClicked(deleteBtn, mousePos)) {
-                        deleteMovie(movies[i].id);
+                        deleteMovie(movie->id);
                         loadMovies(); // Refresh the list
                         break;
                     } else if (isButtonClicked(showtimeBtn, mousePos)) {
-                        managingMovieId = movies[i].id;
-                        loadShowTimes(movies[i].id);
+                        managingMovieId = movie->id;
+                        managingMovieTitle = movie->title;
+                        loadShowTimes(movie->id);
                         resetShowtimeEditingFlags();
                         currentState = UIState::SHOWTIME_MANAGEMENT;
                         break;
@@ -737,10 +750,58 @@ void SFMLUIManager::handleMouseClick(sf::Vector2i mousePos) {
 }
 
 void SFMLUIManager::update() {
-    // Update logic if needed
+    // Holds were not renewed in time: the seats may already be someone else's
+    if (currentState == UIState::SEAT_SELECTION && !selectedSeats.empty() &&
+        holdTimeLeft() <= sf::Time::Zero && selectedShowTimeIndex < currentShowTimes.size()) {
+        loadSeats(currentShowTimes[selectedShowTimeIndex].showTimeID);
+        statusMessage = "Your seat holds expired. Please select your seats again.";
+        markDirty();
+    }
+
+    // An admin change dropped the details snapshot: reload it here, never while rendering
+    if (currentState == UIState::MOVIE_DETAILS && !movieDetails.isLoaded()) {
+        markDirty();
+        if (selectedMovieId >= 0) {
+            loadMovieDetails(selectedMovieId);
+        }
+        if (!movieDetails.isLoaded()) {
+            currentState = UIState::MOVIE_LIST; // The movie is gone
+        }
+    }
+}
+
+void SFMLUIManager::scrollMovieList(int& scrollOffset, int delta, int visibleRows) {
+    if (delta < 0 && scrollOffset > 0) {
+        scrollOffset--;
+    } else if (delta > 0 && moviePages.hasRowsFrom(scrollOffset + visibleRows)) {
+        scrollOffset++;
+    } else {
+        return;
+    }
+    // Loads the rows now in view and prefetches the page after them
+    moviePages.ensureLoaded(scrollOffset, visibleRows);
+}
+
+std::string SFMLUIManager::movieCountLabel(int scrollOffset, int visibleRows) const {
+    if (moviePages.knownRowCount() == 0) {
+        return movieSearchQuery.empty() ? "No movies" : "No movies match";
+    }
+    std::size_t last = std::min(static_cast<std::size_t>(scrollOffset + visibleRows), moviePages.knownRowCount());
+    std::string label = "Movies " + std::to_string(scrollOffset + 1) + "-" + std::to_string(last);
+    // The total is only known once the last page was loaded
+    if (moviePages.reachedEnd()) {
+        label += " of " + std::to_string(moviePages.knownRowCount());
+    }
+    return label;
 }
 
 void SFMLUIManager::render() {
+    // Labels of the screen we left will not be drawn again soon
+    if (currentState != renderedState) {
+        textCache.clear();
+        renderedState = currentState;
+    }
+
     window.clear(sf::Color::Black);    switch (currentState) {
         case UIState::GUEST_SCREEN:
             renderGuestScreen();
@@ -958,13 +1019,19 @@ void SFMLUIManager::renderMovieList() {
     window.draw(backText);
     
     // Movie count with improved styling
-    std::string movieCountText = "Total: " + std::to_string(movies.size()) + " movies";
+    std::string movieCountText = movieCountLabel(movieViewScrollOffset, MOVIE_LIST_ROWS);
     sf::Text movieCount = createText(movieCountText, 550, 100, 18);
     movieCount.setFillColor(sf::Color(180, 180, 255));
     movieCount.setStyle(sf::Text::Italic);
     window.draw(movieCount);
+
+    // Search box (typing anywhere on this screen goes into it)
+    sf::RectangleShape searchField = createInputField(940, 50, 190, 36, true);
+    window.draw(searchField);
+    sf::Text searchText = createText(movieSearchQuery.empty() ? "Type to search..." : movieSearchQuery, 950, 58, 16);
+    searchText.setFillColor(movieSearchQuery.empty() ? sf::Color(100, 100, 100) : sf::Color::Black);
+    window.draw(searchText);
       // Enhanced scroll buttons
-    const int maxVisibleMovies = 6; // Adjusted for larger movie cards
     
     // Scroll up button with improved styling
     sf::RectangleShape scrollUpBtn = createStyledButton(1150, 150, 50, 40, sf::Color(80, 40, 120));
@@ -986,7 +1053,7 @@ void SFMLUIManager::renderMovieList() {
     scrollDownBtn.setOutlineThickness(2);
     scrollDownBtn.setOutlineColor(sf::Color(120, 80, 160));
     sf::Text scrollDownText = createText("v", 1168, 605, 20);
-    if (movieViewScrollOffset + maxVisibleMovies < movies.size()) {
+    if (moviePages.hasRowsFrom(movieViewScrollOffset + MOVIE_LIST_ROWS)) {
         scrollDownBtn.setFillColor(sf::Color(80, 40, 120));
         scrollDownText.setFillColor(sf::Color(220, 220, 255));
     } else {
@@ -996,9 +1063,13 @@ void SFMLUIManager::renderMovieList() {
     window.draw(scrollDownBtn);
     window.draw(scrollDownText);
       // Movie list with scrolling and enhanced visual effect
-    int endIndex = std::min(movieViewScrollOffset + maxVisibleMovies, static_cast<int>(movies.size()));
-    for (int i = movieViewScrollOffset; i < endIndex; ++i) {
-        int displayIndex = i - movieListScrollOffset; // Vị trí hiển thị trên màn hình
+    // Only the visible rows are loaded (see scrollMovieList)
+    for (int i = movieViewScrollOffset; i < movieViewScrollOffset + MOVIE_LIST_ROWS; ++i) {
+        const MovieDTO* movie = moviePages.at(i);
+        if (!movie) {
+            break;
+        }
+        int displayIndex = i - movieViewScrollOffset; // Vị trí hiển thị trên màn hình
         
        // Dịch sang phải +100 pixels
 int offsetX = 100;
@@ -1018,14 +1089,14 @@ movieBtn.setOutlineColor(sf::Color(100, 100, 150, 200));
 window.draw(movieBtn);
 
 // Movie title
-sf::Text movieTitle = createText(movies[i].title, 120 + offsetX, 160 + displayIndex * 90, 22);
+sf::Text movieTitle = createText(movie->title, 120 + offsetX, 160 + displayIndex * 90, 22);
 movieTitle.setStyle(sf::Text::Bold);
 movieTitle.setFillColor(sf::Color(220, 220, 255));
 window.draw(movieTitle);
 
 // Movie details
-std::string movieDetails = "Genre: " + movies[i].genre + " | Rating: " + std::to_string(movies[i].rating);
-sf::Text detailsText = createText(movieDetails, 120 + offsetX, 190 + displayIndex * 90, 16);
+std::string movieInfo = "Genre: " + movie->genre + " | Rating: " + std::to_string(movie->rating);
+sf::Text detailsText = createText(movieInfo, 120 + offsetX, 190 + displayIndex * 90, 16);
 detailsText.setFillColor(sf::Color(180, 180, 220));
 detailsText.setStyle(sf::Text::Italic);
 window.draw(detailsText);
@@ -1042,8 +1113,9 @@ void SFMLUIManager::renderMovieDetails() {
     // Only draw gradient background for non-guest screens
     drawGradientBackground();
     
-    if (selectedMovieIndex < movies.size()) {
-        const auto& movie = movies[selectedMovieIndex];
+    // Everything below comes from the snapshot taken by loadMovieDetails()
+    if (movieDetails.isLoaded()) {
+        const auto& showTimes = movieDetails.getShowTimes();
         
         // Create a stylish header with background
         sf::RectangleShape headerBg = createButton(300, 40, 600, 50);
@@ -1076,7 +1148,7 @@ void SFMLUIManager::renderMovieDetails() {
         window.draw(movieCardBg);
         
         // Movie information with better styling
-        sf::Text movieTitle = createText(movie.title, 100, 140, 32);
+        sf::Text movieTitle = createText(movieDetails.getTitle(), 100, 140, 32);
         movieTitle.setStyle(sf::Text::Bold);
         movieTitle.setFillColor(sf::Color(220, 220, 255));
         movieTitle.setOutlineThickness(1);
@@ -1084,13 +1156,13 @@ void SFMLUIManager::renderMovieDetails() {
         window.draw(movieTitle);
                 
         // Create genre label with tag-like design
-        sf::RectangleShape genreTag = createButton(100, 190, 120 + movie.genre.length() * 8, 30);
+        sf::RectangleShape genreTag = createButton(100, 190, 120 + movieDetails.getGenre().length() * 8, 30);
         genreTag.setFillColor(sf::Color(60, 80, 120));
         genreTag.setOutlineThickness(1);
         genreTag.setOutlineColor(sf::Color(100, 120, 180));
         window.draw(genreTag);
         
-        sf::Text genreLabel = createText("GENRE: " + movie.genre, 110, 195, 18);
+        sf::Text genreLabel = createText("GENRE: " + movieDetails.getGenre(), 110, 195, 18);
         genreLabel.setFillColor(sf::Color(180, 200, 255));
         window.draw(genreLabel);
         
@@ -1100,20 +1172,9 @@ void SFMLUIManager::renderMovieDetails() {
         star.setFillColor(sf::Color(255, 215, 0)); // Gold color
         window.draw(star);
         
-        sf::Text ratingLabel = createText("Rating: " + std::to_string(movie.rating) + "/10", 130, 230, 20);
+        sf::Text ratingLabel = createText("Rating: " + std::to_string(movieDetails.getRating()) + "/10", 130, 230, 20);
         ratingLabel.setFillColor(sf::Color(255, 220, 100));
         window.draw(ratingLabel);
-          // Get description from MovieViewerService
-        std::string description;
-        auto visitor = std::make_shared<MovieViewerServiceVisitor>();
-        sessionManager->getCurrentContext()->accept(visitor);
-        auto movieService = visitor->getMovieViewerService();
-        if (movieService) {
-            auto detail = movieService->showMovieDetail(movie.id);
-            if (detail) {
-                description = detail->getDescription();
-            }
-        }
         
         // Description section with styled background
         sf::RectangleShape descriptionBg = createButton(100, 265, 800, 110);
@@ -1127,26 +1188,8 @@ void SFMLUIManager::renderMovieDetails() {
         descTitle.setFillColor(sf::Color(180, 180, 255));
         window.draw(descTitle);
         
-        if (!description.empty()) {
-            // Wrap text if it's too long
-            std::string wrappedDesc = description;
-            if (wrappedDesc.length() > 100) {
-                // Simple text wrapping - insert line breaks
-                int pos = 0;
-                int lineLength = 85; // Characters per line
-                while (pos + lineLength < wrappedDesc.length()) {
-                    // Find a good place to break (space)
-                    int breakPos = wrappedDesc.rfind(' ', pos + lineLength);
-                    if (breakPos != std::string::npos && breakPos > pos) {
-                        wrappedDesc.replace(breakPos, 1, "\n");
-                        pos = breakPos + 1;
-                    } else {
-                        pos += lineLength;
-                    }
-                }
-            }
-            
-            sf::Text descText = createText(wrappedDesc, 110, 295, 16);
+        if (!movieDetails.getDescription().empty()) {
+            sf::Text descText = createText(movieDetails.getWrappedDescription(), 110, 295, 16);
             descText.setFillColor(sf::Color(220, 220, 220));
             window.draw(descText);
         } else {
@@ -1168,14 +1211,14 @@ void SFMLUIManager::renderMovieDetails() {
         showtimesTitle.setFillColor(sf::Color(180, 180, 255));
         window.draw(showtimesTitle);
         
-        if (currentShowTimes.empty()) {
+        if (showTimes.empty()) {
             sf::Text noShowtimes = createText("No showtimes available for this movie", 110, 425, 16);
             noShowtimes.setFillColor(sf::Color(180, 180, 180));
             noShowtimes.setStyle(sf::Text::Italic);
             window.draw(noShowtimes);
         } else {
-            for (size_t i = 0; i < currentShowTimes.size() && i < 3; ++i) {
-                const auto& showtime = currentShowTimes[i];
+            for (size_t i = 0; i < showTimes.size() && i < 3; ++i) {
+                const auto& showtime = showTimes[i];
                 
                 // Create a styled card for each showtime
                 sf::RectangleShape showtimeCard = createButton(120, 425 + i * 30, 400, 25);
@@ -1184,7 +1227,7 @@ void SFMLUIManager::renderMovieDetails() {
                 showtimeCard.setOutlineColor(sf::Color(100, 100, 150));
                 window.draw(showtimeCard);
                 
-                std::string showtimeInfo = showtime.date + " | " + showtime.startTime + " - " + showtime.endTime;
+                std::string showtimeInfo = showtime.date() + " | " + showtime.startTime() + " - " + showtime.endTime();
                 sf::Text showtimeText = createText(showtimeInfo, 130, 427 + i * 30, 16);
                 showtimeText.setFillColor(sf::Color(220, 220, 250));
                 window.draw(showtimeText);
@@ -1197,8 +1240,8 @@ void SFMLUIManager::renderMovieDetails() {
             }
             
             // If there are more showtimes than we can display
-            if (currentShowTimes.size() > 3) {
-                sf::Text moreShowtimes = createText("+" + std::to_string(currentShowTimes.size() - 3) + " more showtimes...", 120, 485, 14);
+            if (showTimes.size() > 3) {
+                sf::Text moreShowtimes = createText("+" + std::to_string(showTimes.size() - 3) + " more showtimes...", 120, 485, 14);
                 moreShowtimes.setFillColor(sf::Color(160, 160, 200));
                 moreShowtimes.setStyle(sf::Text::Italic);
                 window.draw(moreShowtimes);
@@ -1211,7 +1254,7 @@ void SFMLUIManager::renderMovieDetails() {
         window.draw(ctaBg);
         
         // Book button (only for authenticated users)
-        if (!currentShowTimes.empty() && sessionManager->isUserAuthenticated()) {
+        if (!showTimes.empty() && sessionManager->isUserAuthenticated()) {
             // Create a gradient-like button with two rectangles
             sf::RectangleShape bookBtnShadow = createButton(400, 560, 210, 55);
             bookBtnShadow.setFillColor(sf::Color(0, 80, 0));
@@ -1235,7 +1278,7 @@ void SFMLUIManager::renderMovieDetails() {
             ticketIcon.setPosition(405, 575);
             ticketIcon.setFillColor(sf::Color::White);
             window.draw(ticketIcon);
-        } else if (!currentShowTimes.empty() && !sessionManager->isUserAuthenticated()) {
+        } else if (!showTimes.empty() && !sessionManager->isUserAuthenticated()) {
             // Message for guests with stylish design
             sf::RectangleShape messageBox = createButton(350, 555, 300, 30);
             messageBox.setFillColor(sf::Color(60, 60, 0, 180));
@@ -1302,7 +1345,7 @@ void SFMLUIManager::renderBookingScreen() {
         window.draw(showtimeBtn);
         
         const auto& showtime = currentShowTimes[i];
-        std::string showtimeInfo = showtime.date + " " + showtime.startTime + " - " + showtime.endTime;
+        std::string showtimeInfo = showtime.date() + " " + showtime.startTime() + " - " + showtime.endTime();
         sf::Text showtimeText = createText(showtimeInfo, 110, 165 + i * 60, 18);
         window.draw(showtimeText);
     }
@@ -1337,29 +1380,21 @@ void SFMLUIManager::renderSeatSelection() {
     screenText.setFillColor(sf::Color::Black);
     window.draw(screenText);
     
-    // Seat grid
-    int seatSize = 40;
+    // Seat grid, laid out by loadSeats()
     int seatSpacing = 45;
     int startX = 200;
     int startY = 200;
-      // Arrange seats by row (first letter)
-    std::map<char, std::vector<std::pair<std::string, SeatStatus>>> seatsByRow;
+    int columnCount = std::max(seatMap.columnCount(), 10);
     
-    // Group seats by row (first character of seat ID)
-    for (size_t i = 0; i < currentSeats.size(); ++i) {
-        std::string seatId = currentSeats[i].seat->id();
-        char row = seatId[0]; // Get first character (e.g., 'A' from 'A1')
-        seatsByRow[row].push_back({seatId, currentSeats[i].status});
-    }
-      // Display column numbers at the top with highlighting
-    sf::RectangleShape columnHeaderBg(sf::Vector2f(520, 30));
+    // Display column numbers at the top with highlighting
+    sf::RectangleShape columnHeaderBg(sf::Vector2f(float(columnCount * seatSpacing + 70), 30));
     columnHeaderBg.setPosition(float(startX - 10), float(startY - 40));
     columnHeaderBg.setFillColor(sf::Color(40, 40, 60));
     columnHeaderBg.setOutlineThickness(1);
     columnHeaderBg.setOutlineColor(sf::Color(100, 100, 100));
     window.draw(columnHeaderBg);
     
-    for (int col = 1; col <= 10; ++col) {
+    for (int col = 1; col <= columnCount; ++col) {
         // Circle background for column numbers
         sf::CircleShape colBg(10);
         colBg.setPosition(float(startX + (col-1) * seatSpacing + 10), float(startY - 35));
@@ -1372,81 +1407,10 @@ void SFMLUIManager::renderSeatSelection() {
         colText.setFillColor(sf::Color(220, 220, 220));
         window.draw(colText);
     }
-      // Display row names
-    int rowIndex = 0;
-    for (const auto& rowPair : seatsByRow) {
-        char rowName = rowPair.first;
-        
-        // Display row name on the left with a background for better visibility
-        sf::CircleShape rowBg(12);
-        rowBg.setPosition(float(startX - 35), float(startY + rowIndex * seatSpacing + 7));
-        rowBg.setFillColor(sf::Color(60, 60, 60));
-        rowBg.setOutlineThickness(1);
-        rowBg.setOutlineColor(sf::Color(150, 150, 150));
-        window.draw(rowBg);
-        
-        sf::Text rowText = createText(std::string(1, rowName), startX - 30, startY + rowIndex * seatSpacing + 10, 16);
-        rowText.setFillColor(sf::Color(220, 220, 0)); // Yellow
-        window.draw(rowText);
-        
-        // Hiển thị ghế của hàng đó
-        const auto& seats = rowPair.second;
-        for (size_t i = 0; i < seats.size(); ++i) {
-            const auto& [seatId, status] = seats[i];
-            
-            // Chỉ lấy số từ ID ghế (ví dụ: '1' từ 'A1')
-            int seatNumber = 0;
-            if (seatId.length() > 1) {
-                try {
-                    seatNumber = std::stoi(seatId.substr(1)) - 1; // -1 vì số ghế bắt đầu từ 1, nhưng index bắt đầu từ 0
-                } catch (const std::exception&) {
-                    seatNumber = i; // Fallback nếu không thể chuyển đổi
-                }
-            }
-            
-            int seatX = startX + seatNumber * seatSpacing;
-            int seatY = startY + rowIndex * seatSpacing;
-            
-            sf::RectangleShape seat = createButton(seatX, seatY, seatSize, seatSize);
-            
-            bool isSelected = std::find(selectedSeats.begin(), selectedSeats.end(), seatId) != selectedSeats.end();
-            
-            if (status == SeatStatus::BOOKED) {
-                seat.setFillColor(sf::Color::Red);
-            } else if (isSelected) {
-                seat.setFillColor(sf::Color::Green);
-            } else {
-                // Màu khác cho ghế Single và Couple để dễ phân biệt
-                SeatType type = SeatType::SINGLE; // Mặc định là Single
-                
-                // Tìm kiếm thông tin loại ghế từ danh sách currentSeats
-                for (const auto& currentSeat : currentSeats) {
-                    if (currentSeat.seat->id() == seatId) {
-                        type = currentSeat.seat->type();
-                        break;
-                    }
-                }                
-                // Use different colors for different seat types, but keep the size the same
-                if (type == SeatType::COUPLE) {
-                    seat.setFillColor(sf::Color(100, 100, 255)); // Blue-purple for Couple
-                    
-                    // Add a small love heart icon or symbol
-                    sf::CircleShape heart(5);
-                    heart.setPosition(float(seatX + seatSize - 12), float(seatY + 5));
-                    heart.setFillColor(sf::Color(255, 150, 150));
-                    window.draw(heart);
-                } else {
-                    seat.setFillColor(sf::Color(0, 150, 255));    // Sky blue for Single
-                }
-            }
-            
-            window.draw(seat);
-            
-            sf::Text seatText = createText(seatId, seatX + 5, seatY + 10, 12);
-            window.draw(seatText);        }
-        
-        rowIndex++;
-    }
+    
+    // Seats, row names and seat labels in three draw calls
+    window.draw(seatMap);
+    
     // Legend with visual indicators
     // Background for the legend
     sf::RectangleShape legendBg(sf::Vector2f(700, 60));
@@ -1492,6 +1456,21 @@ void SFMLUIManager::renderSeatSelection() {
     window.draw(selectedSeatIcon);
     sf::Text selectedSeatText = createText("Selected", 645, 650, 16);
     window.draw(selectedSeatText);
+
+    // Held seat indicator
+    sf::RectangleShape heldSeatIcon(sf::Vector2f(20, 20));
+    heldSeatIcon.setPosition(740, 650);
+    heldSeatIcon.setFillColor(sf::Color(255, 165, 0));
+    window.draw(heldSeatIcon);
+    sf::Text heldSeatText = createText("Held", 765, 650, 16);
+    window.draw(heldSeatText);
+
+    // Seat taken or booking failed
+    if (!statusMessage.empty()) {
+        sf::Text status = createText(statusMessage, 220, 710, 16);
+        status.setFillColor(sf::Color::Red);
+        window.draw(status);
+    }
     
     // Instructions text
     sf::Text instructions = createText("Click on available seats to select them for booking", 220, 675, 14);
@@ -1568,6 +1547,16 @@ void SFMLUIManager::renderSeatSelection() {
         confirmText.setStyle(sf::Text::Bold);
         window.draw(confirmText);
     }
+
+    // Hold countdown, redrawn once a second by the timer in waitForActivity()
+    if (!selectedSeats.empty()) {
+        int secondsLeft = std::max(0, static_cast<int>(std::ceil(holdTimeLeft().asSeconds())));
+        std::string countdown = std::to_string(secondsLeft / 60) + ":" +
+                                (secondsLeft % 60 < 10 ? "0" : "") + std::to_string(secondsLeft % 60);
+        sf::Text holdText = createText("Seats held for " + countdown, 1050, 615, 16);
+        holdText.setFillColor(secondsLeft <= 30 ? sf::Color(255, 120, 120) : sf::Color(255, 220, 100));
+        window.draw(holdText);
+    }
 }
 
 void SFMLUIManager::renderBookingHistory() {
@@ -1596,7 +1585,7 @@ void SFMLUIManager::renderBookingHistory() {
         sf::Text movieTitle = createText("Movie: " + booking.movieTitle, 110, 160 + i * 120, 18);
         window.draw(movieTitle);
         
-        sf::Text showTime = createText("Date: " + booking.showTime.date + " " + booking.showTime.startTime, 110, 185 + i * 120, 16);
+        sf::Text showTime = createText("Date: " + booking.showTime.date() + " " + booking.showTime.startTime(), 110, 185 + i * 120, 16);
         window.draw(showTime);
         
         std::string seatsInfo = "Seats: ";
@@ -1739,13 +1728,12 @@ void SFMLUIManager::renderMovieManagement() {
     window.draw(addText);
     
     // Hiển thị thông tin về tổng số phim
-    std::string movieCountText = "Total: " + std::to_string(movies.size()) + " movies";
+    std::string movieCountText = movieCountLabel(movieListScrollOffset, MOVIE_MANAGEMENT_ROWS);
     sf::Text movieCount = createText(movieCountText, 450, 90, 16);
     movieCount.setFillColor(sf::Color(200, 200, 200));
     window.draw(movieCount);
     
     // Scroll buttons
-    const int maxVisibleMovies = 7; // Số phim tối đa hiển thị đồng thời
       // Scroll up button - moved higher
     sf::RectangleShape scrollUpBtn = createStyledButton(950, 50, 50, 30, sf::Color(100, 100, 150));
     sf::Text scrollUpText = createText("^", 968, 55, 18);
@@ -1761,7 +1749,7 @@ void SFMLUIManager::renderMovieManagement() {
       // Scroll down button - positioned at the bottom of the screen
     sf::RectangleShape scrollDownBtn = createStyledButton(950, 680, 50, 30, sf::Color(100, 100, 150));
     sf::Text scrollDownText = createText("v", 968, 685, 18);
-    if (movieListScrollOffset + maxVisibleMovies < movies.size()) {
+    if (moviePages.hasRowsFrom(movieListScrollOffset + MOVIE_MANAGEMENT_ROWS)) {
         scrollDownBtn.setFillColor(sf::Color(100, 100, 150));
         scrollDownText.setFillColor(sf::Color::White);
     } else {
@@ -1772,14 +1760,17 @@ void SFMLUIManager::renderMovieManagement() {
     window.draw(scrollDownText);
     
     // Movie list for management - với cơ chế cuộn
-    int endIndex = std::min(movieListScrollOffset + maxVisibleMovies, static_cast<int>(movies.size()));
-    for (int i = movieListScrollOffset; i < endIndex; ++i) {
+    for (int i = movieListScrollOffset; i < movieListScrollOffset + MOVIE_MANAGEMENT_ROWS; ++i) {
+        const MovieDTO* movie = moviePages.at(i);
+        if (!movie) {
+            break;
+        }
         int displayIndex = i - movieListScrollOffset; // Display position
         sf::RectangleShape movieRow = createButton(100, 150 + displayIndex * 80, 800, 70);
         movieRow.setFillColor(sf::Color(50, 50, 100));
         window.draw(movieRow);
         
-        std::string movieInfo = movies[i].title + " - " + movies[i].genre;
+        std::string movieInfo = movie->title + " - " + movie->genre;
         sf::Text movieText = createText(movieInfo, 110, 170 + displayIndex * 80, 18);
         window.draw(movieText);
           // Edit button
@@ -1965,11 +1956,8 @@ void SFMLUIManager::renderSuccessMessage() {
 
 // Helper method implementations
 sf::Text SFMLUIManager::createText(const std::string& content, float x, float y, int size) {
-    sf::Text text;
-    text.setFont(font);
-    text.setString(content);
-    text.setCharacterSize(size);
-    text.setFillColor(sf::Color::White);
+    // The copy keeps the cached glyph layout: positioning and recolouring it is cheap
+    sf::Text text = textCache.get(content, font, static_cast<unsigned int>(size));
     text.setPosition(sf::Vector2f(x, y));  // SFML 3.0 requires Vector2f
     return text;
 }
@@ -2057,11 +2045,55 @@ void SFMLUIManager::loadMovies() {
     sessionManager->getCurrentContext()->accept(visitor);
     auto movieService = visitor->getMovieViewerService();
     
+    movieSearchQuery.clear();
     if (movieService) {
-        movies = movieService->showAllMovies();
+        // Pages are fetched as the lists scroll; only the first ones are loaded here
+        moviePages.reset([movieService](int afterMovieId, std::size_t limit) {
+            return movieService->showMoviesPage(afterMovieId, limit);
+        });
         // Reset scroll offsets whenever movies are loaded
         movieViewScrollOffset = 0;
+        moviePages.ensureLoaded(0, MOVIE_LIST_ROWS);
+        // The admin list keeps its position after an edit, unless the rows there are gone
+        moviePages.ensureLoaded(movieListScrollOffset, MOVIE_MANAGEMENT_ROWS);
+        while (movieListScrollOffset > 0 && !moviePages.at(movieListScrollOffset)) {
+            movieListScrollOffset--;
+            moviePages.ensureLoaded(movieListScrollOffset, MOVIE_MANAGEMENT_ROWS);
+        }
+    }
+}
+
+void SFMLUIManager::applyMovieSearch() {
+    if (movieSearchQuery.empty()) {
+        loadMovies();
+        return;
     }
+
+    auto visitor = std::make_shared<MovieViewerServiceVisitor>();
+    sessionManager->getCurrentContext()->accept(visitor);
+    auto movieService = visitor->getMovieViewerService();
+    if (!movieService) {
+        return;
+    }
+
+    // Ranked results are not in ID order, so the list pages through them in memory,
+    // each page starting after the last movie of the previous one
+    auto results = std::make_shared<std::vector<MovieDTO>>(
+        movieService->searchMovies(movieSearchQuery, MOVIE_SEARCH_LIMIT));
+    moviePages.reset([results](int afterMovieId, std::size_t limit) {
+        auto first = results->begin();
+        if (afterMovieId != 0) {
+            first = std::find_if(results->begin(), results->end(),
+                [afterMovieId](const MovieDTO& movie) { return movie.id == afterMovieId; });
+            if (first != results->end()) {
+                ++first;
+            }
+        }
+        auto count = std::min(limit, static_cast<std::size_t>(results->end() - first));
+        return std::vector<MovieDTO>(first, first + count);
+    });
+    movieViewScrollOffset = 0;
+    moviePages.ensureLoaded(0, MOVIE_LIST_ROWS);
 }
 
 void SFMLUIManager::loadMovieDetails(int movieId) {
@@ -2069,9 +2101,11 @@ void SFMLUIManager::loadMovieDetails(int movieId) {
     sessionManager->getCurrentContext()->accept(visitor);
     auto movieService = visitor->getMovieViewerService();
     
-    if (movieService) {
-        auto movieDetail = movieService->showMovieDetail(movieId);
-        // Movie detail is already loaded when showing movie list
+    if (movieDetails.load(movieService, movieId)) {
+        // The booking screen continues with the same showtimes
+        currentShowTimes = movieDetails.getShowTimes();
+    } else {
+        currentShowTimes.clear();
     }
 }
 
@@ -2093,9 +2127,62 @@ void SFMLUIManager::loadSeats(int showTimeId) {
     if (bookingService) {
         currentSeats = bookingService->viewSeatsStatus(showTimeId);
         selectedSeats.clear();
+        statusMessage.clear();
+        seatMap.build(currentSeats, font);
+        seatMap.update(currentSeats, selectedSeats);
     }
 }
 
+void SFMLUIManager::toggleSeat(const std::string& seatId) {
+    auto visitor = std::make_shared<BookingServiceVisitor>();
+    sessionManager->getCurrentContext()->accept(visitor);
+    auto bookingService = visitor->getBookingService();
+    
+    if (!bookingService || selectedShowTimeIndex >= currentShowTimes.size()) {
+        return;
+    }
+    int userID = sessionManager->getCurrentAccount().userID;
+    int showTimeID = currentShowTimes[selectedShowTimeIndex].showTimeID;
+    
+    auto it = std::find(selectedSeats.begin(), selectedSeats.end(), seatId);
+    if (it != selectedSeats.end()) {
+        bookingService->releaseSeat(userID, showTimeID, seatId);
+        selectedSeats.erase(it);
+    } else if (bookingService->holdSeat(userID, showTimeID, seatId)) {
+        selectedSeats.push_back(seatId);
+        statusMessage.clear();
+    } else {
+        statusMessage = "Seat " + seatId + " has just been taken by another customer.";
+    }
+    
+    // Every click renews our holds; a seat whose hold expired and was taken meanwhile is dropped
+    std::erase_if(selectedSeats, [&](const std::string& selected) {
+        return !bookingService->holdSeat(userID, showTimeID, selected);
+    });
+    
+    // Pick up holds and bookings of other customers since the map was loaded
+    currentSeats = bookingService->viewSeatsStatus(showTimeID);
+    seatMap.update(currentSeats, selectedSeats);
+    holdClock.restart();
+}
+
+void SFMLUIManager::releaseSelectedSeats() {
+    auto visitor = std::make_shared<BookingServiceVisitor>();
+    sessionManager->getCurrentContext()->accept(visitor);
+    auto bookingService = visitor->getBookingService();
+    
+    if (bookingService && selectedShowTimeIndex < currentShowTimes.size()) {
+        int userID = sessionManager->getCurrentAccount().userID;
+        int showTimeID = currentShowTimes[selectedShowTimeIndex].showTimeID;
+        for (const auto& seatId : selectedSeats) {
+            bookingService->releaseSeat(userID, showTimeID, seatId);
+        }
+    }
+    selectedSeats.clear();
+    statusMessage.clear();
+    seatMap.update(currentSeats, selectedSeats);
+}
+
 void SFMLUIManager::loadBookingHistory() {
     auto visitor = std::make_shared<BookingServiceVisitor>();
     sessionManager->getCurrentContext()->accept(visitor);
@@ -2127,9 +2214,9 @@ void SFMLUIManager::createBooking() {
             previousState = UIState::MAIN_MENU;
             
             // Create detailed success message
-            std::string movieTitle = (selectedMovieIndex < movies.size()) ? movies[selectedMovieIndex].title : "Movie";
-            std::string showTimeInfo = currentShowTimes[selectedShowTimeIndex].date + " " + 
-                                     currentShowTimes[selectedShowTimeIndex].startTime;
+            std::string movieTitle = movieDetails.isLoaded() ? movieDetails.getTitle() : "Movie";
+            std::string showTimeInfo = currentShowTimes[selectedShowTimeIndex].date() + " " + 
+                                     currentShowTimes[selectedShowTimeIndex].startTime();
             std::string seatsInfo = "";
             for (size_t i = 0; i < selectedSeats.size(); i++) {
                 if (i > 0) seatsInfo += ", ";
@@ -2143,6 +2230,11 @@ void SFMLUIManager::createBooking() {
             
             selectedSeats.clear(); // Moved here
             currentState = UIState::SUCCESS_MESSAGE;
+        } catch (const SeatUnavailableException& e) {
+            statusMessage = "Booking failed: " + std::string(e.what());
+            // Show who took the seats; our holds on the other seats are kept
+            currentSeats = bookingService->viewSeatsStatus(currentShowTimes[selectedShowTimeIndex].showTimeID);
+            seatMap.update(currentSeats, selectedSeats);
         } catch (const std::exception& e) {
             statusMessage = "Booking failed: " + std::string(e.what());
             // Stay in current state to show error
@@ -2151,6 +2243,12 @@ void SFMLUIManager::createBooking() {
 }
 
 void SFMLUIManager::logout() {
+    // Free seats this user was still choosing instead of waiting for the holds to expire
+    auto visitor = std::make_shared<BookingServiceVisitor>();
+    sessionManager->getCurrentContext()->accept(visitor);
+    if (auto bookingService = visitor->getBookingService()) {
+        bookingService->releaseHolds(sessionManager->getCurrentAccount().userID);
+    }
     sessionManager->logout();
     currentState = UIState::GUEST_SCREEN;
     inputUsername.clear();
@@ -2158,10 +2256,13 @@ void SFMLUIManager::logout() {
     inputEmail.clear();
     inputPhone.clear();
     statusMessage.clear();
-    movies.clear();
+    moviePages.clear();
+    movieSearchQuery.clear();
+    movieDetails.invalidate();
     currentShowTimes.clear();
     currentSeats.clear();
     selectedSeats.clear();
+    seatMap.clear();
     bookingHistory.clear();
 }
 
@@ -2185,6 +2286,7 @@ void SFMLUIManager::deleteMovie(int movieId) {
     if (movieManagerService) {
         try {
             movieManagerService->deleteMovie(movieId);
+            movieDetails.invalidate();
             showSuccessMessage("Movie deleted successfully!");
             loadMovies(); // Reload the movie list
         } catch (const std::exception& e) {
@@ -2228,6 +2330,7 @@ void SFMLUIManager::updateMovie(int movieId) {
             std::vector<std::string> emptyShowTimes;
             movieManagerService->addMovie(updatedMovie, emptyShowTimes);
             
+            movieDetails.invalidate();
             showSuccessMessage("Movie updated successfully!");
             clearEditingFields();
             loadMovies(); // Reload the movie list
@@ -2348,11 +2451,8 @@ void SFMLUIManager::renderShowtimeManagement() {
     
     // Movie info if managing specific movie
     if (managingMovieId >= 0) {
-        auto it = std::find_if(movies.begin(), movies.end(), 
-            [this](const MovieDTO& movie) { return movie.id == managingMovieId; });
-        
-        if (it != movies.end()) {
-            sf::Text movieInfo = createText("Managing showtimes for: " + it->title, 50, 100, 24);
+        if (!managingMovieTitle.empty()) {
+            sf::Text movieInfo = createText("Managing showtimes for: " + managingMovieTitle, 50, 100, 24);
             movieInfo.setFillColor(sf::Color(200, 200, 255));
             window.draw(movieInfo);
         }
@@ -2382,9 +2482,9 @@ void SFMLUIManager::renderShowtimeManagement() {
     
     // Display current showtimes
     for (size_t i = 0; i < currentShowTimes.size() && i < 8; ++i) {
-        std::string showtimeInfo = "Date: " + currentShowTimes[i].date + 
-                                  " | Time: " + currentShowTimes[i].startTime + 
-                                  " - " + currentShowTimes[i].endTime;
+        std::string showtimeInfo = "Date: " + currentShowTimes[i].date() + 
+                                  " | Time: " + currentShowTimes[i].startTime() + 
+                                  " - " + currentShowTimes[i].endTime();
         
         sf::Text showtimeText = createText(showtimeInfo, 50, 310 + i * 30, 14);
         showtimeText.setFillColor(sf::Color(200, 200, 200));
@@ -2420,6 +2520,7 @@ void SFMLUIManager::deleteShowtime(int movieId, int showtimeId) {
         try {
             // Call the deleteShowTime method
             movieManagerService->deleteShowTime(movieId, showtimeId);
+            movieDetails.invalidate();
             showSuccessMessage("Showtime deleted successfully!");
             
             // Reload showtimes for the current movie
@@ -13,6 +13,7 @@
 #include <SFML/Window.hpp>
 #include <SFML/System.hpp>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 #include "../SessionManager.h"
@@ -31,6 +32,10 @@
 #include "../repository/SeatView.h"
 #include "../model/ShowTime.h"
 #include "../model/Movie.h"
+#include "MovieDetailsViewModel.h"
+#include "MovieListPager.h"
+#include "SeatMapLayout.h"
+#include "TextCache.h"
 
 /**
  * @enum UIState
@@ -145,15 +150,19 @@ private:
     bool isInputtingPhone;
     
     // Navigation state
-    int selectedMovieIndex;
+    int selectedMovieId;    ///< Movie shown on the details screen, -1 if none
     int selectedShowTimeIndex;
     
     // Data storage
-    std::vector<MovieDTO> movies;
+    MovieListPager moviePages;  ///< Rows of both movie lists, loaded a page at a time
     std::vector<ShowTime> currentShowTimes;
     std::vector<SeatView> currentSeats;
     std::vector<std::string> selectedSeats;
     std::vector<BookingView> bookingHistory;
+
+    // Screen view-models: loaded on state changes, read by render methods
+    MovieDetailsViewModel movieDetails;
+    SeatMapLayout seatMap;  ///< Built by loadSeats(), recoloured when seats or the selection change
     
     // Admin management variables
     std::string editMovieTitle;
@@ -168,6 +177,7 @@ private:
     
     // Showtime management variables
     int managingMovieId;
+    std::string managingMovieTitle;
     std::string newShowtimeDate;
     std::string newShowtimeStartTime;
     std::string newShowtimeEndTime;
@@ -177,8 +187,21 @@ private:
     std::vector<std::string> pendingShowtimes;
     int movieListScrollOffset;
     int movieViewScrollOffset;
+    static constexpr int MOVIE_LIST_ROWS = 6;        ///< Movie cards on the customer list
+    static constexpr int MOVIE_MANAGEMENT_ROWS = 7;  ///< Movie rows on the admin list
+    std::string movieSearchQuery;                    ///< Search box of the movie list, empty = whole catalog
+    static constexpr std::size_t MOVIE_SEARCH_LIMIT = 100;
     bool isAddingShowtime;
 
+    // Render-on-demand state
+    bool renderOnDemand;    ///< Redraw only dirty screens instead of at a fixed 60 FPS
+    bool dirty;             ///< Screen changed since the last render()
+    sf::Clock holdClock;    ///< Time since our seat holds were last renewed
+
+    // Text layout cache, cleared whenever a different screen is rendered
+    TextCache textCache;
+    UIState renderedState;
+
     // Screen render methods
     void renderLoginScreen();
     void renderGuestScreen();
@@ -201,8 +224,15 @@ private:
     void handleKeyPress(sf::Keyboard::Key key);
     void handleMouseClick(sf::Vector2i mousePos);
     void handleEvents();
+    void handleEvent(const sf::Event& event);
     void update();
     void render();
+
+    // Render-on-demand helpers
+    void markDirty();
+    void waitForActivity();
+    std::optional<sf::Time> timeUntilNextTimer() const;
+    sf::Time holdTimeLeft() const;
     bool isButtonClicked(const sf::RectangleShape& button, sf::Vector2i mousePos);
 
     // UI utility methods
@@ -212,15 +242,20 @@ private:
     sf::RectangleShape createInputField(float x, float y, float width, float height, bool isActive);
     void drawGradientBackground();
     void drawMovieCard(const MovieDTO& movie, float x, float y, bool isSelected);
+    void scrollMovieList(int& scrollOffset, int delta, int visibleRows);
+    std::string movieCountLabel(int scrollOffset, int visibleRows) const;
     void showSuccessMessage(const std::string& message);
 
     // Service interaction methods
     void attemptLogin();
     void attemptRegister();
     void loadMovies();
+    void applyMovieSearch();
     void loadMovieDetails(int movieId);
     void loadShowTimes(int movieId);
     void loadSeats(int showTimeId);
+    void toggleSeat(const std::string& seatId);
+    void releaseSelectedSeats();
     void loadBookingHistory();
     void createBooking();
     void logout();
@@ -247,7 +282,24 @@ public:
     ~SFMLUIManager();
     
     bool initialize();
+
+    /**
+     * @brief Main loop: handle input, update state, draw the current screen
+     *
+     * In render-on-demand mode (the default) the loop blocks in
+     * sf::Window::waitEvent() and draws a frame only when the screen is
+     * dirty: after input, after data was (re)loaded or when a timer such as
+     * the seat-hold countdown ticks. An idle kiosk then uses no CPU or GPU.
+     */
     void run();
+
+    /**
+     * @brief Switch between render-on-demand and redrawing every frame
+     *
+     * @param enabled false restores the fixed 60 FPS loop, e.g. for screens
+     *                with continuous animation
+     */
+    void setRenderOnDemand(bool enabled);
     void shutdown();
 };
 
@@ -0,0 +1,272 @@
+#include "SeatMapLayout.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+
+namespace {
+    // Vertices of one seat: outline quad, fill quad, couple marker fan
+    constexpr float OUTLINE_THICKNESS = 2.0f;
+    constexpr std::size_t QUAD_VERTICES = 6;
+    constexpr std::size_t MARKER_SEGMENTS = 8;
+    constexpr std::size_t SEAT_VERTICES = 2 * QUAD_VERTICES + 3 * MARKER_SEGMENTS;
+
+    // Row badge: outline circle, fill circle
+    constexpr std::size_t BADGE_SEGMENTS = 12;
+
+    constexpr unsigned int SEAT_LABEL_SIZE = 12;
+    constexpr unsigned int ROW_LABEL_SIZE = 16;
+
+    const sf::Color SEAT_OUTLINE_COLOR = sf::Color::White;
+    const sf::Color BOOKED_COLOR = sf::Color::Red;
+    const sf::Color SELECTED_COLOR = sf::Color::Green;
+    const sf::Color HELD_COLOR = sf::Color(255, 165, 0);      // Another customer is choosing this seat
+    const sf::Color COUPLE_COLOR = sf::Color(100, 100, 255);  // Blue-purple for Couple
+    const sf::Color SINGLE_COLOR = sf::Color(0, 150, 255);    // Sky blue for Single
+    const sf::Color MARKER_COLOR = sf::Color(255, 150, 150);
+
+    void setQuad(sf::Vertex* quad, sf::FloatRect rect, sf::Color color) {
+        sf::Vector2f topLeft(rect.left, rect.top);
+        sf::Vector2f topRight(rect.left + rect.width, rect.top);
+        sf::Vector2f bottomLeft(rect.left, rect.top + rect.height);
+        sf::Vector2f bottomRight(rect.left + rect.width, rect.top + rect.height);
+        quad[0] = sf::Vertex(topLeft, color);
+        quad[1] = sf::Vertex(topRight, color);
+        quad[2] = sf::Vertex(bottomLeft, color);
+        quad[3] = sf::Vertex(bottomLeft, color);
+        quad[4] = sf::Vertex(topRight, color);
+        quad[5] = sf::Vertex(bottomRight, color);
+    }
+
+    void setFan(sf::Vertex* fan, sf::Vector2f center, float radius, std::size_t segments, sf::Color color) {
+        const float step = 2.0f * 3.14159265f / static_cast<float>(segments);
+        for (std::size_t i = 0; i < segments; ++i) {
+            float a0 = step * static_cast<float>(i);
+            float a1 = step * static_cast<float>(i + 1);
+            fan[3 * i] = sf::Vertex(center, color);
+            fan[3 * i + 1] = sf::Vertex(center + radius * sf::Vector2f(std::cos(a0), std::sin(a0)), color);
+            fan[3 * i + 2] = sf::Vertex(center + radius * sf::Vector2f(std::cos(a1), std::sin(a1)), color);
+        }
+    }
+
+    void setColor(sf::Vertex* vertices, std::size_t count, sf::Color color) {
+        for (std::size_t i = 0; i < count; ++i) {
+            vertices[i].color = color;
+        }
+    }
+}
+
+SeatMapLayout::SeatMapLayout(sf::Vector2f origin, float seatSize, float seatSpacing)
+    : origin(origin), seatSize(seatSize), seatSpacing(seatSpacing), rows(0), columns(0), font(nullptr),
+      shapes(sf::Triangles) {
+}
+
+void SeatMapLayout::build(const std::vector<SeatView>& seats, const sf::Font& labelFont) {
+    clear();
+    font = &labelFont;
+
+    // Arrange seats by row (first letter), keeping the seat order within a row
+    std::map<char, std::vector<const ISeat*>> seatsByRow;
+    for (const auto& view : seats) {
+        std::string id = view.seat->id();
+        seatsByRow[id.empty() ? '?' : id[0]].push_back(view.seat);
+    }
+
+    for (const auto& [rowName, rowSeats] : seatsByRow) {
+        for (std::size_t i = 0; i < rowSeats.size(); ++i) {
+            std::string id = rowSeats[i]->id();
+
+            // Column from the number after the row letter ('1' in 'A1'), 0-based
+            int number = 0;
+            auto [end, error] = std::from_chars(id.data() + std::min<std::size_t>(1, id.size()), id.data() + id.size(), number);
+            int column = (error == std::errc() && number >= 1) ? number - 1 : static_cast<int>(i);
+
+            sf::Vector2f position(origin.x + column * seatSpacing, origin.y + rows * seatSpacing);
+            indexById[id] = cells.size();
+            cells.push_back(Cell{id, rowSeats[i]->type(), SeatStatus::AVAILABLE, rows, column, position});
+            columns = std::max(columns, column + 1);
+        }
+        ++rows;
+    }
+    selected.assign(cells.size(), false);
+
+    // Grid for hit testing
+    grid.assign(static_cast<std::size_t>(rows) * columns, -1);
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        grid[static_cast<std::size_t>(cells[i].row) * columns + cells[i].column] = static_cast<int>(i);
+    }
+
+    // Seat geometry, coloured by recolor()
+    shapes.resize(cells.size() * SEAT_VERTICES + rows * 6 * BADGE_SEGMENTS);
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        const Cell& cell = cells[i];
+        sf::Vertex* vertices = &shapes[i * SEAT_VERTICES];
+        setQuad(vertices, sf::FloatRect(cell.position.x - OUTLINE_THICKNESS, cell.position.y - OUTLINE_THICKNESS,
+                                        seatSize + 2 * OUTLINE_THICKNESS, seatSize + 2 * OUTLINE_THICKNESS),
+                SEAT_OUTLINE_COLOR);
+        setQuad(vertices + QUAD_VERTICES, sf::FloatRect(cell.position.x, cell.position.y, seatSize, seatSize),
+                SINGLE_COLOR);
+        setFan(vertices + 2 * QUAD_VERTICES, cell.position + sf::Vector2f(seatSize - 7, 10), 5, MARKER_SEGMENTS,
+               sf::Color::Transparent);
+        recolor(i);
+
+        appendLabel(cell.id, cell.position + sf::Vector2f(5, 10), SEAT_LABEL_SIZE, sf::Color::White);
+    }
+
+    // Row names on the left, on a round badge
+    int rowIndex = 0;
+    for (const auto& rowPair : seatsByRow) {
+        float rowY = origin.y + rowIndex * seatSpacing;
+        sf::Vertex* badge = &shapes[cells.size() * SEAT_VERTICES + rowIndex * 6 * BADGE_SEGMENTS];
+        sf::Vector2f center(origin.x - 23, rowY + 19);
+        setFan(badge, center, 13, BADGE_SEGMENTS, sf::Color(150, 150, 150));
+        setFan(badge + 3 * BADGE_SEGMENTS, center, 12, BADGE_SEGMENTS, sf::Color(60, 60, 60));
+
+        appendLabel(std::string(1, rowPair.first), sf::Vector2f(origin.x - 30, rowY + 10), ROW_LABEL_SIZE,
+                    sf::Color(220, 220, 0)); // Yellow
+        ++rowIndex;
+    }
+}
+
+void SeatMapLayout::update(const std::vector<SeatView>& seats, const std::vector<std::string>& selectedSeatIds) {
+    for (const auto& view : seats) {
+        auto it = indexById.find(view.seat->id());
+        if (it != indexById.end()) {
+            cells[it->second].status = view.status;
+        }
+    }
+
+    std::fill(selected.begin(), selected.end(), false);
+    for (const auto& id : selectedSeatIds) {
+        auto it = indexById.find(id);
+        if (it != indexById.end()) {
+            selected[it->second] = true;
+        }
+    }
+
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        recolor(i);
+    }
+}
+
+void SeatMapLayout::clear() {
+    cells.clear();
+    selected.clear();
+    indexById.clear();
+    grid.clear();
+    rows = 0;
+    columns = 0;
+    shapes.clear();
+    labels.clear();
+}
+
+int SeatMapLayout::seatAt(sf::Vector2i position) const {
+    // Each seat's clickable area includes its outline
+    float x = position.x - (origin.x - OUTLINE_THICKNESS);
+    float y = position.y - (origin.y - OUTLINE_THICKNESS);
+    if (x < 0 || y < 0) {
+        return -1;
+    }
+
+    int column = static_cast<int>(x / seatSpacing);
+    int row = static_cast<int>(y / seatSpacing);
+    if (column >= columns || row >= rows) {
+        return -1;
+    }
+    float extent = seatSize + 2 * OUTLINE_THICKNESS;
+    if (x - column * seatSpacing > extent || y - row * seatSpacing > extent) {
+        return -1; // In the gap between seats
+    }
+    return grid[static_cast<std::size_t>(row) * columns + column];
+}
+
+const std::string& SeatMapLayout::seatId(int index) const {
+    return cells.at(index).id;
+}
+
+SeatStatus SeatMapLayout::status(int index) const {
+    return cells.at(index).status;
+}
+
+bool SeatMapLayout::isSelected(int index) const {
+    return selected.at(index);
+}
+
+std::size_t SeatMapLayout::seatCount() const {
+    return cells.size();
+}
+
+int SeatMapLayout::rowCount() const {
+    return rows;
+}
+
+int SeatMapLayout::columnCount() const {
+    return columns;
+}
+
+void SeatMapLayout::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    if (cells.empty()) {
+        return;
+    }
+    target.draw(shapes, states);
+    for (const auto& [characterSize, vertices] : labels) {
+        states.texture = &font->getTexture(characterSize);
+        target.draw(vertices, states);
+    }
+}
+
+void SeatMapLayout::recolor(std::size_t index) {
+    const Cell& cell = cells[index];
+    sf::Color fill;
+    bool marker = false;
+    if (cell.status == SeatStatus::BOOKED) {
+        fill = BOOKED_COLOR;
+    } else if (selected[index]) {
+        fill = SELECTED_COLOR;
+    } else if (cell.status == SeatStatus::HELD) {
+        fill = HELD_COLOR;
+    } else if (cell.type == SeatType::COUPLE) {
+        fill = COUPLE_COLOR;
+        marker = true;
+    } else {
+        fill = SINGLE_COLOR;
+    }
+
+    sf::Vertex* vertices = &shapes[index * SEAT_VERTICES];
+    setColor(vertices + QUAD_VERTICES, QUAD_VERTICES, fill);
+    setColor(vertices + 2 * QUAD_VERTICES, 3 * MARKER_SEGMENTS, marker ? MARKER_COLOR : sf::Color::Transparent);
+}
+
+void SeatMapLayout::appendLabel(const std::string& text, sf::Vector2f position, unsigned int characterSize, sf::Color color) {
+    sf::VertexArray& vertices = labels.try_emplace(characterSize, sf::Triangles).first->second;
+
+    // Same placement as sf::Text: baseline one character size below the position
+    const float padding = 1.0f;
+    float x = 0;
+    float y = static_cast<float>(characterSize);
+    sf::Uint32 previous = 0;
+    for (unsigned char c : text) {
+        sf::Uint32 current = c;
+        x += font->getKerning(previous, current, characterSize);
+        previous = current;
+
+        const sf::Glyph& glyph = font->getGlyph(current, characterSize, false);
+        float left = position.x + x + glyph.bounds.left - padding;
+        float top = position.y + y + glyph.bounds.top - padding;
+        float right = position.x + x + glyph.bounds.left + glyph.bounds.width + padding;
+        float bottom = position.y + y + glyph.bounds.top + glyph.bounds.height + padding;
+
+        float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+        float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+        float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+        float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+        vertices.append(sf::Vertex(sf::Vector2f(left, top), color, sf::Vector2f(u1, v1)));
+        vertices.append(sf::Vertex(sf::Vector2f(right, top), color, sf::Vector2f(u2, v1)));
+        vertices.append(sf::Vertex(sf::Vector2f(left, bottom), color, sf::Vector2f(u1, v2)));
+        vertices.append(sf::Vertex(sf::Vector2f(left, bottom), color, sf::Vector2f(u1, v2)));
+        vertices.append(sf::Vertex(sf::Vector2f(right, top), color, sf::Vector2f(u2, v1)));
+        vertices.append(sf::Vertex(sf::Vector2f(right, bottom), color, sf::Vector2f(u2, v2)));
+
+        x += glyph.advance;
+    }
+}
@@ -0,0 +1,140 @@
+/**
+ * @file SeatMapLayout.h
+ * @brief Cached, batched geometry of the seat map on the seat selection screen
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef SEAT_MAP_LAYOUT_H
+#define SEAT_MAP_LAYOUT_H
+
+#include <SFML/Graphics.hpp>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../repository/SeatView.h"
+
+/**
+ * @class SeatMapLayout
+ * @brief Seat positions and vertices, computed once per seat map load
+ *
+ * Drawing the seat map one sf::RectangleShape, sf::CircleShape and sf::Text
+ * per seat costs thousands of draw calls for a large auditorium, and
+ * grouping the seats by row, parsing seat numbers and searching the
+ * selection every frame adds to that. This class does all of it once, when
+ * the seat map is loaded:
+ *
+ * - build() places every seat (row = first letter of the seat ID in
+ *   alphabetical order, column = the number after it) and writes the seat
+ *   squares, couple markers and row badges into one sf::VertexArray and the
+ *   seat and row labels into one glyph-textured sf::VertexArray per text size
+ * - update() only rewrites vertex colours after a seat status or the
+ *   customer's selection changed; the selection is kept as a bitset
+ * - seatAt() finds the seat under the mouse from the grid, without
+ *   walking the seats
+ *
+ * Drawing the map is then three draw calls (shapes, seat labels, row
+ * labels) however many seats the auditorium has.
+ *
+ * @par Usage Example
+ * @code
+ * // When the seat map is loaded
+ * seatMap.build(currentSeats, font);
+ * seatMap.update(currentSeats, selectedSeats);
+ *
+ * // Every frame
+ * window.draw(seatMap);
+ *
+ * // On click
+ * int index = seatMap.seatAt(mousePos);
+ * if (index >= 0 && (seatMap.status(index) == SeatStatus::AVAILABLE || seatMap.isSelected(index))) {
+ *     toggleSeat(seatMap.seatId(index));
+ * }
+ * @endcode
+ *
+ * @warning Keeps a pointer to the font given to build(): the font must
+ *          outlive the layout (or the next build())
+ *
+ * @see SFMLUIManager::renderSeatSelection
+ */
+class SeatMapLayout : public sf::Drawable {
+public:
+    /**
+     * @param origin Top-left corner of seat A1
+     * @param seatSize Side of a seat square
+     * @param seatSpacing Distance between neighbouring seats
+     */
+    explicit SeatMapLayout(sf::Vector2f origin = sf::Vector2f(200, 200), float seatSize = 40, float seatSpacing = 45);
+
+    /**
+     * @brief Compute positions and vertices for a seat map
+     *
+     * @param seats Seats of the showtime (statuses are applied by update())
+     * @param font Font of the seat and row labels
+     */
+    void build(const std::vector<SeatView>& seats, const sf::Font& font);
+
+    /**
+     * @brief Recolour the seats after their statuses or the selection changed
+     *
+     * Seats not in the built layout are ignored.
+     *
+     * @param seats Current seat statuses
+     * @param selectedSeatIds Seats the customer has selected
+     */
+    void update(const std::vector<SeatView>& seats, const std::vector<std::string>& selectedSeatIds);
+
+    /**
+     * @brief Forget the layout (e.g. on logout)
+     */
+    void clear();
+
+    /**
+     * @brief Index of the seat under a window position
+     *
+     * @return int Seat index, or -1 if the position is not on a seat
+     */
+    int seatAt(sf::Vector2i position) const;
+
+    const std::string& seatId(int index) const;
+    SeatStatus status(int index) const;
+    bool isSelected(int index) const;
+
+    std::size_t seatCount() const;
+    int rowCount() const;
+    int columnCount() const;
+
+private:
+    struct Cell {
+        std::string id;
+        SeatType type;
+        SeatStatus status;
+        int row;
+        int column;
+        sf::Vector2f position;
+    };
+
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+    void recolor(std::size_t index);
+    void appendLabel(const std::string& text, sf::Vector2f position, unsigned int characterSize, sf::Color color);
+
+    sf::Vector2f origin;
+    float seatSize;
+    float seatSpacing;
+
+    std::vector<Cell> cells;
+    std::vector<bool> selected;                          ///< Bitset over cells
+    std::unordered_map<std::string, std::size_t> indexById;
+    std::vector<int> grid;                               ///< rows x columns -> cell index or -1
+    int rows;
+    int columns;
+
+    const sf::Font* font;
+    sf::VertexArray shapes;                              ///< Triangles, untextured
+    std::map<unsigned int, sf::VertexArray> labels;      ///< Triangles per text size, textured by the font
+};
+
+#endif // SEAT_MAP_LAYOUT_H
@@ -0,0 +1,46 @@
+#include "TextCache.h"
+
+TextCache::TextCache(std::size_t maxEntries)
+    : maxEntries(maxEntries) {
+}
+
+const sf::Text& TextCache::get(const std::string& content, const sf::Font& font, unsigned int characterSize) {
+    KeyView key{content, &font, characterSize};
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        return it->second;
+    }
+
+    if (entries.size() >= maxEntries) {
+        entries.clear();
+    }
+
+    sf::Text text;
+    text.setFont(font);
+    text.setString(content);
+    text.setCharacterSize(characterSize);
+    text.setFillColor(sf::Color::White);
+    // Asking for the bounds lays the glyphs out now, once, instead of at the first draw of every copy
+    text.getLocalBounds();
+
+    return entries.emplace(Key{content, &font, characterSize}, std::move(text)).first->second;
+}
+
+void TextCache::clear() {
+    entries.clear();
+}
+
+std::size_t TextCache::size() const {
+    return entries.size();
+}
+
+std::size_t TextCache::KeyHash::operator()(const KeyView& key) const {
+    std::size_t hash = std::hash<std::string_view>{}(key.content);
+    hash ^= std::hash<const void*>{}(key.font) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<unsigned int>{}(key.characterSize) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+std::size_t TextCache::KeyHash::operator()(const Key& key) const {
+    return (*this)(KeyView{key.content, key.font, key.characterSize});
+}
@@ -0,0 +1,109 @@
+/**
+ * @file TextCache.h
+ * @brief Cache of laid-out sf::Text objects for the SFML user interface
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef TEXT_CACHE_H
+#define TEXT_CACHE_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @class TextCache
+ * @brief Keeps sf::Text objects whose glyph geometry is already computed
+ *
+ * Laying out an sf::Text (glyph lookups, kerning, one quad per character)
+ * is the expensive part of drawing a label, and the UI used to redo it for
+ * every label in every frame although titles, seat labels and button
+ * captions hardly ever change. This cache lays out each (string, font,
+ * character size) once; copies of the cached text keep the finished
+ * geometry, so moving or recolouring the copy does not lay it out again.
+ *
+ * @details
+ * - Entries belong to the screen they were created on: the UI clears the
+ *   cache when it switches screens
+ * - The cache is also cleared when it reaches its entry limit, which bounds
+ *   the memory used by text that changes while a screen is shown (e.g. an
+ *   input field being typed into)
+ * - Lookups do not allocate: the key is compared as a std::string_view
+ *
+ * @par Usage Example
+ * @code
+ * sf::Text title = textCache.get("Select Seats", font, 35);  // laid out once
+ * title.setPosition(550, 50);
+ * window.draw(title);
+ * @endcode
+ *
+ * @warning Entries keep a pointer to their font, which must outlive them
+ *
+ * @see SFMLUIManager::createText
+ */
+class TextCache {
+public:
+    /**
+     * @param maxEntries Entry limit before the cache starts over
+     */
+    explicit TextCache(std::size_t maxEntries = 1024);
+
+    /**
+     * @brief Laid-out white text at position (0, 0)
+     *
+     * @param content Text to display
+     * @param font Font of the text
+     * @param characterSize Character size in pixels
+     * @return const sf::Text& Cached text, valid until the next clear()
+     */
+    const sf::Text& get(const std::string& content, const sf::Font& font, unsigned int characterSize);
+
+    /**
+     * @brief Drop every entry (e.g. when the screen that used them is left)
+     */
+    void clear();
+
+    std::size_t size() const;
+
+private:
+    struct KeyView {
+        std::string_view content;
+        const sf::Font* font;
+        unsigned int characterSize;
+    };
+
+    struct Key {
+        std::string content;
+        const sf::Font* font;
+        unsigned int characterSize;
+    };
+
+    struct KeyHash {
+        using is_transparent = void;
+        std::size_t operator()(const KeyView& key) const;
+        std::size_t operator()(const Key& key) const;
+    };
+
+    struct KeyEqual {
+        using is_transparent = void;
+        static KeyView view(const Key& key) { return KeyView{key.content, key.font, key.characterSize}; }
+        static KeyView view(const KeyView& key) { return key; }
+
+        template <typename A, typename B>
+        bool operator()(const A& a, const B& b) const {
+            KeyView x = view(a);
+            KeyView y = view(b);
+            return x.characterSize == y.characterSize && x.font == y.font && x.content == y.content;
+        }
+    };
+
+    std::size_t maxEntries;
+    std::unordered_map<Key, sf::Text, KeyHash, KeyEqual> entries;
+};
+
+#endif // TEXT_CACHE_H
@@ -0,0 +1,391 @@
+/**
+ * @file TicketRushBenchmark.cpp
+ * @brief Ticket-rush load generator for BookingService and MovieViewerService
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ *
+ * Simulates N buyers hammering the services registered by ServiceBootstrap,
+ * the same way the UI and BookingServer use them. Every buyer is a thread
+ * that repeats one of two operations:
+ *
+ * - Browse (read): list movies, list a movie's showtimes or load a seat map
+ * - Book (write): load a seat map, pick free seats, hold them, createBooking()
+ *
+ * Bookings go to one of a few "hot" showtimes with probability --contention,
+ * otherwise to a random cold showtime, so buyers race for the same seats.
+ * A booking that loses the race (hold refused or SeatUnavailableException)
+ * is a conflict; a showtime without free seats left is counted as sold out.
+ *
+ * The report lists throughput and p50/p99/p999 latency per operation, the
+ * conflict rate and the catalog cache hit rate, so changes to the repository
+ * layer can be compared on the same workload. Runs are reproducible for a
+ * given --seed, up to thread scheduling.
+ *
+ * @par Usage Example
+ * @code
+ * TicketRushBenchmark --buyers 16 --ops 2000 --read-ratio 0.8 --contention 0.5
+ * @endcode
+ */
+
+#include "../core/ServiceBootstrap.h"
+#include "../core/ServiceRegistry.h"
+#include "../database/Transaction.h"
+#include "../service/IBookingService.h"
+#include "../service/IMovieViewerService.h"
+#include "../repository/SeatUnavailableException.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Workload parameters, all settable from the command line
+ */
+struct Scenario {
+    std::string dbFilePath = "bench.db";
+    std::string schemaFilePath = "./database/database.sql";
+    int buyers = 8;                 ///< Concurrent buyer threads
+    int opsPerBuyer = 1000;         ///< Operations each buyer performs
+    int showTimes = 200;            ///< Showtimes created for the run
+    int hotShowTimes = 4;           ///< Showtimes most buyers fight over
+    double readRatio = 0.8;         ///< Share of operations that only browse
+    double contention = 0.5;        ///< Share of bookings aimed at a hot showtime
+    int seatsPerBooking = 2;        ///< Seats requested by one booking
+    bool useHolds = true;           ///< Hold seats before booking, like the UI
+    bool keepDatabase = false;      ///< Run on an existing (e.g. generated) database
+    std::size_t readers = ConnectionPool::defaultReaderCount();
+    std::uint32_t seed = 42;
+};
+
+/**
+ * @brief Per-thread results, merged after the run
+ */
+struct Samples {
+    std::vector<std::int64_t> browseNs;
+    std::vector<std::int64_t> bookNs;
+    std::uint64_t booked = 0;
+    std::uint64_t conflicts = 0;
+    std::uint64_t soldOut = 0;
+    std::uint64_t errors = 0;
+};
+
+void printUsage() {
+    std::cout <<
+        "Usage: TicketRushBenchmark [options]\n"
+        "  --db PATH             Database file, recreated for the run (bench.db)\n"
+        "  --keep-db             Use the existing database, e.g. from DatasetGenerator\n"
+        "  --schema PATH         Schema script (./database/database.sql)\n"
+        "  --buyers N            Concurrent buyers (8)\n"
+        "  --ops N               Operations per buyer (1000)\n"
+        "  --showtimes N         Showtimes to create (200)\n"
+        "  --hot N               Hot showtimes (4)\n"
+        "  --read-ratio R        Share of browse operations, 0..1 (0.8)\n"
+        "  --contention R        Share of bookings on hot showtimes, 0..1 (0.5)\n"
+        "  --seats N             Seats per booking (2)\n"
+        "  --readers N           Reader connections in the pool\n"
+        "  --no-holds            Book without holding seats first\n"
+        "  --seed N              Random seed (42)\n";
+}
+
+Scenario parseArguments(int argc, char** argv) {
+    Scenario scenario;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value for " + arg);
+            }
+            return argv[++i];
+        };
+
+        if (arg == "--db") scenario.dbFilePath = value();
+        else if (arg == "--schema") scenario.schemaFilePath = value();
+        else if (arg == "--buyers") scenario.buyers = std::stoi(value());
+        else if (arg == "--ops") scenario.opsPerBuyer = std::stoi(value());
+        else if (arg == "--showtimes") scenario.showTimes = std::stoi(value());
+        else if (arg == "--hot") scenario.hotShowTimes = std::stoi(value());
+        else if (arg == "--read-ratio") scenario.readRatio = std::stod(value());
+        else if (arg == "--contention") scenario.contention = std::stod(value());
+        else if (arg == "--seats") scenario.seatsPerBooking = std::stoi(value());
+        else if (arg == "--readers") scenario.readers = static_cast<std::size_t>(std::stoul(value()));
+        else if (arg == "--no-holds") scenario.useHolds = false;
+        else if (arg == "--keep-db") scenario.keepDatabase = true;
+        else if (arg == "--seed") scenario.seed = static_cast<std::uint32_t>(std::stoul(value()));
+        else if (arg == "--help" || arg == "-h") { printUsage(); std::exit(0); }
+        else throw std::invalid_argument("Unknown option " + arg);
+    }
+
+    if (scenario.buyers < 1 || scenario.opsPerBuyer < 1 || scenario.seatsPerBooking < 1) {
+        throw std::invalid_argument("--buyers, --ops and --seats must be positive");
+    }
+    if (scenario.hotShowTimes < 1 || scenario.showTimes <= scenario.hotShowTimes) {
+        throw std::invalid_argument("Need at least one hot showtime and more showtimes than hot ones");
+    }
+    if (scenario.readRatio < 0.0 || scenario.readRatio > 1.0 || scenario.contention < 0.0 || scenario.contention > 1.0) {
+        throw std::invalid_argument("--read-ratio and --contention must be between 0 and 1");
+    }
+    return scenario;
+}
+
+/**
+ * @brief Run an INSERT ... RETURNING statement and return the new row ID
+ */
+int insertReturningID(DatabaseConnection* db, const std::string& sql, const std::vector<std::string>& params) {
+    int id = 0;
+    // Iterating to the end steps the statement to SQLITE_DONE
+    for (const ResultRow& row : db->query(sql, params)) {
+        id = row.getInt(0);
+    }
+    if (id == 0) {
+        throw std::runtime_error("Insert failed: " + sql);
+    }
+    return id;
+}
+
+/**
+ * @brief Create the buyers' accounts and the showtimes of the run
+ *
+ * @return std::vector<int> Showtime IDs; the first hotShowTimes are the hot ones
+ */
+std::vector<int> seed(ConnectionPool& pool, const Scenario& scenario, std::vector<int>& buyerIDs) {
+    auto db = pool.writer();
+    Transaction transaction(db.get(), Transaction::Mode::IMMEDIATE);
+
+    for (int i = 0; i < scenario.buyers; ++i) {
+        std::string name = "buyer" + std::to_string(i);
+        buyerIDs.push_back(insertReturningID(db.get(),
+            // Upsert so a kept database reuses the buyers of earlier runs
+            "INSERT INTO ACCOUNT (Password, RoleUser, Gmail, PhoneNumber, UserName) VALUES (?, 'User', ?, '0000000000', ?) "
+            "ON CONFLICT(UserName) DO UPDATE SET Password = excluded.Password RETURNING UserID;",
+            {"bench", name + "@bench.local", name}));
+    }
+
+    std::vector<int> movieIDs;
+    for (const ResultRow& row : db->query("SELECT MovieID FROM MOVIE;")) {
+        movieIDs.push_back(row.getInt(0));
+    }
+    if (movieIDs.empty()) {
+        throw std::runtime_error("The schema script created no movies");
+    }
+
+    // Every run screens in auditoriums of its own, so neither the sample showtimes nor those
+    // of earlier runs on a kept database overlap the new ones
+    int firstAuditorium = 1;
+    for (const ResultRow& row : db->query("SELECT IFNULL(MAX(AuditoriumID), 0) + 1 FROM SHOWTIME;")) {
+        firstAuditorium = row.getInt(0);
+    }
+
+    std::vector<int> showTimeIDs;
+    for (int i = 0; i < scenario.showTimes; ++i) {
+        int movieID = movieIDs[static_cast<std::size_t>(i) % movieIDs.size()];
+        std::string day = std::to_string(10 + i % 20);
+        // All shows are 18:00-20:00 on one of 20 days: a day's n-th show gets the n-th auditorium
+        std::string auditorium = std::to_string(firstAuditorium + i / 20);
+        showTimeIDs.push_back(insertReturningID(db.get(),
+            "INSERT INTO SHOWTIME (MovieID, AuditoriumID, StartsAt, EndsAt) "
+            "VALUES (?1, ?3, unixepoch(?2 || ' 18:00'), unixepoch(?2 || ' 20:00')) RETURNING ShowTimeID;",
+            {std::to_string(movieID), "2025-06-" + day, auditorium}));
+    }
+
+    transaction.commit();
+    return showTimeIDs;
+}
+
+/**
+ * @brief Book seatsPerBooking free seats of one showtime the way a customer would
+ *
+ * @return bool False if the showtime was sold out and no booking was attempted
+ */
+bool book(IBookingService& bookingService, int userID, int showTimeID, const Scenario& scenario,
+          std::mt19937& rng, Samples& samples) {
+    std::vector<std::string> free;
+    for (const SeatView& view : bookingService.viewSeatsStatus(showTimeID)) {
+        if (view.status == SeatStatus::AVAILABLE) {
+            free.push_back(view.seat->id());
+        }
+    }
+    if (free.size() < static_cast<std::size_t>(scenario.seatsPerBooking)) {
+        ++samples.soldOut;
+        return false;
+    }
+
+    std::shuffle(free.begin(), free.end(), rng);
+    free.resize(static_cast<std::size_t>(scenario.seatsPerBooking));
+
+    if (scenario.useHolds) {
+        for (const auto& seatID : free) {
+            if (!bookingService.holdSeat(userID, showTimeID, seatID)) {
+                // Someone else is choosing the same seat: give up like a customer who picks again
+                bookingService.releaseHolds(userID);
+                ++samples.conflicts;
+                return true;
+            }
+        }
+    }
+
+    try {
+        bookingService.createBooking(userID, showTimeID, free);
+        ++samples.booked;
+    } catch (const SeatUnavailableException&) {
+        if (scenario.useHolds) {
+            bookingService.releaseHolds(userID);
+        }
+        ++samples.conflicts;
+    }
+    return true;
+}
+
+void runBuyer(int buyer, int userID, const Scenario& scenario, const std::vector<int>& showTimeIDs,
+              const std::vector<int>& movieIDs, Samples& samples) {
+    auto bookingService = ServiceRegistry::getSingleton<IBookingService>();
+    auto movieService = ServiceRegistry::getSingleton<IMovieViewerService>();
+
+    std::mt19937 rng(scenario.seed + static_cast<std::uint32_t>(buyer));
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+    std::uniform_int_distribution<std::size_t> hotPick(0, static_cast<std::size_t>(scenario.hotShowTimes) - 1);
+    std::uniform_int_distribution<std::size_t> coldPick(static_cast<std::size_t>(scenario.hotShowTimes), showTimeIDs.size() - 1);
+    std::uniform_int_distribution<std::size_t> anyShowTime(0, showTimeIDs.size() - 1);
+    std::uniform_int_distribution<std::size_t> anyMovie(0, movieIDs.size() - 1);
+    std::uniform_int_distribution<int> browseKind(0, 2);
+
+    samples.browseNs.reserve(static_cast<std::size_t>(scenario.opsPerBuyer));
+    samples.bookNs.reserve(static_cast<std::size_t>(scenario.opsPerBuyer));
+
+    for (int op = 0; op < scenario.opsPerBuyer; ++op) {
+        bool browse = chance(rng) < scenario.readRatio;
+        bool timed = true;
+        auto start = Clock::now();
+        try {
+            if (browse) {
+                switch (browseKind(rng)) {
+                case 0: movieService->showAllMovies(); break;
+                case 1: movieService->showMovieShowTimes(movieIDs[anyMovie(rng)]); break;
+                default: bookingService->viewSeatsStatus(showTimeIDs[anyShowTime(rng)]); break;
+                }
+            } else {
+                int showTimeID = chance(rng) < scenario.contention ? showTimeIDs[hotPick(rng)] : showTimeIDs[coldPick(rng)];
+                // Sold-out checks are cheap and would flatter the booking latency
+                timed = book(*bookingService, userID, showTimeID, scenario, rng, samples);
+            }
+        } catch (const std::exception& e) {
+            if (samples.errors++ == 0) {
+                std::cerr << "[Bench] buyer " << buyer << ": " << e.what() << "\n";
+            }
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+        if (timed) {
+            (browse ? samples.browseNs : samples.bookNs).push_back(elapsed);
+        }
+    }
+}
+
+/**
+ * @brief Nearest-rank percentile of sorted samples, in microseconds
+ */
+double percentileUs(const std::vector<std::int64_t>& sorted, double p) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    std::size_t rank = static_cast<std::size_t>(p * static_cast<double>(sorted.size()) + 0.999999);
+    std::size_t index = std::clamp<std::size_t>(rank, 1, sorted.size()) - 1;
+    return static_cast<double>(sorted[index]) / 1000.0;
+}
+
+void printLatency(const char* name, std::vector<std::int64_t>& samples, double seconds) {
+    std::sort(samples.begin(), samples.end());
+    std::printf("%-8s %10zu ops %12.1f ops/s   p50 %9.1f us   p99 %9.1f us   p999 %9.1f us\n",
+                name, samples.size(), static_cast<double>(samples.size()) / seconds,
+                percentileUs(samples, 0.50), percentileUs(samples, 0.99), percentileUs(samples, 0.999));
+}
+
+}
+
+int main(int argc, char** argv) {
+    Scenario scenario;
+    try {
+        scenario = parseArguments(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << "[Bench] " << e.what() << "\n";
+        printUsage();
+        return 1;
+    }
+
+    // Every run starts from the schema script so results are comparable,
+    // unless it is meant to measure a large generated dataset
+    if (!scenario.keepDatabase) {
+        std::remove(scenario.dbFilePath.c_str());
+        std::remove((scenario.dbFilePath + "-wal").c_str());
+        std::remove((scenario.dbFilePath + "-shm").c_str());
+    }
+
+    ServiceBootstrap::Services services;
+    std::vector<int> buyerIDs;
+    std::vector<int> showTimeIDs;
+    std::vector<int> movieIDs;
+    try {
+        services = ServiceBootstrap::initialize(scenario.dbFilePath, scenario.schemaFilePath,
+                                                ConnectionProfile::server(), scenario.readers);
+        showTimeIDs = seed(*services.connectionPool, scenario, buyerIDs);
+        for (const auto& movie : services.movieRepository->getAllMovies()) {
+            movieIDs.push_back(movie.id);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "[Bench] Setup failed: " << e.what() << "\n";
+        return 1;
+    }
+
+    std::printf("Ticket rush: %d buyers x %d ops, %d showtimes (%d hot), read ratio %.2f, contention %.2f, "
+                "%d seats/booking, holds %s, %zu readers\n",
+                scenario.buyers, scenario.opsPerBuyer, scenario.showTimes, scenario.hotShowTimes,
+                scenario.readRatio, scenario.contention, scenario.seatsPerBooking,
+                scenario.useHolds ? "on" : "off", services.connectionPool->readerCount());
+
+    std::vector<Samples> samples(static_cast<std::size_t>(scenario.buyers));
+    std::vector<std::thread> buyers;
+    auto start = Clock::now();
+    for (int i = 0; i < scenario.buyers; ++i) {
+        buyers.emplace_back(runBuyer, i, buyerIDs[static_cast<std::size_t>(i)], std::cref(scenario),
+                            std::cref(showTimeIDs), std::cref(movieIDs), std::ref(samples[static_cast<std::size_t>(i)]));
+    }
+    for (auto& buyer : buyers) {
+        buyer.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    Samples total;
+    for (auto& s : samples) {
+        total.browseNs.insert(total.browseNs.end(), s.browseNs.begin(), s.browseNs.end());
+        total.bookNs.insert(total.bookNs.end(), s.bookNs.begin(), s.bookNs.end());
+        total.booked += s.booked;
+        total.conflicts += s.conflicts;
+        total.soldOut += s.soldOut;
+        total.errors += s.errors;
+    }
+
+    std::size_t totalOps = static_cast<std::size_t>(scenario.buyers) * static_cast<std::size_t>(scenario.opsPerBuyer);
+    std::uint64_t attempts = total.booked + total.conflicts;
+    std::printf("\nElapsed  %.3f s, %.1f ops/s overall\n", seconds, static_cast<double>(totalOps) / seconds);
+    printLatency("browse", total.browseNs, seconds);
+    printLatency("book", total.bookNs, seconds);
+    std::printf("\nBookings %llu, conflicts %llu (%.2f%% of attempts), sold out %llu, errors %llu\n",
+                static_cast<unsigned long long>(total.booked), static_cast<unsigned long long>(total.conflicts),
+                attempts ? 100.0 * static_cast<double>(total.conflicts) / static_cast<double>(attempts) : 0.0,
+                static_cast<unsigned long long>(total.soldOut), static_cast<unsigned long long>(total.errors));
+    auto cache = services.movieCache->stats();
+    std::printf("Catalog cache: %llu hits, %llu misses (%.2f%% hit rate)\n",
+                static_cast<unsigned long long>(cache.hits), static_cast<unsigned long long>(cache.misses),
+                100.0 * cache.hitRate());
+    return total.errors == 0 ? 0 : 2;
+}
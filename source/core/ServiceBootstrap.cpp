@@ -0,0 +1,60 @@
+#include "ServiceBootstrap.h"
+#include "ServiceRegistry.h"
+#include "../database/SchemaMigrator.h"
+#include "../repository/AuthenticationRepositorySQL.h"
+#include "../repository/MovieRepositorySQL.h"
+#include "../repository/BookingRepositorySQL.h"
+#include "../service/LoginService.h"
+#include "../service/RegisterService.h"
+#include "../service/LogoutService.h"
+#include "../service/BookingService.h"
+#include "../service/MovieViewerService.h"
+#include "../service/MovieManagerService.h"
+#include <iostream>
+#include <stdexcept>
+
+ServiceBootstrap::Services ServiceBootstrap::initialize(const std::string& dbFilePath,
+                                                        const std::string& schemaFilePath,
+                                                        const ConnectionProfile& profile,
+                                                        std::size_t readerCount) {
+    Services services;
+    services.connectionPool = std::make_shared<ConnectionPool>(dbFilePath, readerCount, profile);
+
+    {
+        // Schema changes go through the writer; readers see them once committed
+        auto db = services.connectionPool->writer();
+
+        // Nếu file chưa tồn tại hoặc mới tạo -> nên luôn chạy schema
+        if (db->executeQuery("SELECT name FROM sqlite_master WHERE type='table';").empty()) {
+            std::cout << "[ServiceBootstrap] Running database schema setup...\n";
+            if (!db->executeSQLFile(schemaFilePath)) {
+                throw std::runtime_error("Failed to initialize database schema from " + schemaFilePath);
+            }
+        }
+
+        // Bring existing database files up to the current schema version (indexes, constraints)
+        SchemaMigrator migrator(db.get());
+        migrator.migrate();
+    }
+
+    // One instance of each repository, all leasing from the same pool
+    services.authRepository = std::make_shared<AuthenticationRepositorySQL>(services.connectionPool);
+    // Viewer and manager share the cache, so admin writes invalidate what browsers read
+    services.movieCache = std::make_shared<CachedMovieRepository>(
+        std::make_shared<MovieRepositorySQL>(services.connectionPool));
+    services.movieRepository = services.movieCache;
+    services.bookingRepository = std::make_shared<BookingRepository>(services.connectionPool);
+
+    // A second initialize() replaces the services of the first; the registry is frozen again below
+    ServiceRegistry::reset();
+    ServiceRegistry::addSingleton<ILoginService>(std::make_shared<LoginService>(services.authRepository.get()));
+    ServiceRegistry::addSingleton<IRegisterService>(std::make_shared<RegisterService>(services.authRepository.get()));
+    ServiceRegistry::addSingleton<ILogoutService>(std::make_shared<LogoutService>());
+    ServiceRegistry::addSingleton<IBookingService>(std::make_shared<BookingService>(services.bookingRepository));
+    ServiceRegistry::addSingleton<IMovieViewerService>(std::make_shared<MovieViewerService>(services.movieRepository));
+    ServiceRegistry::addSingleton<IMovieManagerService>(std::make_shared<MovieManagerService>(services.movieRepository));
+    // Lookups from here on (UI actions, server workers) are lock-free
+    ServiceRegistry::freeze();
+
+    return services;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file ServiceBootstrap.h
+ * @brief Opens the database and registers every service in the ServiceRegistry
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef _SERVICEBOOTSTRAP_H_
+#define _SERVICEBOOTSTRAP_H_
+#include "../database/ConnectionPool.h"
+#include "../database/ConnectionProfile.h"
+#include "../repository/IAuthenticationRepository.h"
+#include "../repository/IMovieRepository.h"
+#include "../repository/IBookingRepository.h"
+#include "../repository/CachedMovieRepository.h"
+#include <cstddef>
+#include <memory>
+#include <string>
+
+/**
+ * @class ServiceBootstrap
+ * @brief Wiring shared by every front end of the booking system
+ *
+ * The kiosk (App) and the headless BookingServer serve the same services
+ * from the same database, so the steps that build them live here:
+ *
+ * 1. Open a ConnectionPool on the database file
+ * 2. Create the schema if the file has no tables, then run SchemaMigrator
+ * 3. Build one instance of each SQL repository on the pool, with the movie
+ *    repository behind a CachedMovieRepository shared by both movie services
+ * 4. Register the services in ServiceRegistry, where the visitors find them,
+ *    and freeze it so that every thread can look them up without locking
+ *
+ * @par Usage Example
+ * @code
+ * auto services = ServiceBootstrap::initialize("database.db", "./database/database.sql",
+ *                                              ConnectionProfile::server());
+ * auto visitor = std::make_shared<BookingServiceVisitor>();
+ * session->getCurrentContext()->accept(visitor);   // finds the registered BookingService
+ * @endcode
+ *
+ * @warning LoginService and RegisterService keep a raw pointer to the
+ *          authentication repository: keep the returned Services alive for as
+ *          long as the registered services are used
+ * @see ServiceRegistry
+ * @see App::initialize
+ */
+class ServiceBootstrap {
+public:
+    /**
+     * @brief Shared objects behind the registered services
+     */
+    struct Services {
+        std::shared_ptr<ConnectionPool> connectionPool;
+        std::shared_ptr<IAuthenticationRepository> authRepository;
+        std::shared_ptr<IMovieRepository> movieRepository;         ///< The cache below
+        std::shared_ptr<CachedMovieRepository> movieCache;         ///< Same object, for its stats
+        std::shared_ptr<IBookingRepository> bookingRepository;
+    };
+
+    /**
+     * @brief Open the database, bring its schema up to date and register all services
+     *
+     * @param dbFilePath Database file, created if missing
+     * @param schemaFilePath SQL script run when the database has no tables yet
+     * @param profile Pragmas for every pooled connection
+     * @param readerCount Reader connections in the pool
+     * @return Services Pool and repositories the services were built on
+     *
+     * @throws std::runtime_error If the database cannot be opened, created or migrated
+     *
+     * @note Calling it again resets the registry and replaces the services
+     *       registered by the previous call; no other thread may be using
+     *       them at that point
+     */
+    static Services initialize(const std::string& dbFilePath,
+                               const std::string& schemaFilePath,
+                               const ConnectionProfile& profile,
+                               std::size_t readerCount = ConnectionPool::defaultReaderCount());
+};
+
+#endif
@@ -7,9 +7,13 @@
 
 #ifndef _REGISTRY_H_
 #define _REGISTRY_H_
-#include <map>
-#include <string>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
 
 /**
  * @class ServiceRegistry
@@ -29,10 +33,25 @@
  * 
  * **Key Features:**
  * - Type-safe service registration and retrieval
- * - Automatic singleton lifecycle management
- * - Thread-safe operations (with proper usage)
+ * - Compile-time keys: each service type has its own static slot
+ *   (Slot<T>::instance), so a lookup is one load, with no allocation,
+ *   hashing or string comparison
+ * - Thread-safe registration phase, lock-free frozen read phase
  * - Memory management through shared_ptr
- * - Runtime type identification for service mapping
+ * 
+ * **Lifecycle:**
+ * | Phase        | addSingleton()          | get() / getSingleton()         |
+ * |--------------|-------------------------|--------------------------------|
+ * | Registration | Serialized by a mutex   | Takes the same mutex           |
+ * | Frozen       | Throws std::logic_error | Reads the slot without locking |
+ * 
+ * freeze() ends registration: the slots never change afterwards, so any
+ * number of threads (the BookingServer workers, every visitor service()
+ * call) read them concurrently. get() hands out the raw pointer and touches
+ * no reference count, so hot lookups do not contend on the shared_ptr
+ * control block; getSingleton() copies the shared_ptr for callers that keep
+ * the service beyond the registry's lifetime. reset() empties the registry and reopens
+ * registration for the next ServiceBootstrap::initialize() or test.
  * 
  * **Benefits:**
  * - Reduces tight coupling between components
@@ -40,10 +59,19 @@
  * - Centralizes dependency management
  * - Supports lazy initialization of services
  * 
- * @warning This class uses static members and is not inherently thread-safe
- * @note Consider thread synchronization for multi-threaded applications
+ * @par Usage Example
+ * @code
+ * ServiceRegistry::addSingleton<IBookingService>(std::make_shared<BookingService>(bookingRepo));
+ * ServiceRegistry::freeze();                                       // before starting threads
+ * IBookingService* booking = ServiceRegistry::get<IBookingService>(); // from any thread
+ * @endcode
+ * 
+ * @warning reset() must not run while other threads may call get() or
+ *          getSingleton(), or still use a pointer returned by get()
+ * @note Services are keyed by the exact registration type: register and look
+ *       up through the same interface (ILoginService, not LoginService)
  * 
- * @see DatabaseConnection
+ * @see ServiceBootstrap
  * @see IAuthenticationRepository
  * @see IMovieRepository
  * @since v1.0
@@ -51,28 +79,44 @@
 class ServiceRegistry {
 private:
     /**
-     * @brief Static map storing registered service instances
+     * @brief Storage for the service of type T
      * 
-     * Maps type names to shared pointers of service instances.
-     * Uses void pointers for type erasure and shared_ptr for memory management.
+     * One instantiation per service type, created by the compiler: the type
+     * itself is the key, resolved at compile time.
      */
-    inline static std::map<std::string, std::shared_ptr<void>> _services;
+    template<typename T>
+    struct Slot {
+        inline static std::shared_ptr<T> instance;
+        inline static bool tracked = false; ///< Listed in _slotClearers (guarded by _registrationMutex)
+
+        static void clear() { instance.reset(); }
+    };
+
+    /// Serializes registration, and lookups until the registry is frozen
+    inline static std::mutex _registrationMutex;
+    /// Set by freeze(); once true (acquire) the slots are read without locking
+    inline static std::atomic<bool> _frozen{false};
+    /// Slot<T>::clear of every type ever registered, for reset()
+    inline static std::vector<void (*)()> _slotClearers;
     
 public:
     /**
      * @brief Registers a singleton service instance
      * 
-     * Stores a service instance in the registry under its type name,
-     * making it available for later retrieval by the same type.
+     * Stores a service instance in the slot of type T, making it available
+     * for later retrieval by the same type.
      * 
      * @tparam T The service type to register
      * @param service Shared pointer to the service instance
      * 
      * @pre service must be a valid initialized instance
+     * @pre The registry is not frozen
      * @post Service is available for retrieval via getSingleton<T>()
      * @post Previous instance of same type (if any) is replaced
      * 
-     * @note If a service of the same type already exists, it will be replaced
+     * @throws std::logic_error If the registry is frozen
+     * 
+     * @note Safe to call from several threads during the registration phase
      * @warning Replacing services may break existing dependencies
      * 
      * @code
@@ -85,15 +129,23 @@ public:
      */
     template<typename T>
     static void addSingleton(std::shared_ptr<T> service) {
-        std::string typeName = typeid(T).name();
-        _services[typeName] = service;
+        std::lock_guard<std::mutex> lock(_registrationMutex);
+        if (_frozen.load(std::memory_order_relaxed)) {
+            throw std::logic_error(std::string("ServiceRegistry is frozen; cannot register ") + typeid(T).name());
+        }
+        if (!Slot<T>::tracked) {
+            Slot<T>::tracked = true;
+            _slotClearers.push_back(&Slot<T>::clear);
+        }
+        Slot<T>::instance = std::move(service);
     }
 
     /**
      * @brief Retrieves a singleton service instance by type
      * 
-     * Looks up and returns a previously registered service instance
-     * of the specified type, or nullptr if not found.
+     * Returns the instance in the slot of type T, or nullptr if none was
+     * registered. Once the registry is frozen this is a flag check and a
+     * shared_ptr copy; before that it takes the registration mutex.
      * 
      * @tparam T The service type to retrieve
      * 
@@ -114,16 +166,72 @@ public:
      * @endcode
      * 
      * @see addSingleton()
+     * @see get() for lookups that do not need ownership (visitors, request handlers)
      * @since v1.0
      */
     template<typename T>
     static std::shared_ptr<T> getSingleton() {
-        std::string typeName = typeid(T).name();
-        auto it = _services.find(typeName);
-        if (it != _services.end()) {
-            return std::static_pointer_cast<T>(it->second);
+        // Pairs with the release in freeze(): every registration is visible
+        if (_frozen.load(std::memory_order_acquire)) {
+            return Slot<T>::instance;
+        }
+        std::lock_guard<std::mutex> lock(_registrationMutex);
+        return Slot<T>::instance;
+    }
+
+    /**
+     * @brief Retrieves a service without taking shared ownership
+     * 
+     * Same lookup as getSingleton(), but returns the stored pointer instead
+     * of copying the shared_ptr: once frozen it is a flag check and a load,
+     * with no atomic reference count update. The registry keeps the service
+     * alive until reset() or until T is registered again.
+     * 
+     * @tparam T The service type to retrieve
+     * @return T* The service, or nullptr if none was registered
+     * 
+     * @see getSingleton() to share ownership of the service
+     */
+    template<typename T>
+    static T* get() {
+        if (_frozen.load(std::memory_order_acquire)) {
+            return Slot<T>::instance.get();
+        }
+        std::lock_guard<std::mutex> lock(_registrationMutex);
+        return Slot<T>::instance.get();
+    }
+
+    /**
+     * @brief Ends the registration phase
+     * 
+     * From now on addSingleton() throws and get() and getSingleton() read
+     * without locking. Call it after the last registration and before other threads
+     * start looking services up (ServiceBootstrap::initialize does).
+     */
+    static void freeze() {
+        std::lock_guard<std::mutex> lock(_registrationMutex);
+        _frozen.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Whether freeze() was called since the last reset()
+     */
+    static bool isFrozen() {
+        return _frozen.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Removes every service and reopens registration
+     * 
+     * @warning No other thread may use the registry meanwhile: a frozen
+     *          lookup does not lock and would race with the reset
+     */
+    static void reset() {
+        std::lock_guard<std::mutex> lock(_registrationMutex);
+        for (auto clear : _slotClearers) {
+            clear();
         }
-        return nullptr;
+        _frozen.store(false, std::memory_order_release);
     }
 };
 
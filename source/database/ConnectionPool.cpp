@@ -0,0 +1,87 @@
+#include "ConnectionPool.h"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+ConnectionPool::Lease::Lease(ConnectionPool* pool, DatabaseConnection* conn)
+    : pool(pool), conn(conn) {}
+
+ConnectionPool::Lease::Lease(Lease&& other) noexcept
+    : pool(other.pool), conn(other.conn) {
+    other.pool = nullptr;
+    other.conn = nullptr;
+}
+
+ConnectionPool::Lease::~Lease() {
+    if (pool) {
+        pool->release(conn);
+    }
+}
+
+ConnectionPool::ConnectionPool(const std::string& dbFilePath, std::size_t readerCount, const ConnectionProfile& profile)
+    : dbFilePath(dbFilePath), writerLeased(false) {
+    if (readerCount == 0) {
+        throw std::invalid_argument("A connection pool needs at least one reader");
+    }
+
+    // The writer opens first so that it is the one switching the file to WAL
+    writerConn = std::make_unique<DatabaseConnection>();
+    if (!writerConn->connect(dbFilePath, profile)) {
+        throw std::runtime_error("Failed to open writer connection to " + dbFilePath);
+    }
+
+    readerConns.reserve(readerCount);
+    idleReaders.reserve(readerCount);
+    for (std::size_t i = 0; i < readerCount; ++i) {
+        auto reader = std::make_unique<DatabaseConnection>();
+        if (!reader->connect(dbFilePath, profile)) {
+            throw std::runtime_error("Failed to open reader connection to " + dbFilePath);
+        }
+        idleReaders.push_back(reader.get());
+        readerConns.push_back(std::move(reader));
+    }
+}
+
+std::size_t ConnectionPool::defaultReaderCount() {
+    // hardware_concurrency() may return 0 when unknown
+    return std::clamp<std::size_t>(std::thread::hardware_concurrency(), 2, 8);
+}
+
+ConnectionPool::Lease ConnectionPool::writer() {
+    std::unique_lock<std::mutex> lock(mutex);
+    writerReleased.wait(lock, [this] { return !writerLeased; });
+    writerLeased = true;
+    return Lease(this, writerConn.get());
+}
+
+ConnectionPool::Lease ConnectionPool::reader() {
+    std::unique_lock<std::mutex> lock(mutex);
+    readerReleased.wait(lock, [this] { return !idleReaders.empty(); });
+    DatabaseConnection* conn = idleReaders.back();
+    idleReaders.pop_back();
+    return Lease(this, conn);
+}
+
+std::size_t ConnectionPool::readerCount() const {
+    return readerConns.size();
+}
+
+const std::string& ConnectionPool::path() const {
+    return dbFilePath;
+}
+
+void ConnectionPool::release(DatabaseConnection* conn) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (conn == writerConn.get()) {
+            writerLeased = false;
+        } else {
+            idleReaders.push_back(conn);
+        }
+    }
+    if (conn == writerConn.get()) {
+        writerReleased.notify_one();
+    } else {
+        readerReleased.notify_one();
+    }
+}
@@ -0,0 +1,149 @@
+/**
+ * @file ConnectionPool.h
+ * @brief One writer and several reader connections on the same database file
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef CONNECTION_POOL_H
+#define CONNECTION_POOL_H
+
+#include "DatabaseConnection.h"
+#include "ConnectionProfile.h"
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @class ConnectionPool
+ * @brief Lends database connections to repositories, split into reads and writes
+ *
+ * SQLite allows a single writer at a time, but in WAL mode any number of
+ * readers keep reading the last committed snapshot while that writer works.
+ * The pool mirrors this: it opens exactly one writer connection and N reader
+ * connections, all with the same ConnectionProfile, and hands them out as
+ * leases.
+ *
+ * - reader(): catalog, showtime and seat-map queries; up to N threads read
+ *   in parallel, each on its own connection
+ * - writer(): bookings and every other statement that modifies the database;
+ *   callers queue in the pool instead of spinning on SQLITE_BUSY
+ *
+ * A lease gives exclusive use of its connection until it is destroyed, so a
+ * DatabaseConnection (and its statement cache) is never touched by two threads
+ * at once. Cursors and transactions opened on a leased connection must not
+ * outlive the lease: declare the lease first in the scope.
+ *
+ * @par Usage Example
+ * @code
+ * auto pool = std::make_shared<ConnectionPool>("database.db");
+ *
+ * {
+ *     auto db = pool->writer();
+ *     Transaction transaction(db.get(), Transaction::Mode::IMMEDIATE);
+ *     db->executeNonQuery("INSERT INTO ...", params);
+ *     transaction.commit();
+ * }
+ *
+ * auto db = pool->reader();
+ * for (const ResultRow& row : db->query("SELECT Title FROM MOVIE")) { ... }
+ * @endcode
+ *
+ * @note The read/write split only pays off with a WAL profile; with the
+ *       rollback journal readers still wait for the writer (up to the busy timeout)
+ * @warning A thread must not request a second lease of the same kind while it
+ *          holds one: the writer is not re-entrant and readers may run out
+ */
+class ConnectionPool {
+public:
+    /**
+     * @class Lease
+     * @brief Exclusive, scoped use of one pooled connection
+     *
+     * Move-only; the connection returns to the pool when the lease is destroyed.
+     */
+    class Lease {
+    private:
+        ConnectionPool* pool;
+        DatabaseConnection* conn;
+
+    public:
+        Lease(ConnectionPool* pool, DatabaseConnection* conn);
+        Lease(Lease&& other) noexcept;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        Lease& operator=(Lease&&) = delete;
+        ~Lease();
+
+        /**
+         * @brief Leased connection, valid until the lease is destroyed
+         */
+        DatabaseConnection* get() const { return conn; }
+        DatabaseConnection* operator->() const { return conn; }
+        DatabaseConnection& operator*() const { return *conn; }
+    };
+
+    /**
+     * @brief Open the writer and the readers
+     *
+     * @param dbFilePath Database file shared by all connections
+     * @param readerCount Number of reader connections (at least 1)
+     * @param profile Pragmas applied to every connection (WAL by default)
+     *
+     * @throws std::invalid_argument If readerCount is 0
+     * @throws std::runtime_error If a connection cannot be opened
+     */
+    explicit ConnectionPool(const std::string& dbFilePath,
+                            std::size_t readerCount = defaultReaderCount(),
+                            const ConnectionProfile& profile = ConnectionProfile::kiosk());
+
+    ConnectionPool(const ConnectionPool&) = delete;
+    ConnectionPool& operator=(const ConnectionPool&) = delete;
+
+    /**
+     * @brief One reader per hardware thread, between 2 and 8
+     */
+    static std::size_t defaultReaderCount();
+
+    /**
+     * @brief Borrow the writer connection, waiting while another thread holds it
+     */
+    Lease writer();
+
+    /**
+     * @brief Borrow an idle reader connection, waiting while all are in use
+     */
+    Lease reader();
+
+    /**
+     * @brief Number of reader connections
+     */
+    std::size_t readerCount() const;
+
+    /**
+     * @brief Database file the pool is connected to
+     */
+    const std::string& path() const;
+
+private:
+    /**
+     * @brief Give a leased connection back and wake one waiting thread
+     */
+    void release(DatabaseConnection* conn);
+
+    std::string dbFilePath;
+    std::unique_ptr<DatabaseConnection> writerConn;
+    std::vector<std::unique_ptr<DatabaseConnection>> readerConns;
+
+    std::mutex mutex;
+    std::condition_variable writerReleased;
+    std::condition_variable readerReleased;
+    bool writerLeased;                             ///< Guarded by mutex
+    std::vector<DatabaseConnection*> idleReaders;  ///< Guarded by mutex
+};
+
+#endif
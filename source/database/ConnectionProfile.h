@@ -0,0 +1,141 @@
+/**
+ * @file ConnectionProfile.h
+ * @brief SQLite tuning settings applied when a connection is opened
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef CONNECTION_PROFILE_H
+#define CONNECTION_PROFILE_H
+
+#include <cstdint>
+#include <optional>
+
+/**
+ * @struct ConnectionProfile
+ * @brief Journal, durability, memory and locking pragmas for one connection
+ *
+ * Passed to DatabaseConnection::connect() (or to a ConnectionPool, which
+ * passes it to each of its connections), which turns every field that is
+ * set into the matching PRAGMA right after the file is opened. Unset fields
+ * are not touched, so defaults() keeps whatever the file and SQLite already
+ * use: a plain connect() to a database a pool has put in WAL mode leaves it
+ * in WAL mode. Presets cover the deployments of the application.
+ *
+ * - **WAL journal**: readers keep reading the last committed snapshot while a
+ *   booking is being written, instead of waiting for the writer
+ * - **synchronous = NORMAL**: with WAL, commits append to the log without an
+ *   fsync; the log is synced at checkpoints. A power loss may drop the last
+ *   commits but never corrupts the database
+ * - **busy timeout**: a connection that finds the database locked retries for
+ *   this long before failing with SQLITE_BUSY
+ *
+ * @par Usage Example
+ * @code
+ * DatabaseConnection db;
+ * db.connect("database.db", ConnectionProfile::kiosk());
+ * @endcode
+ *
+ * @note Foreign key enforcement is left untouched on purpose: the schema
+ *       relies on it being off for deletes of referenced rows
+ * @see https://sqlite.org/pragma.html
+ * @see https://sqlite.org/wal.html
+ */
+struct ConnectionProfile {
+    /**
+     * @enum JournalMode
+     * @brief How SQLite makes transactions atomic
+     */
+    enum class JournalMode {
+        ROLLBACK, ///< SQLite default (journal_mode = DELETE); writers block readers
+        WAL       ///< Write-ahead log; readers and one writer run concurrently
+    };
+
+    /**
+     * @enum Synchronous
+     * @brief How often SQLite waits for data to reach the disk
+     */
+    enum class Synchronous {
+        OFF,    ///< Never fsync; fastest, unsafe on power loss
+        NORMAL, ///< fsync at WAL checkpoints only
+        FULL    ///< fsync on every commit (SQLite default)
+    };
+
+    /**
+     * @enum TempStore
+     * @brief Where temporary tables and sort buffers live
+     */
+    enum class TempStore {
+        DEFAULT, ///< Compile-time default (usually disk)
+        DISK,    ///< Always temporary files
+        MEMORY   ///< Always in memory
+    };
+
+    std::optional<JournalMode> journalMode;  ///< PRAGMA journal_mode
+    std::optional<Synchronous> synchronous;  ///< PRAGMA synchronous
+    std::optional<std::int64_t> mmapSize;    ///< PRAGMA mmap_size, in bytes (0 = no memory mapping)
+    std::optional<int> cacheSizeKiB;         ///< PRAGMA cache_size, in KiB of page cache
+    std::optional<TempStore> tempStore;      ///< PRAGMA temp_store
+    int busyTimeoutMs = 0;                   ///< sqlite3_busy_timeout(), 0 = fail immediately (SQLite default)
+
+    /**
+     * @brief Nothing set: the file's journal mode and SQLite's built-in settings stay as they are
+     */
+    static ConnectionProfile defaults() {
+        return ConnectionProfile{};
+    }
+
+    /**
+     * @brief Interactive kiosk: one UI process, short queries, modest memory
+     *
+     * WAL + NORMAL so seat maps never wait for a booking and a booking costs
+     * no commit fsync; 64 MiB mmap and 8 MiB cache for the small dataset;
+     * short busy timeout so the UI reports contention quickly.
+     */
+    static ConnectionProfile kiosk() {
+        ConnectionProfile profile;
+        profile.journalMode = JournalMode::WAL;
+        profile.synchronous = Synchronous::NORMAL;
+        profile.mmapSize = 64LL * 1024 * 1024;
+        profile.cacheSizeKiB = 8 * 1024;
+        profile.tempStore = TempStore::MEMORY;
+        profile.busyTimeoutMs = 2000;
+        return profile;
+    }
+
+    /**
+     * @brief High-throughput server: many concurrent sessions, large dataset
+     *
+     * Same durability trade-off as kiosk(), with 256 MiB mmap, 64 MiB cache
+     * and a longer busy timeout so queued writers wait instead of failing.
+     */
+    static ConnectionProfile server() {
+        ConnectionProfile profile;
+        profile.journalMode = JournalMode::WAL;
+        profile.synchronous = Synchronous::NORMAL;
+        profile.mmapSize = 256LL * 1024 * 1024;
+        profile.cacheSizeKiB = 64 * 1024;
+        profile.tempStore = TempStore::MEMORY;
+        profile.busyTimeoutMs = 5000;
+        return profile;
+    }
+
+    /**
+     * @brief Offline bulk load: one writer, nobody reading, file rebuilt on failure
+     *
+     * Rollback journal and no fsync at all, since a crashed load is simply
+     * rerun; 256 MiB cache so index pages of large tables stay in memory.
+     * Never use it for a database that serves customers.
+     */
+    static ConnectionProfile bulkLoad() {
+        ConnectionProfile profile;
+        profile.journalMode = JournalMode::ROLLBACK;
+        profile.synchronous = Synchronous::OFF;
+        profile.cacheSizeKiB = 256 * 1024;
+        profile.tempStore = TempStore::MEMORY;
+        return profile;
+    }
+};
+
+#endif
@@ -4,46 +4,182 @@
 #include <sstream>
 #include <filesystem>
 
-DatabaseConnection* DatabaseConnection::instance = nullptr;
-
-DatabaseConnection::DatabaseConnection() : db(nullptr) {}
+DatabaseConnection::DatabaseConnection()
+    : db(nullptr), statementCacheCapacity(DEFAULT_STATEMENT_CACHE_CAPACITY) {}
 
 DatabaseConnection::~DatabaseConnection() {
     disconnect();
 }
 
-DatabaseConnection* DatabaseConnection::getInstance() {
-    if (!instance) {
-        instance = new DatabaseConnection();
-    }
-    return instance;
-}
-
 bool DatabaseConnection::connect(const std::string& dbFilePath) {
+    // Reconnecting must not leak the previous handle or keep statements compiled against it
+    disconnect();
     if (sqlite3_open(dbFilePath.c_str(), &db) != SQLITE_OK) {
         std::cerr << " [DatabaseConnection] Error opening database: " << sqlite3_errmsg(db) << "\n";
+        sqlite3_close(db);
         db = nullptr;
         return false;
     }
+    applyProfile();
     return true;
 }
 
+bool DatabaseConnection::connect(const std::string& dbFilePath, const ConnectionProfile& profile) {
+    this->profile = profile;
+    return connect(dbFilePath);
+}
+
+void DatabaseConnection::applyProfile() {
+    sqlite3_busy_timeout(db, profile.busyTimeoutMs);
+
+    // Only what the profile sets: journal_mode is persistent, so issuing SQLite's default here
+    // would take a database out of the WAL mode its other connections rely on
+    std::string pragmas;
+    if (profile.journalMode) {
+        pragmas += *profile.journalMode == ConnectionProfile::JournalMode::WAL
+            ? "PRAGMA journal_mode = WAL;"
+            : "PRAGMA journal_mode = DELETE;";
+    }
+    if (profile.synchronous) {
+        switch (*profile.synchronous) {
+            case ConnectionProfile::Synchronous::OFF:    pragmas += "PRAGMA synchronous = OFF;"; break;
+            case ConnectionProfile::Synchronous::NORMAL: pragmas += "PRAGMA synchronous = NORMAL;"; break;
+            case ConnectionProfile::Synchronous::FULL:   pragmas += "PRAGMA synchronous = FULL;"; break;
+        }
+    }
+    if (profile.tempStore) {
+        switch (*profile.tempStore) {
+            case ConnectionProfile::TempStore::DEFAULT: pragmas += "PRAGMA temp_store = DEFAULT;"; break;
+            case ConnectionProfile::TempStore::DISK:    pragmas += "PRAGMA temp_store = FILE;"; break;
+            case ConnectionProfile::TempStore::MEMORY:  pragmas += "PRAGMA temp_store = MEMORY;"; break;
+        }
+    }
+    // A negative cache_size is a size in KiB rather than a page count
+    if (profile.cacheSizeKiB) {
+        pragmas += "PRAGMA cache_size = -" + std::to_string(*profile.cacheSizeKiB) + ";";
+    }
+    if (profile.mmapSize) {
+        pragmas += "PRAGMA mmap_size = " + std::to_string(*profile.mmapSize) + ";";
+    }
+    if (pragmas.empty()) {
+        return;
+    }
+
+    char* errMsg = nullptr;
+    if (sqlite3_exec(db, pragmas.c_str(), nullptr, nullptr, &errMsg) != SQLITE_OK) {
+        std::cerr << "[DatabaseConnection] Failed to apply connection profile: " << errMsg << "\n";
+        sqlite3_free(errMsg);
+    }
+}
+
 void DatabaseConnection::disconnect() {
+    clearStatementCache();
     if (db) {
         sqlite3_close(db);
         db = nullptr;
     }
 }
 
-bool DatabaseConnection::executeNonQuery(const std::string& sql, const std::vector<std::string>& params) {
-    sqlite3_stmt* stmt;
+StatementLease DatabaseConnection::acquireStatement(const std::string& sql) {
+    auto it = statementIndex.find(std::string_view(sql));
+    if (it != statementIndex.end() && !it->second->inUse) {
+        statementCache.splice(statementCache.begin(), statementCache, it->second);
+        it->second->inUse = true;
+        ++cacheStats.hits;
+        return {it->second->stmt, &*it->second};
+    }
+
+    ++cacheStats.misses;
+    sqlite3_stmt* stmt = nullptr;
     if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
-        std::cerr << "[DatabaseConnection] Failed to prepare statement: " << sqlite3_errmsg(db) << "\n";
-        return false;
+        sqlite3_finalize(stmt);
+        return {};
+    }
+
+    // A nested query already holds the cached copy, keep this one private
+    if (it != statementIndex.end() || statementCacheCapacity == 0) {
+        return {stmt, nullptr};
+    }
+
+    statementCache.push_front(CachedStatement{sql, stmt, true});
+    statementIndex.emplace(std::string_view(statementCache.front().sql), statementCache.begin());
+    CachedStatement* entry = &statementCache.front();
+    trimStatementCache();
+    return {stmt, entry};
+}
+
+void DatabaseConnection::releaseStatement(const StatementLease& lease) {
+    if (!lease.stmt) {
+        return;
     }
+    sqlite3_reset(lease.stmt);
+    sqlite3_clear_bindings(lease.stmt);
 
+    // The entry stays in the cache while it is in use: trimming skips it
+    if (lease.entry) {
+        lease.entry->inUse = false;
+        trimStatementCache();
+        return;
+    }
+    sqlite3_finalize(lease.stmt);
+}
+
+StatementLease DatabaseConnection::prepareBound(const std::string& sql, const std::vector<std::string>& params) {
+    StatementLease lease = acquireStatement(sql);
+    if (!lease.stmt) {
+        return lease;
+    }
     for (size_t i = 0; i < params.size(); ++i) {
-        sqlite3_bind_text(stmt, static_cast<int>(i + 1), params[i].c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_text(lease.stmt, static_cast<int>(i + 1), params[i].c_str(), -1, SQLITE_TRANSIENT);
+    }
+    return lease;
+}
+
+void DatabaseConnection::trimStatementCache() {
+    // Walk from the least recently used end, skipping statements that are being stepped
+    auto it = statementCache.end();
+    while (statementCache.size() > statementCacheCapacity && it != statementCache.begin()) {
+        --it;
+        if (it->inUse) {
+            continue;
+        }
+        statementIndex.erase(std::string_view(it->sql));
+        sqlite3_finalize(it->stmt);
+        it = statementCache.erase(it);
+        ++cacheStats.evictions;
+    }
+}
+
+void DatabaseConnection::clearStatementCache() {
+    for (auto& entry : statementCache) {
+        sqlite3_finalize(entry.stmt);
+    }
+    statementCache.clear();
+    statementIndex.clear();
+}
+
+StatementCacheStats DatabaseConnection::getStatementCacheStats() const {
+    StatementCacheStats stats = cacheStats;
+    stats.size = statementCache.size();
+    stats.capacity = statementCacheCapacity;
+    return stats;
+}
+
+void DatabaseConnection::setStatementCacheCapacity(std::size_t capacity) {
+    statementCacheCapacity = capacity;
+    trimStatementCache();
+}
+
+void DatabaseConnection::resetStatementCacheStats() {
+    cacheStats = StatementCacheStats{};
+}
+
+bool DatabaseConnection::executeNonQuery(const std::string& sql, const std::vector<std::string>& params) {
+    StatementLease lease = prepareBound(sql, params);
+    sqlite3_stmt* stmt = lease.stmt;
+    if (!stmt) {
+        std::cerr << "[DatabaseConnection] Failed to prepare statement: " << sqlite3_errmsg(db) << "\n";
+        return false;
     }
 
     bool success = (sqlite3_step(stmt) == SQLITE_DONE);
@@ -51,7 +187,7 @@ bool DatabaseConnection::executeNonQuery(const std::string& sql, const std::vect
         std::cerr << "[DatabaseConnection] Failed to execute statement: " << sqlite3_errmsg(db) << "\n";
     }
 
-    sqlite3_finalize(stmt);
+    releaseStatement(lease);
     return success;
 }
 
@@ -59,17 +195,14 @@ std::vector<std::map<std::string, std::string>> DatabaseConnection::executeQuery
     const std::string& sql, const std::vector<std::string>& params
 ) {
     std::vector<std::map<std::string, std::string>> results;
-    sqlite3_stmt* stmt;
+    StatementLease lease = prepareBound(sql, params);
+    sqlite3_stmt* stmt = lease.stmt;
 
-    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+    if (!stmt) {
         std::cerr << "[DatabaseConnection] Failed to prepare query: " << sqlite3_errmsg(db) << "\n";
         return results;
     }
 
-    for (size_t i = 0; i < params.size(); ++i) {
-        sqlite3_bind_text(stmt, static_cast<int>(i + 1), params[i].c_str(), -1, SQLITE_TRANSIENT);
-    }
-
     int colCount = sqlite3_column_count(stmt);
 
     while (sqlite3_step(stmt) == SQLITE_ROW) {
@@ -82,10 +215,30 @@ std::vector<std::map<std::string, std::string>> DatabaseConnection::executeQuery
         results.push_back(row);
     }
 
-    sqlite3_finalize(stmt);
+    releaseStatement(lease);
     return results;
 }
 
+QueryCursor DatabaseConnection::query(const std::string& sql, const std::vector<std::string>& params) {
+    StatementLease lease = prepareBound(sql, params);
+    if (!lease.stmt) {
+        std::cerr << "[DatabaseConnection] Failed to prepare query: " << sqlite3_errmsg(db) << "\n";
+    }
+    return QueryCursor(this, lease);
+}
+
+bool DatabaseConnection::forEachRow(
+    const std::string& sql,
+    const std::vector<std::string>& params,
+    const std::function<void(const ResultRow&)>& visitor
+) {
+    QueryCursor cursor = query(sql, params);
+    for (const ResultRow& row : cursor) {
+        visitor(row);
+    }
+    return cursor.ok();
+}
+
 bool DatabaseConnection::executeSQLFile(const std::string& filePath) {
     std::ifstream file(filePath);
     if (!file.is_open()) {
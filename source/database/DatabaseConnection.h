@@ -12,55 +12,86 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <list>
+#include <unordered_map>
+#include <string_view>
+#include <cstddef>
+#include <functional>
+#include "QueryCursor.h"
+#include "ConnectionProfile.h"
 
 extern "C" {
     #include "sqlite3.h"
 }
 
+/**
+ * @struct StatementCacheStats
+ * @brief Counters describing the behaviour of the prepared-statement cache
+ *
+ * Snapshot returned by DatabaseConnection::getStatementCacheStats(). A hit means
+ * a previously compiled statement was reused, a miss means sqlite3_prepare_v2()
+ * had to run, and an eviction means the least recently used statement was
+ * finalized to stay within the configured capacity.
+ */
+struct StatementCacheStats {
+    std::size_t hits = 0;      ///< Statements served from the cache
+    std::size_t misses = 0;    ///< Statements that had to be compiled
+    std::size_t evictions = 0; ///< Statements finalized to respect the capacity
+    std::size_t size = 0;      ///< Statements currently held by the cache
+    std::size_t capacity = 0;  ///< Maximum number of statements kept
+};
+
+/**
+ * @struct CachedStatement
+ * @brief Entry of the prepared-statement cache of a DatabaseConnection
+ */
+struct CachedStatement {
+    std::string sql;      ///< SQL text the statement was compiled from (the cache key)
+    sqlite3_stmt* stmt;   ///< Compiled statement
+    bool inUse;           ///< True while a caller is stepping the statement
+};
+
 /**
  * @class DatabaseConnection
- * @brief Singleton class for managing SQLite database connections
+ * @brief One SQLite connection with its statement cache and query helpers
  * 
- * This class implements the Singleton design pattern to ensure only one database
- * connection exists throughout the application lifecycle. It provides thread-safe
- * access to the SQLite database and manages connection pooling and query execution.
+ * Each object owns a single sqlite3 handle. The application does not create
+ * connections directly: a ConnectionPool opens one writer and several readers
+ * on the same file and lends them to the repositories. A connection must only
+ * be used by one thread at a time, which the pool's leases guarantee.
  * 
  * @details
  * Key Features:
- * - Thread-safe singleton implementation
  * - Automatic connection management
  * - SQLite optimization settings
  * - Parameterized query support
+ * - Bounded LRU cache of prepared statements keyed by SQL text
+ * - Typed row cursor reading columns straight from the statement
+ * - Streaming row visitor for large result sets
  * - Connection health monitoring
  * - SQL file execution support
  * 
  * @par Usage Example
  * @code
- * DatabaseConnection* db = DatabaseConnection::getInstance();
- * db->connect("database.db");
+ * DatabaseConnection db;
+ * db.connect("database.db");
  * 
  * // Execute a query
  * std::vector<std::string> params = {"user123"};
- * auto results = db->executeQuery("SELECT * FROM users WHERE username = ?", params);
+ * auto results = db.executeQuery("SELECT * FROM users WHERE username = ?", params);
  * 
  * // Execute non-query
- * bool success = db->executeNonQuery("INSERT INTO users (username) VALUES (?)", params);
+ * bool success = db.executeNonQuery("INSERT INTO users (username) VALUES (?)", params);
  * @endcode
  * 
- * @warning This class is not copyable or movable to maintain singleton integrity
+ * @warning This class is not copyable or movable: cached statements and open
+ *          cursors point back to the sqlite3 handle it owns
+ * @see ConnectionPool for sharing connections between repositories and threads
  * 
  * @see https://sqlite.org/c3ref/sqlite3.html
  */
 class DatabaseConnection {
 private:
-    /**
-     * @brief Singleton instance pointer
-     * 
-     * Static pointer to the single instance of DatabaseConnection.
-     * Initialized to nullptr and created on first getInstance() call.
-     */
-    static DatabaseConnection* instance;
-    
     /**
      * @brief SQLite database handle
      * 
@@ -70,28 +101,105 @@ private:
     sqlite3* db;
 
     /**
-     * @brief Private constructor (Singleton pattern)
-     * 
-     * Prevents direct instantiation. Database connection must be obtained
-     * through getInstance() method.
-     * 
-     * @post db == nullptr (connection established via connect())
+     * @brief Cached prepared statements, most recently used first
+     *
+     * Entries stay in place while they are being stepped (inUse is set), so a
+     * cache hit only splices a list node and never allocates.
      */
-    DatabaseConnection();
+    std::list<CachedStatement> statementCache;
+
+    /**
+     * @brief Lookup index from SQL text to its entry in statementCache
+     *
+     * Keys view the sql member of the list node, which never moves.
+     */
+    std::unordered_map<std::string_view, std::list<CachedStatement>::iterator> statementIndex;
+
+    /**
+     * @brief Maximum number of statements kept in statementCache
+     */
+    std::size_t statementCacheCapacity;
+
+    /**
+     * @brief Hit/miss/eviction counters of the statement cache
+     */
+    StatementCacheStats cacheStats;
+
+    /**
+     * @brief Pragmas applied by connect(), kept for later reconnects
+     */
+    ConnectionProfile profile;
+
+    /**
+     * @brief Apply the pragmas of profile to the open handle
+     *
+     * Failures are reported on stderr; the connection stays usable with
+     * SQLite's defaults for the settings that could not be applied.
+     */
+    void applyProfile();
+
+    /**
+     * @brief Take a ready-to-bind statement for the given SQL text
+     *
+     * Returns the cached statement when one is idle (cache hit) or compiles a
+     * new one with sqlite3_prepare_v2() (cache miss). The statement is marked
+     * in use until releaseStatement() is called; a nested query with the same
+     * SQL gets its own uncached statement, so handles are never shared.
+     *
+     * @param sql SQL statement text, used as the cache key
+     * @return StatementLease Prepared statement (nullptr if compilation failed)
+     *         and the cache entry to release it to (nullptr if it is not cached)
+     */
+    StatementLease acquireStatement(const std::string& sql);
+
+    /**
+     * @brief Return a statement obtained from acquireStatement() to the cache
+     *
+     * Resets the statement and clears its bindings so it is ready for the next
+     * caller. Statements that are not owned by the cache are finalized.
+     *
+     * @param lease Statement to give back (ignored if its stmt is nullptr)
+     */
+    void releaseStatement(const StatementLease& lease);
+
+    /**
+     * @brief Acquire a statement and bind text parameters to it
+     *
+     * @param sql SQL statement text
+     * @param params Values bound to the ? placeholders, in order
+     * @return StatementLease Bound statement (nullptr if compilation failed) and its cache entry
+     */
+    StatementLease prepareBound(const std::string& sql, const std::vector<std::string>& params);
+
+    friend class QueryCursor;
+
+    /**
+     * @brief Finalize least recently used statements until the cache fits its capacity
+     */
+    void trimStatementCache();
+
+    /**
+     * @brief Finalize every cached statement
+     *
+     * Must run before the underlying sqlite3 handle is closed.
+     */
+    void clearStatementCache();
 
 public:
     /**
-     * @brief Get the singleton instance of DatabaseConnection
-     * 
-     * Implements lazy initialization - creates the instance on first call.
-     * Subsequent calls return the same instance.
-     * 
-     * @return DatabaseConnection* Pointer to the singleton instance (never null)
+     * @brief Default number of prepared statements kept per connection
+     */
+    static constexpr std::size_t DEFAULT_STATEMENT_CACHE_CAPACITY = 64;
+
+    /**
+     * @brief Create a closed connection
      * 
-     * @note This method is thread-safe for creation but not for usage
-     * @warning Do not delete the returned pointer
+     * @post db == nullptr (connection established via connect())
      */
-    static DatabaseConnection* getInstance();
+    DatabaseConnection();
+
+    DatabaseConnection(const DatabaseConnection&) = delete;
+    DatabaseConnection& operator=(const DatabaseConnection&) = delete;
 
     /**
      * @brief Establish connection to SQLite database file
@@ -102,17 +210,45 @@ public:
      * @param dbFilePath Path to the SQLite database file
      * @return bool True if connection successful, false otherwise
      * 
+     * @note Any previously opened handle is closed first, together with the
+     *       statements cached for it
+     * 
      * @pre Database file path is valid and accessible
      * @post If successful: db != nullptr and connection is ready
      * 
      * @throws std::runtime_error If SQLite driver is not available
      * 
      * @par SQLite Settings Applied
-     * - Foreign key constraints enabled
-     * - WAL mode for better concurrency
-     * - Optimized pragma settings
+     * The pragmas of the current ConnectionProfile (SQLite defaults until a
+     * profile is passed to the other overload), so repositories reconnecting
+     * to the same file keep the application's tuning.
      */
     bool connect(const std::string& dbFilePath);
+
+    /**
+     * @brief Establish connection to SQLite database file with a tuning profile
+     * 
+     * Same as connect(const std::string&), and remembers the profile for
+     * every later connect() call.
+     * 
+     * @param dbFilePath Path to the SQLite database file
+     * @param profile Journal, synchronous, memory and busy-timeout settings
+     * @return bool True if connection successful, false otherwise
+     * 
+     * @par Example Usage
+     * @code
+     * db->connect("database.db", ConnectionProfile::kiosk());
+     * @endcode
+     * 
+     * @see ConnectionProfile::kiosk()
+     * @see ConnectionProfile::server()
+     */
+    bool connect(const std::string& dbFilePath, const ConnectionProfile& profile);
+
+    /**
+     * @brief Profile applied by connect()
+     */
+    const ConnectionProfile& getProfile() const { return profile; }
       /**
      * @brief Close database connection and cleanup resources
      * 
@@ -179,6 +315,62 @@ public:
         const std::string& sql,
         const std::vector<std::string>& params = {}
     );
+
+    /**
+     * @brief Execute a SELECT query and iterate its rows with typed accessors
+     *
+     * Unlike executeQuery(), no row is materialised: each column is read by
+     * index as int64, double or string_view straight from the statement while
+     * it is being stepped. Prefer this for hot read paths.
+     *
+     * @param sql SELECT SQL statement (may contain ? placeholders)
+     * @param params Parameter values to bind to placeholders
+     * @return QueryCursor Cursor positioned before the first row
+     *
+     * @pre Database connection is established
+     * @warning The cursor must not outlive this connection
+     *
+     * @par Example Usage
+     * @code
+     * auto cursor = db->query("SELECT SeatID, Price FROM SEAT WHERE SeatType = ?", {"Couple"});
+     * while (cursor.next()) {
+     *     std::string_view seatId = cursor.row().getText(0);
+     *     double price = cursor.row().getDouble(1);
+     * }
+     * @endcode
+     *
+     * @see QueryCursor
+     * @see ResultRow
+     */
+    QueryCursor query(const std::string& sql, const std::vector<std::string>& params = {});
+
+    /**
+     * @brief Execute a SELECT query and hand every row to a visitor while stepping
+     *
+     * Streaming counterpart of executeQuery(): rows are never collected, so
+     * memory stays constant whatever the size of the result set. The visitor
+     * may run other queries on this connection, including the same SQL.
+     *
+     * @param sql SELECT SQL statement (may contain ? placeholders)
+     * @param params Parameter values to bind to placeholders
+     * @param visitor Called once per row; the row is only valid during the call
+     * @return bool True if the query was prepared and stepped to completion
+     *
+     * @par Example Usage
+     * @code
+     * double total = 0;
+     * db->forEachRow("SELECT Price FROM SEAT", {}, [&](const ResultRow& row) {
+     *     total += row.getDouble(0);
+     * });
+     * @endcode
+     *
+     * @see query()
+     */
+    bool forEachRow(
+        const std::string& sql,
+        const std::vector<std::string>& params,
+        const std::function<void(const ResultRow&)>& visitor
+    );
       /**
      * @brief Execute an entire SQL file
      * 
@@ -203,13 +395,40 @@ public:
      */
     bool executeSQLFile(const std::string& filePath);
 
+    /**
+     * @brief Get a snapshot of the prepared-statement cache counters
+     *
+     * @return StatementCacheStats Hits, misses, evictions, current size and capacity
+     *
+     * @par Example Usage
+     * @code
+     * auto stats = db->getStatementCacheStats();
+     * std::cout << "hit ratio: " << double(stats.hits) / (stats.hits + stats.misses) << "\n";
+     * @endcode
+     */
+    StatementCacheStats getStatementCacheStats() const;
+
+    /**
+     * @brief Change the number of prepared statements kept by the cache
+     *
+     * Shrinking the capacity evicts the least recently used idle statements
+     * immediately. A capacity of 0 disables caching: every statement is
+     * finalized as soon as it has been used.
+     *
+     * @param capacity New maximum number of cached statements
+     */
+    void setStatementCacheCapacity(std::size_t capacity);
+
+    /**
+     * @brief Reset the hit/miss/eviction counters to zero
+     */
+    void resetStatementCacheStats();
+
     /**
      * @brief Destructor - cleanup database resources
      * 
      * Automatically closes database connection and releases resources
-     * when the singleton instance is destroyed (typically at program termination).
-     * 
-     * @note Called automatically - do not call manually
+     * when the connection is destroyed (typically when its pool goes away).
      */
     ~DatabaseConnection();
 };
@@ -0,0 +1,46 @@
+#include "QueryCursor.h"
+#include "DatabaseConnection.h"
+#include <iostream>
+#include <utility>
+
+QueryCursor::QueryCursor(DatabaseConnection* owner, StatementLease lease)
+    : owner(owner), stmt(lease.stmt), entry(lease.entry), current(stmt), failed(false) {}
+
+QueryCursor::QueryCursor(QueryCursor&& other) noexcept
+    : owner(other.owner), stmt(std::exchange(other.stmt, nullptr)), entry(std::exchange(other.entry, nullptr)),
+      current(stmt), failed(other.failed) {}
+
+QueryCursor& QueryCursor::operator=(QueryCursor&& other) noexcept {
+    if (this != &other) {
+        if (stmt) {
+            owner->releaseStatement({stmt, entry});
+        }
+        owner = other.owner;
+        stmt = std::exchange(other.stmt, nullptr);
+        entry = std::exchange(other.entry, nullptr);
+        current = ResultRow(stmt);
+        failed = other.failed;
+    }
+    return *this;
+}
+
+QueryCursor::~QueryCursor() {
+    if (stmt) {
+        owner->releaseStatement({stmt, entry});
+    }
+}
+
+bool QueryCursor::next() {
+    if (!stmt || failed) {
+        return false;
+    }
+    int rc = sqlite3_step(stmt);
+    if (rc == SQLITE_ROW) {
+        return true;
+    }
+    if (rc != SQLITE_DONE) {
+        failed = true;
+        std::cerr << "[QueryCursor] Failed to step query: " << sqlite3_errmsg(sqlite3_db_handle(stmt)) << "\n";
+    }
+    return false;
+}
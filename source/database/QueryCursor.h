@@ -0,0 +1,269 @@
+/**
+ * @file QueryCursor.h
+ * @brief Typed, allocation-light access to SQLite query results
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef QUERY_CURSOR_H
+#define QUERY_CURSOR_H
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+
+extern "C" {
+    #include "sqlite3.h"
+}
+
+class DatabaseConnection;
+struct CachedStatement;
+
+/**
+ * @struct StatementLease
+ * @brief A statement lent by DatabaseConnection and the cache entry it belongs to
+ *
+ * The statement is given back through the entry, never looked up again by
+ * its SQL text: sqlite3_sql() drops text after the first statement (such as
+ * a trailing "; "), so it does not always match the cache key.
+ */
+struct StatementLease {
+    sqlite3_stmt* stmt = nullptr;     ///< Prepared statement (nullptr if preparation failed)
+    CachedStatement* entry = nullptr; ///< Cache entry owning stmt; nullptr for an uncached statement
+};
+
+/**
+ * @class ResultRow
+ * @brief Read-only view of the row a QueryCursor is positioned on
+ *
+ * Columns are addressed by their zero-based position in the SELECT list and
+ * read straight from the underlying sqlite3_stmt, without building a map or
+ * converting numbers to strings.
+ *
+ * @warning Text returned by getText() is only valid until the cursor advances
+ *
+ * @see QueryCursor
+ */
+class ResultRow {
+private:
+    /**
+     * @brief Statement the row is read from (owned by the cursor)
+     */
+    sqlite3_stmt* stmt;
+
+public:
+    /**
+     * @brief Wrap a statement positioned on a row
+     *
+     * @param stmt Statement that has just returned SQLITE_ROW
+     */
+    explicit ResultRow(sqlite3_stmt* stmt = nullptr) : stmt(stmt) {}
+
+    /**
+     * @brief Number of columns in the result set
+     */
+    int columnCount() const { return sqlite3_column_count(stmt); }
+
+    /**
+     * @brief Check whether a column holds SQL NULL
+     *
+     * @param col Zero-based column index
+     */
+    bool isNull(int col) const { return sqlite3_column_type(stmt, col) == SQLITE_NULL; }
+
+    /**
+     * @brief Read a column as a 64-bit integer
+     *
+     * @param col Zero-based column index
+     * @return std::int64_t Column value (0 for NULL)
+     */
+    std::int64_t getInt64(int col) const { return sqlite3_column_int64(stmt, col); }
+
+    /**
+     * @brief Read a column as an int
+     *
+     * @param col Zero-based column index
+     * @return int Column value (0 for NULL)
+     */
+    int getInt(int col) const { return sqlite3_column_int(stmt, col); }
+
+    /**
+     * @brief Read a column as a double
+     *
+     * @param col Zero-based column index
+     * @return double Column value (0.0 for NULL)
+     */
+    double getDouble(int col) const { return sqlite3_column_double(stmt, col); }
+
+    /**
+     * @brief Read a column as text without copying it
+     *
+     * @param col Zero-based column index
+     * @return std::string_view Column text (empty for NULL), valid until the next step
+     */
+    std::string_view getText(int col) const {
+        const unsigned char* text = sqlite3_column_text(stmt, col);
+        if (!text) {
+            return {};
+        }
+        return std::string_view(reinterpret_cast<const char*>(text),
+                                static_cast<std::size_t>(sqlite3_column_bytes(stmt, col)));
+    }
+
+    /**
+     * @brief Read a column as an owned string
+     *
+     * @param col Zero-based column index
+     * @return std::string Copy of the column text (empty for NULL)
+     */
+    std::string getString(int col) const { return std::string(getText(col)); }
+};
+
+/**
+ * @class QueryCursor
+ * @brief Forward-only cursor over the rows of a SELECT statement
+ *
+ * Obtained from DatabaseConnection::query(). The cursor borrows a cached
+ * prepared statement and gives it back to the connection when it is
+ * destroyed, so statements are compiled once and reused across calls.
+ *
+ * Rows are produced while the statement is stepped, never buffered, so the
+ * cursor can also be consumed as a C++20 input range.
+ *
+ * @par Usage Example
+ * @code
+ * auto cursor = db->query("SELECT MovieID, Title, Rating FROM MOVIE");
+ * while (cursor.next()) {
+ *     const ResultRow& row = cursor.row();
+ *     int id = row.getInt(0);
+ *     std::string_view title = row.getText(1);
+ *     double rating = row.getDouble(2);
+ * }
+ *
+ * // Or as a range
+ * for (const ResultRow& row : db->query("SELECT Title FROM MOVIE")) {
+ *     std::cout << row.getText(0) << "\n";
+ * }
+ * @endcode
+ *
+ * @note Movable but not copyable
+ * @see ResultRow
+ * @see DatabaseConnection::query()
+ */
+class QueryCursor {
+private:
+    /**
+     * @brief Connection the statement has to be returned to
+     */
+    DatabaseConnection* owner;
+
+    /**
+     * @brief Borrowed prepared statement (nullptr if preparation failed)
+     */
+    sqlite3_stmt* stmt;
+
+    /**
+     * @brief Cache entry stmt is returned to (nullptr for an uncached statement)
+     */
+    CachedStatement* entry;
+
+    /**
+     * @brief Row view over stmt
+     */
+    ResultRow current;
+
+    /**
+     * @brief True when stepping failed with an error other than SQLITE_DONE
+     */
+    bool failed;
+
+public:
+    /**
+     * @class Iterator
+     * @brief Single-pass input iterator over the rows of a QueryCursor
+     *
+     * Incrementing steps the underlying statement; the end of the range is
+     * signalled with std::default_sentinel.
+     */
+    class Iterator {
+    private:
+        QueryCursor* cursor; ///< Cursor being walked (nullptr once exhausted)
+
+    public:
+        using value_type = ResultRow;
+        using difference_type = std::ptrdiff_t;
+        using reference = const ResultRow&;
+        using iterator_category = std::input_iterator_tag;
+
+        Iterator() : cursor(nullptr) {}
+        explicit Iterator(QueryCursor* cursor) : cursor(cursor) {}
+
+        const ResultRow& operator*() const { return cursor->row(); }
+        const ResultRow* operator->() const { return &cursor->row(); }
+
+        Iterator& operator++() {
+            if (!cursor->next()) {
+                cursor = nullptr;
+            }
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+
+        bool operator==(std::default_sentinel_t) const { return cursor == nullptr; }
+    };
+
+    /**
+     * @brief Create a cursor over a statement with its parameters already bound
+     *
+     * @param owner Connection that lent the statement
+     * @param lease Prepared statement (nullptr if preparation failed) and its cache entry
+     */
+    QueryCursor(DatabaseConnection* owner, StatementLease lease);
+
+    QueryCursor(const QueryCursor&) = delete;
+    QueryCursor& operator=(const QueryCursor&) = delete;
+    QueryCursor(QueryCursor&& other) noexcept;
+    QueryCursor& operator=(QueryCursor&& other) noexcept;
+
+    /**
+     * @brief Give the statement back to the connection
+     */
+    ~QueryCursor();
+
+    /**
+     * @brief Advance to the next row
+     *
+     * @return bool True if a row is available through row(), false when the
+     *         result set is exhausted or an error occurred
+     */
+    bool next();
+
+    /**
+     * @brief Access the current row
+     *
+     * @pre The last call to next() returned true
+     */
+    const ResultRow& row() const { return current; }
+
+    /**
+     * @brief Check that the statement was prepared and no step failed
+     */
+    bool ok() const { return stmt != nullptr && !failed; }
+
+    /**
+     * @brief Step to the first row and return an iterator on it
+     *
+     * @note Single pass: calling begin() again continues from the current row
+     */
+    Iterator begin() { return next() ? Iterator(this) : Iterator(); }
+
+    /**
+     * @brief End-of-rows sentinel
+     */
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+};
+
+#endif
@@ -0,0 +1,115 @@
+/**
+ * @file SchemaMigrator.h
+ * @brief Versioned schema upgrades driven by PRAGMA user_version
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef SCHEMA_MIGRATOR_H
+#define SCHEMA_MIGRATOR_H
+
+#include "DatabaseConnection.h"
+#include <string>
+#include <vector>
+
+/**
+ * @struct Migration
+ * @brief One schema step that moves the database to a given version
+ *
+ * Statements are executed one by one, in order, inside a single
+ * transaction together with the update of PRAGMA user_version.
+ */
+struct Migration {
+    int version;                         ///< Schema version after this step (1, 2, ...)
+    std::string description;             ///< Human-readable summary, used in logs and errors
+    std::vector<std::string> statements; ///< SQL statements of the step
+};
+
+/**
+ * @class SchemaMigrator
+ * @brief Upgrades a database in place to the latest schema version
+ *
+ * The schema version is stored in the SQLite header as PRAGMA user_version
+ * (0 for a database created from database.sql). migrate() applies every
+ * migration whose version is above the stored one, each in its own
+ * IMMEDIATE transaction, so an interrupted upgrade resumes at the first
+ * step that did not commit.
+ *
+ * @par Usage Example
+ * @code
+ * SchemaMigrator migrator(db);
+ * int applied = migrator.migrate(); // 0 when already up to date
+ * std::cout << "Schema version " << migrator.currentVersion() << "\n";
+ * @endcode
+ *
+ * @note Migrations must never be edited once released; add a new one instead
+ * @see defaultMigrations() for the application's schema history
+ */
+class SchemaMigrator {
+private:
+    /**
+     * @brief Connection the migrations run on
+     */
+    DatabaseConnection* conn;
+
+    /**
+     * @brief Known migrations, sorted by version
+     */
+    std::vector<Migration> migrations;
+
+public:
+    /**
+     * @brief Create a migrator for a connection
+     *
+     * @param conn Open database connection
+     * @param migrations Schema history to apply (defaults to the application's)
+     *
+     * @throws std::invalid_argument If versions are not 1, 2, 3, ... in order
+     */
+    explicit SchemaMigrator(DatabaseConnection* conn, std::vector<Migration> migrations = defaultMigrations());
+
+    /**
+     * @brief The application's schema history
+     *
+     * - v1: covering indexes for booking lookups by user, by showtime and by seat
+     * - v2: covering index for showtimes of a movie
+     * - v3: UNIQUE index on ACCOUNT.UserName (login lookup, no duplicate accounts);
+     *   existing duplicates are renamed to "name#UserID", except the lowest UserID
+     * - v4: FTS5 index MOVIE_FTS over MOVIE Title/Genre/Descriptions, kept in
+     *       sync by triggers (movie search)
+     * - v5: SHOWTIME.AuditoriumID (existing rows: 1) and SHOWTIME_RTREE, an
+     *       R*Tree over (auditorium, start/end in epoch minutes) kept in sync
+     *       by triggers (overlap checks, time-window queries); rows whose end
+     *       is before their start are not indexed
+     * - v6: SHOWTIME Date/StartTime/EndTime TEXT replaced by StartsAt/EndsAt
+     *       INTEGER epoch seconds (an end time before the start time moves to
+     *       the next day, e.g. 22:00-00:30); covering index
+     *       idx_showtime_movie_time replaces idx_showtime_movie
+     */
+    static std::vector<Migration> defaultMigrations();
+
+    /**
+     * @brief Version currently stored in the database
+     *
+     * @throws std::runtime_error If PRAGMA user_version cannot be read
+     */
+    int currentVersion() const;
+
+    /**
+     * @brief Version the database has after migrate()
+     */
+    int latestVersion() const;
+
+    /**
+     * @brief Apply every pending migration
+     *
+     * @return int Number of migrations applied
+     *
+     * @throws std::runtime_error If a migration fails; the failing step is
+     *         rolled back and earlier steps stay applied
+     */
+    int migrate();
+};
+
+#endif
@@ -0,0 +1,118 @@
+/**
+ * @file Transaction.h
+ * @brief RAII wrapper around an SQLite transaction
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef TRANSACTION_H
+#define TRANSACTION_H
+
+#include "DatabaseConnection.h"
+#include <stdexcept>
+
+/**
+ * @class Transaction
+ * @brief Scoped database transaction that rolls back unless committed
+ *
+ * Opens a transaction on construction and rolls it back on destruction if
+ * commit() was never reached, so an exception thrown half-way through a
+ * multi-statement write leaves no partial data behind.
+ *
+ * @par Usage Example
+ * @code
+ * Transaction transaction(db, Transaction::Mode::IMMEDIATE);
+ * db->executeNonQuery("INSERT INTO BOOKING (UserID, ShowTimeID) VALUES (?, ?)", {"1", "2"});
+ * db->executeNonQuery("INSERT INTO BOOKSEAT (BookingID, SeatID) VALUES (?, ?)", {"3", "A1"});
+ * transaction.commit(); // Without this line both inserts are rolled back
+ * @endcode
+ *
+ * @note Not copyable; transactions do not nest
+ * @see https://sqlite.org/lang_transaction.html
+ */
+class Transaction {
+public:
+    /**
+     * @enum Mode
+     * @brief Locking behaviour of BEGIN
+     */
+    enum class Mode {
+        DEFERRED,  ///< Take locks lazily on first read/write
+        IMMEDIATE, ///< Take the write lock up front; concurrent writers wait or fail with SQLITE_BUSY
+        EXCLUSIVE  ///< Like IMMEDIATE, and also blocks readers in rollback-journal mode
+    };
+
+private:
+    /**
+     * @brief Connection the transaction runs on
+     */
+    DatabaseConnection* conn;
+
+    /**
+     * @brief True between a successful BEGIN and commit()/rollback()
+     */
+    bool active;
+
+public:
+    /**
+     * @brief Begin a transaction
+     *
+     * @param conn Open database connection
+     * @param mode Locking mode of the BEGIN statement
+     *
+     * @throws std::runtime_error If the transaction cannot be started
+     */
+    explicit Transaction(DatabaseConnection* conn, Mode mode = Mode::DEFERRED) : conn(conn), active(false) {
+        const char* sql = "BEGIN DEFERRED";
+        if (mode == Mode::IMMEDIATE) {
+            sql = "BEGIN IMMEDIATE";
+        } else if (mode == Mode::EXCLUSIVE) {
+            sql = "BEGIN EXCLUSIVE";
+        }
+        if (!conn->executeNonQuery(sql)) {
+            throw std::runtime_error("Failed to begin database transaction");
+        }
+        active = true;
+    }
+
+    Transaction(const Transaction&) = delete;
+    Transaction& operator=(const Transaction&) = delete;
+
+    /**
+     * @brief Roll back the transaction if it is still open
+     */
+    ~Transaction() {
+        rollback();
+    }
+
+    /**
+     * @brief Make every change of the transaction durable
+     *
+     * @throws std::runtime_error If COMMIT fails; the transaction is rolled back
+     */
+    void commit() {
+        if (!active) {
+            return;
+        }
+        if (!conn->executeNonQuery("COMMIT")) {
+            rollback();
+            throw std::runtime_error("Failed to commit database transaction");
+        }
+        active = false;
+    }
+
+    /**
+     * @brief Discard every change of the transaction
+     *
+     * Safe to call more than once.
+     */
+    void rollback() {
+        if (active) {
+            conn->executeNonQuery("ROLLBACK");
+            active = false;
+        }
+    }
+};
+
+#endif
@@ -10,6 +10,7 @@
 #include "SingleSeat.h"
 #include "CoupleSeat.h"
 #include <string>
+#include <string_view>
 
 /**
  * @class SeatFactory
@@ -91,5 +92,18 @@ public:
         }
         return nullptr; // Return nullptr if seat type is not found
     }
+
+    /**
+     * @brief Maps a SEATTYPE name stored in the database to a SeatType
+     * 
+     * @param typeName Seat type name (e.g., "Single", "Couple")
+     * @return SeatType COUPLE for "Couple", SINGLE for "Single" and unknown names
+     */
+    static SeatType toSeatType(std::string_view typeName) {
+        if (typeName == "Couple") {
+            return COUPLE;
+        }
+        return SINGLE;
+    }
 };
 #endif
\ No newline at end of file
@@ -1,4 +1,151 @@
 #include "ShowTime.h"
+#include <stdexcept>
+
+namespace {
+    constexpr std::int64_t SECONDS_PER_DAY = ShowTime::SECONDS_PER_DAY;
+
+    // Reads exactly `count` ASCII digits starting at `pos`; -1 if any of them is not a digit
+    int readDigits(std::string_view text, std::size_t pos, std::size_t count) {
+        int value = 0;
+        for (std::size_t i = pos; i < pos + count; ++i) {
+            if (text[i] < '0' || text[i] > '9') {
+                return -1;
+            }
+            value = value * 10 + (text[i] - '0');
+        }
+        return value;
+    }
+
+    bool isLeapYear(int year) {
+        return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+
+    int daysInMonth(int year, int month) {
+        static const int DAYS[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        return month == 2 && isLeapYear(year) ? 29 : DAYS[month - 1];
+    }
+
+    // Days between 1970-01-01 and a proleptic Gregorian date (Howard Hinnant's days_from_civil)
+    std::int64_t daysFromCivil(int year, int month, int day) {
+        year -= month <= 2;
+        const std::int64_t era = (year >= 0 ? year : year - 399) / 400;
+        const unsigned yearOfEra = static_cast<unsigned>(year - era * 400);
+        const unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+        const unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+        return era * 146097 + static_cast<std::int64_t>(dayOfEra) - 719468;
+    }
+
+    // Inverse of daysFromCivil
+    void civilFromDays(std::int64_t days, int& year, int& month, int& day) {
+        days += 719468;
+        const std::int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+        const unsigned dayOfEra = static_cast<unsigned>(days - era * 146097);
+        const unsigned yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+        const unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+        const unsigned monthIndex = (5 * dayOfYear + 2) / 153;
+        day = static_cast<int>(dayOfYear - (153 * monthIndex + 2) / 5 + 1);
+        month = static_cast<int>(monthIndex < 10 ? monthIndex + 3 : monthIndex - 9);
+        year = static_cast<int>(yearOfEra + era * 400) + (month <= 2);
+    }
+
+    // Seconds into the day, also for times before 1970
+    std::int64_t secondOfDay(std::int64_t epochSeconds) {
+        std::int64_t seconds = epochSeconds % SECONDS_PER_DAY;
+        return seconds < 0 ? seconds + SECONDS_PER_DAY : seconds;
+    }
+
+    void appendTwoDigits(std::string& out, int value) {
+        out += static_cast<char>('0' + value / 10);
+        out += static_cast<char>('0' + value % 10);
+    }
+}
+
+ShowTime::ShowTime(int showTimeID, std::int64_t startsAt, std::int64_t endsAt)
+    : showTimeID(showTimeID), startsAt(startsAt), endsAt(endsAt) {}
 
 ShowTime::ShowTime(int showTimeID, const std::string& date, const std::string& startTime, const std::string& endTime)
-    : showTimeID(showTimeID), date(date), startTime(startTime), endTime(endTime) {}
\ No newline at end of file
+    : showTimeID(showTimeID) {
+    std::optional<std::int64_t> start = toEpoch(date, startTime);
+    std::optional<std::int64_t> end = toEndEpoch(date, startTime, endTime);
+    if (!start || !end) {
+        throw std::invalid_argument("Invalid showtime: " + date + " " + startTime + " - " + endTime);
+    }
+    startsAt = *start;
+    endsAt = *end;
+}
+
+std::optional<std::int64_t> ShowTime::parseDate(std::string_view date) {
+    if (date.size() != 10 || date[4] != '-' || date[7] != '-') {
+        return std::nullopt;
+    }
+    int year = readDigits(date, 0, 4);
+    int month = readDigits(date, 5, 2);
+    int day = readDigits(date, 8, 2);
+    if (year < 0 || month < 1 || month > 12 || day < 1 || day > daysInMonth(year, month)) {
+        return std::nullopt;
+    }
+    return daysFromCivil(year, month, day) * SECONDS_PER_DAY;
+}
+
+std::optional<int> ShowTime::parseTimeOfDay(std::string_view time) {
+    if ((time.size() != 5 && time.size() != 8) || time[2] != ':' || (time.size() == 8 && time[5] != ':')) {
+        return std::nullopt;
+    }
+    int hours = readDigits(time, 0, 2);
+    int minutes = readDigits(time, 3, 2);
+    int seconds = time.size() == 8 ? readDigits(time, 6, 2) : 0;
+    if (hours < 0 || hours > 23 || minutes < 0 || minutes > 59 || seconds < 0 || seconds > 59) {
+        return std::nullopt;
+    }
+    return hours * 3600 + minutes * 60 + seconds;
+}
+
+std::optional<std::int64_t> ShowTime::toEpoch(std::string_view date, std::string_view time) {
+    std::optional<std::int64_t> midnight = parseDate(date);
+    std::optional<int> seconds = parseTimeOfDay(time);
+    if (!midnight || !seconds) {
+        return std::nullopt;
+    }
+    return *midnight + *seconds;
+}
+
+std::optional<std::int64_t> ShowTime::toEndEpoch(std::string_view date, std::string_view startTime,
+                                                 std::string_view endTime) {
+    std::optional<std::int64_t> midnight = parseDate(date);
+    std::optional<int> start = parseTimeOfDay(startTime);
+    std::optional<int> end = parseTimeOfDay(endTime);
+    if (!midnight || !start || !end) {
+        return std::nullopt;
+    }
+    return *midnight + *end + (*end < *start ? SECONDS_PER_DAY : 0);
+}
+
+std::string ShowTime::formatDate(std::int64_t epochSeconds) {
+    int year = 0, month = 0, day = 0;
+    civilFromDays((epochSeconds - secondOfDay(epochSeconds)) / SECONDS_PER_DAY, year, month, day);
+
+    std::string out;
+    out.reserve(10);
+    appendTwoDigits(out, year / 100 % 100);
+    appendTwoDigits(out, year % 100);
+    out += '-';
+    appendTwoDigits(out, month);
+    out += '-';
+    appendTwoDigits(out, day);
+    return out;
+}
+
+std::string ShowTime::formatTime(std::int64_t epochSeconds) {
+    int seconds = static_cast<int>(secondOfDay(epochSeconds));
+
+    std::string out;
+    out.reserve(8);
+    appendTwoDigits(out, seconds / 3600);
+    out += ':';
+    appendTwoDigits(out, seconds / 60 % 60);
+    if (seconds % 60 != 0) {
+        out += ':';
+        appendTwoDigits(out, seconds % 60);
+    }
+    return out;
+}
@@ -8,7 +8,10 @@
 
 #ifndef _SHOWTIME_H_
 #define _SHOWTIME_H_
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
 
 /**
  * @struct ShowTime
@@ -21,19 +24,23 @@
  * @details
  * Key Features:
  * - Unique showtime identification
- * - Complete temporal scheduling information
- * - Date and time management for movie screenings
- * - Integration with booking and reservation systems
+ * - Start and end as integer epoch seconds: sorting, range queries and
+ *   overlap checks are integer comparisons, and a ShowTime is a few bytes
+ *   with no heap allocation
+ * - Text ("YYYY-MM-DD", "HH:MM") only at the edges: hand-written parsing
+ *   of user input and formatting for display or the network protocol
+ * 
+ * Times are wall-clock times of the cinema, counted as if they were UTC
+ * (no time zone or daylight saving conversion), which is also how SQLite's
+ * unixepoch() reads the "YYYY-MM-DD HH:MM" text it is given.
  * 
  * Design Patterns:
  * - **Value Object**: Immutable data container for showtime information
  * - **Data Transfer Object (DTO)**: Transfers showtime data between layers
- * - **Composite**: Combines multiple temporal attributes into single entity
  * 
  * Usage Context:
  * - Movie scheduling and timetable management
  * - Booking system reservation handling
- * - Theater capacity and availability tracking
  * - User interface showtime display
  * 
  * @par Usage Example
@@ -41,22 +48,25 @@
  * ShowTime evening(101, "2025-06-15", "19:30", "22:00");
  * 
  * std::cout << "Showtime ID: " << evening.showTimeID << std::endl;
- * std::cout << "Date: " << evening.date << std::endl;
- * std::cout << "Duration: " << evening.startTime << " - " << evening.endTime << std::endl;
+ * std::cout << "Date: " << evening.date() << std::endl;
+ * std::cout << "Duration: " << evening.startTime() << " - " << evening.endTime() << std::endl;
  * 
- * // Use in booking context
- * bookingService->reserveSeats(evening.showTimeID, selectedSeats);
+ * // Comparisons need no parsing
+ * bool later = evening.startsAt > matinee.startsAt;
  * @endcode
  * 
- * @note All time values should follow consistent format standards
  * @warning Ensure start time is before end time for data integrity
  * 
  * @see Movie
  * @see Booking
  * @see IBookingService
- * @see Theater
  */
 struct ShowTime {
+    /**
+     * @brief Length of a calendar day (no leap seconds, no daylight saving)
+     */
+    static constexpr std::int64_t SECONDS_PER_DAY = 86400;
+
     /**
      * @brief Unique showtime identifier
      * 
@@ -69,90 +79,49 @@ struct ShowTime {
     int showTimeID;
     
     /**
-     * @brief Date of the movie showing
+     * @brief Start of the screening, in seconds since 1970-01-01 00:00
      * 
-     * The calendar date when this movie screening is scheduled.
-     * Format should be consistent across the system (e.g., "YYYY-MM-DD").
+     * Stored as is in SHOWTIME.StartsAt.
      * 
-     * @par Expected Format
-     * - ISO 8601 date format: "YYYY-MM-DD"
-     * - Example: "2025-06-15"
-     * 
-     * @note Date format should be validated for consistency
-     * @see startTime, endTime for complete scheduling information
+     * @pre Must be earlier than endsAt
+     * @see startTime() and date() for display
      */
-    std::string date;
+    std::int64_t startsAt;
     
     /**
-     * @brief Movie start time
-     * 
-     * The time when the movie screening begins on the scheduled date.
-     * Should include sufficient lead time for previews and announcements.
+     * @brief End of the screening, in seconds since 1970-01-01 00:00
      * 
-     * @par Expected Format
-     * - 24-hour format: "HH:MM"
-     * - Example: "19:30" for 7:30 PM
+     * Stored as is in SHOWTIME.EndsAt. Includes movie duration plus
+     * credits and buffer time.
      * 
-     * @pre Must be earlier than endTime
-     * @note Time format should be validated and consistent
-     * @see endTime for screening duration calculation
+     * @pre Must be later than startsAt
+     * @see endTime() for display
      */
-    std::string startTime;
-    
+    std::int64_t endsAt;
+
     /**
-     * @brief Movie end time
-     * 
-     * The time when the movie screening is expected to conclude.
-     * Includes movie duration plus credits and buffer time.
-     * 
-     * @par Expected Format
-     * - 24-hour format: "HH:MM"
-     * - Example: "22:00" for 10:00 PM
+     * @brief Construct a showtime from epoch seconds
      * 
-     * @pre Must be later than startTime
-     * @post Allows calculation of screening duration
-     * 
-     * @note Should account for full movie duration plus credits
-     * @see startTime for complete time range
+     * @param showTimeID Unique identifier for this showtime
+     * @param startsAt Start, in seconds since the epoch
+     * @param endsAt End, in seconds since the epoch
      */
-    std::string endTime;
+    ShowTime(int showTimeID, std::int64_t startsAt, std::int64_t endsAt);
 
     /**
-     * @brief Parameterized constructor
-     * 
-     * Creates a new showtime with all scheduling information specified.
-     * Initializes all temporal attributes for the movie screening.
+     * @brief Construct a showtime from its date and times as text
      * 
      * @param showTimeID Unique identifier for this showtime
      * @param date Date of screening (format: "YYYY-MM-DD")
-     * @param startTime Movie start time (format: "HH:MM")
-     * @param endTime Movie end time (format: "HH:MM")
+     * @param startTime Movie start time (format: "HH:MM" or "HH:MM:SS")
+     * @param endTime Movie end time; on the next day if earlier than startTime (see toEndEpoch())
      * 
-     * @pre showTimeID > 0 for valid showtimes
-     * @pre date is in valid format and not in the past
-     * @pre startTime is in valid format and before endTime
-     * @pre endTime is in valid format and after startTime
-     * @post All showtime attributes are initialized
-     * 
-     * @throws std::invalid_argument If any parameter is invalid
-     * 
-     * @par Validation Considerations
-     * - Verify date is not in the past
-     * - Ensure start time precedes end time
-     * - Validate time format consistency
-     * - Check for scheduling conflicts
+     * @throws std::invalid_argument If the date or a time is not valid
      * 
      * @par Example
      * @code
-     * // Create evening showtime
      * ShowTime eveningShow(101, "2025-06-15", "19:30", "22:00");
-     * 
-     * // Create matinee showtime
-     * ShowTime matineeShow(102, "2025-06-15", "14:00", "16:30");
      * @endcode
-     * 
-     * @note Constructor should validate input parameters for data integrity
-     * @see Default constructor (if needed for STL containers)
      */
     ShowTime(int showTimeID, const std::string& date, const std::string& startTime, const std::string& endTime);
     
@@ -163,12 +132,69 @@ struct ShowTime {
      * and scenarios where showtime data will be assigned later.
      * 
      * @post showTimeID == 0 (invalid state)
-     * @post All string fields are empty
      * 
-     * @note Requires subsequent initialization before use
      * @warning Object is in invalid state until properly initialized
      */
-    ShowTime() : showTimeID(0) {}
+    ShowTime() : showTimeID(0), startsAt(0), endsAt(0) {}
+
+    /**
+     * @brief Date of the screening, "YYYY-MM-DD"
+     */
+    std::string date() const { return formatDate(startsAt); }
+
+    /**
+     * @brief Start time, "HH:MM" (":SS" appended if the seconds are not zero)
+     */
+    std::string startTime() const { return formatTime(startsAt); }
+
+    /**
+     * @brief End time, "HH:MM" (":SS" appended if the seconds are not zero)
+     */
+    std::string endTime() const { return formatTime(endsAt); }
+
+    /**
+     * @brief Epoch seconds of midnight at the start of a "YYYY-MM-DD" date
+     * 
+     * @return std::nullopt unless the text is exactly 4-2-2 digits forming a
+     *         real calendar date (month 01-12, day valid for the month and year)
+     */
+    static std::optional<std::int64_t> parseDate(std::string_view date);
+
+    /**
+     * @brief Seconds since midnight of a "HH:MM" or "HH:MM:SS" time
+     * 
+     * @return std::nullopt unless hours are 00-23 and minutes and seconds 00-59
+     */
+    static std::optional<int> parseTimeOfDay(std::string_view time);
+
+    /**
+     * @brief Epoch seconds of a date and a time of that day
+     * 
+     * @return std::nullopt if either part is invalid (see parseDate(), parseTimeOfDay())
+     */
+    static std::optional<std::int64_t> toEpoch(std::string_view date, std::string_view time);
+
+    /**
+     * @brief Epoch seconds of the end of a show given by its date and two times of day
+     * 
+     * Only the start carries a date, so an end time earlier than the start
+     * time is on the next day: "22:00" to "00:30" lasts two and a half hours.
+     * Schema migration v6 reads the old TEXT columns the same way.
+     * 
+     * @return std::nullopt if the date or either time is invalid
+     */
+    static std::optional<std::int64_t> toEndEpoch(std::string_view date, std::string_view startTime,
+                                                  std::string_view endTime);
+
+    /**
+     * @brief "YYYY-MM-DD" of an epoch time
+     */
+    static std::string formatDate(std::int64_t epochSeconds);
+
+    /**
+     * @brief "HH:MM" of an epoch time, or "HH:MM:SS" if the seconds are not zero
+     */
+    static std::string formatTime(std::int64_t epochSeconds);
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -1,14 +1,24 @@
 #include "AuthenticationRepositorySQL.h"
 #include <stdexcept>
+#include <utility>
+
+AuthenticationRepositorySQL::AuthenticationRepositorySQL(std::shared_ptr<ConnectionPool> pool) : pool(std::move(pool)) {
+    if (!this->pool) {
+        throw std::invalid_argument("[AuthenticationRepoSQL] A connection pool is required");
+    }
+}
 
 void AuthenticationRepositorySQL::addUser(const AccountInformation& info) {
     std::string sql = "INSERT INTO ACCOUNT (Password, RoleUser, Gmail, PhoneNumber, UserName) VALUES (?, ?, ?, ?, ?)";
-    dbConn->executeNonQuery(sql, {info.password, info.role, info.gmail, info.phoneNumber, info.userName});
+    // Fails on a duplicate user name once the UNIQUE index of schema v3 exists
+    if (!pool->writer()->executeNonQuery(sql, {info.password, info.role, info.gmail, info.phoneNumber, info.userName})) {
+        throw std::runtime_error("[AuthenticationRepoSQL] Could not create account for " + info.userName);
+    }
 }
 
 AccountInformation AuthenticationRepositorySQL::getUserByUserName(const std::string& username, const std::string& password) {
     std::string sql = "SELECT * FROM ACCOUNT WHERE UserName = ? AND Password = ?";
-    auto results = dbConn->executeQuery(sql, {username, password});
+    auto results = pool->reader()->executeQuery(sql, {username, password});
     if (results.empty()) throw std::runtime_error("[AuthenticationRepoSQL] Invalid username or password");
 
     AccountInformation info;
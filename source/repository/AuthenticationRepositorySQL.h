@@ -10,7 +10,8 @@
 #define AUTH_REPO_SQL_H
 
 #include "IAuthenticationRepository.h"
-#include "DatabaseConnection.h"
+#include "ConnectionPool.h"
+#include <memory>
 
 /**
  * @class AuthenticationRepositorySQL
@@ -29,7 +30,7 @@
  * 
  * Design Patterns:
  * - **Repository Pattern**: Concrete implementation of IAuthenticationRepository
- * - **Dependency Injection**: Accepts DatabaseConnection for data access
+ * - **Dependency Injection**: Accepts a shared ConnectionPool for data access
  * - **Data Access Object (DAO)**: Encapsulates database access logic
  * - **Strategy Pattern**: Implements specific authentication strategy
  * 
@@ -41,8 +42,8 @@
  * 
  * @par Usage Example
  * @code
- * DatabaseConnection* db = DatabaseConnection::getInstance();
- * auto authRepo = std::make_unique<AuthenticationRepositorySQL>(db);
+ * auto pool = std::make_shared<ConnectionPool>("database.db");
+ * auto authRepo = std::make_unique<AuthenticationRepositorySQL>(pool);
  * 
  * // Add new user
  * AccountInformation newUser{0, "john_doe", "hashed_password", 
@@ -57,45 +58,38 @@
  * @endcode
  * 
  * @note Passwords should be hashed before storage for security
- * @warning Ensure database connection is valid before use
  * 
  * @see IAuthenticationRepository
- * @see DatabaseConnection
+ * @see ConnectionPool
  * @see AccountInformation
  * @see ILoginService
  */
 class AuthenticationRepositorySQL : public IAuthenticationRepository {
 private:
     /**
-     * @brief Database connection for SQL operations
+     * @brief Connections for SQL operations
      * 
-     * Pointer to the database connection used for all authentication
-     * related database operations. Managed externally by caller.
-     * 
-     * @note Connection lifetime must exceed repository lifetime
-     * @warning Do not delete this pointer - it's managed externally
+     * Logins lease a reader, registrations lease the writer.
+     * Shared with the other repositories of the application.
      */
-    DatabaseConnection* dbConn;
+    std::shared_ptr<ConnectionPool> pool;
 
 public:
     /**
-     * @brief Constructor with database connection injection
+     * @brief Constructor with connection pool injection
      * 
-     * Initializes the repository with a database connection for
-     * performing authentication operations.
+     * Initializes the repository with the pool it leases connections
+     * from for performing authentication operations.
      * 
-     * @param db Valid database connection pointer
+     * @param pool Connection pool, shared with the other repositories
      * 
-     * @pre db != nullptr
-     * @pre Database connection is established and functional
      * @post Repository is ready for authentication operations
      * 
-     * @note Database connection is not owned by this repository
-     * @warning Caller must ensure database connection remains valid
+     * @throws std::invalid_argument If pool is null
      * 
-     * @see DatabaseConnection
+     * @see ConnectionPool
      */
-    AuthenticationRepositorySQL(DatabaseConnection* db) : dbConn(db) {}
+    explicit AuthenticationRepositorySQL(std::shared_ptr<ConnectionPool> pool);
 
     /**
      * @brief Add a new user account to the database
@@ -1,12 +1,32 @@
 #include "BookingRepositorySQL.h"
-#include "../model/SeatFactory.h"
 #include "../model/Booking.h"
+#include <unordered_set>
+#include <utility>
 
-BookingRepository::BookingRepository(std::string dbFilePath) {
-    _dbConnection = DatabaseConnection::getInstance();
-    if (!_dbConnection->connect(dbFilePath)) {
-        throw std::runtime_error("Failed to connect to the database.");
+namespace {
+    // "?, ?, ?" with one placeholder per value
+    std::string placeholders(std::size_t count) {
+        std::string result;
+        for (std::size_t i = 0; i < count; ++i) {
+            result += (i == 0) ? "?" : ", ?";
+        }
+        return result;
+    }
+}
+
+BookingRepository::BookingRepository(std::shared_ptr<ConnectionPool> pool) : _pool(std::move(pool)) {
+    if (!_pool) {
+        throw std::invalid_argument("BookingRepository needs a connection pool.");
     }
+    auto db = _pool->reader();
+    _seatCatalog = SeatCatalog::load(db.get());
+    _inventory = std::make_unique<SeatInventory>(_seatCatalog);
+    _inventory->load(db.get());
+    _holds = std::make_unique<SeatHoldManager>(_seatCatalog);
+}
+
+BookingRepository::BookingRepository(std::string dbFilePath)
+    : BookingRepository(std::make_shared<ConnectionPool>(dbFilePath)) {
 }
 
 BookingRepository::~BookingRepository() {
@@ -16,7 +36,8 @@ BookingRepository::~BookingRepository() {
 void BookingRepository::addBooking(const int& userID, const int& showTimeID) {
     std::string sql_stmt = "insert into booking (UserID, ShowTimeID) values (?, ?)";
     std::vector<std::string> params = {std::to_string(userID), std::to_string(showTimeID)};
-    if (!_dbConnection->executeNonQuery(sql_stmt, params)) {
+    auto db = _pool->writer();
+    if (!db->executeNonQuery(sql_stmt, params)) {
         throw std::runtime_error(
             std::format("fail to create booking for showTimeID : {}, please try again later.\n", showTimeID)
         );
@@ -25,136 +46,203 @@ void BookingRepository::addBooking(const int& userID, const int& showTimeID) {
 
 
 void BookingRepository::addBookedSeats(const int& bookingID, const std::vector<std::string>& bookedSeats) {
-    std::string sql_stmt = "insert into BOOKSEAT (BookingID, SeatID) values (?, ?)";
-    for (const auto& seatID : bookedSeats) {
-        std::vector<std::string> params = {std::to_string(bookingID), seatID};  
-        if (!_dbConnection->executeNonQuery(sql_stmt, params)) {
+    if (bookedSeats.empty()) {
+        return;
+    }
+    auto db = _pool->writer();
+    Transaction transaction(db.get(), Transaction::Mode::IMMEDIATE);
+    int showTimeID = 0;
+    {
+        auto cursor = db->query("select ShowTimeID from BOOKING where BookingID = ?", {std::to_string(bookingID)});
+        if (cursor.next()) {
+            showTimeID = cursor.row().getInt(0);
+        }
+    }
+    insertBookedSeats(db.get(), bookingID, bookedSeats);
+    transaction.commit();
+    _inventory->markBooked(showTimeID, bookedSeats);
+}
+
+void BookingRepository::insertBookedSeats(DatabaseConnection* db, const int& bookingID, const std::vector<std::string>& bookedSeats) {
+    std::string sql_stmt = "insert into BOOKSEAT (BookingID, SeatID) values ";
+    std::vector<std::string> params;
+    params.reserve(bookedSeats.size() * 2);
+    std::string id = std::to_string(bookingID);
+    for (std::size_t i = 0; i < bookedSeats.size(); ++i) {
+        sql_stmt += (i == 0) ? "(?, ?)" : ", (?, ?)";
+        params.push_back(id);
+        params.push_back(bookedSeats[i]);
+    }
+    if (!db->executeNonQuery(sql_stmt, params)) {
+        throw std::runtime_error(
+            std::format("Failed to book seats for bookingID : {}\n", bookingID)
+        );
+    }
+}
+
+int BookingRepository::createBooking(const int& userID, const int& showTimeID, const std::vector<std::string>& seats) {
+    if (seats.empty()) {
+        throw std::invalid_argument("At least one seat is required to create a booking.");
+    }
+    std::unordered_set<std::string> unique(seats.begin(), seats.end());
+    if (unique.size() != seats.size()) {
+        throw std::invalid_argument("The same seat cannot be booked twice in one booking.");
+    }
+
+    // Seats already known to be taken are rejected without locking the database
+    std::vector<std::string> taken = _inventory->bookedAmong(showTimeID, seats);
+    if (!taken.empty()) {
+        throw SeatUnavailableException(showTimeID, std::move(taken));
+    }
+    // Seats another customer is still choosing are not up for grabs either
+    taken = _holds->heldByOthers(showTimeID, seats, userID);
+    if (!taken.empty()) {
+        throw SeatUnavailableException(showTimeID, std::move(taken));
+    }
+
+    // IMMEDIATE takes the write lock now, so nobody can book between the check and the insert
+    auto db = _pool->writer();
+    Transaction transaction(db.get(), Transaction::Mode::IMMEDIATE);
+
+    std::vector<std::string> params = {std::to_string(showTimeID)};
+    params.insert(params.end(), seats.begin(), seats.end());
+    std::string conflict_stmt = "select bs.SeatID from BOOKSEAT bs "
+                                "join BOOKING b on b.BookingID = bs.BookingID "
+                                "where b.ShowTimeID = ? and bs.SeatID in (" + placeholders(seats.size()) + ") "
+                                "order by bs.SeatID";
+    if (!db->forEachRow(conflict_stmt, params, [&taken](const ResultRow& row) {
+            taken.push_back(row.getString(0));
+        })) {
+        throw std::runtime_error(
+            std::format("Failed to check seats for showTimeID : {}\n", showTimeID)
+        );
+    }
+    if (!taken.empty()) {
+        throw SeatUnavailableException(showTimeID, std::move(taken));
+    }
+
+    {
+        std::string seat_stmt = "select count(*) from SEAT where SeatID in (" + placeholders(seats.size()) + ")";
+        auto cursor = db->query(seat_stmt, seats);
+        if (!cursor.next() || cursor.row().getInt64(0) != static_cast<std::int64_t>(seats.size())) {
+            throw std::invalid_argument("Booking contains unknown seats.");
+        }
+    }
+
+    int bookingID = 0;
+    {
+        auto cursor = db->query(
+            "insert into BOOKING (UserID, ShowTimeID) values (?, ?) returning BookingID",
+            {std::to_string(userID), std::to_string(showTimeID)}
+        );
+        if (cursor.next()) {
+            bookingID = cursor.row().getInt(0);
+        }
+        while (cursor.next()) {
+            // Step to SQLITE_DONE so the insert is complete before continuing
+        }
+        if (!cursor.ok() || bookingID == 0) {
             throw std::runtime_error(
-                std::format("Failed to book seat {}\n", seatID)
+                std::format("fail to create booking for showTimeID : {}, please try again later.\n", showTimeID)
             );
         }
     }
+
+    insertBookedSeats(db.get(), bookingID, seats);
+    transaction.commit();
+    _inventory->markBooked(showTimeID, seats);
+    _holds->release(showTimeID, seats, userID);
+    return bookingID;
+}
+
+bool BookingRepository::holdSeat(const int& userID, const int& showTimeID, const std::string& seatID) {
+    if (_inventory->isBooked(showTimeID, seatID)) {
+        return false;
+    }
+    return _holds->hold(showTimeID, seatID, userID);
+}
+
+bool BookingRepository::releaseSeat(const int& userID, const int& showTimeID, const std::string& seatID) {
+    return _holds->release(showTimeID, seatID, userID);
+}
+
+void BookingRepository::releaseHolds(const int& userID) {
+    _holds->releaseAll(userID);
 }
 
 std::vector<BookingView> BookingRepository::viewAllBookings(const int& userID) {
-    std::string sql_stmt = "select b.BookingID, st.ShowTimeID, st.Date, st.StartTime, st.EndTime, m.Title, m.MovieID, bs.SeatID, s.SeatType, s.Price "
+    std::vector<BookingView> bookings;
+    forEachBooking(userID, [&bookings](BookingView&& booking) {
+        bookings.push_back(std::move(booking));
+    });
+    return bookings;
+}
+
+void BookingRepository::forEachBooking(const int& userID, const std::function<void(BookingView&&)>& visitor) {
+    std::string sql_stmt = "select b.BookingID, st.ShowTimeID, st.StartsAt, st.EndsAt, m.Title, m.MovieID, bs.SeatID "
                            "from BOOKING b "
                            "join SHOWTIME st on st.ShowTimeID = b.ShowTimeID "
                            "join MOVIE m on m.MovieID = st.MovieID "
                            "join BOOKSEAT bs on bs.BookingID = b.BookingID "
-                           "join SEAT s on s.SeatID = bs.SeatID "
-                           "where b.UserID = ?";
+                           "where b.UserID = ? "
+                           "order by b.BookingID, bs.SeatID";
     std::vector<std::string> params = {std::to_string(userID)};
-    auto result = _dbConnection->executeQuery(sql_stmt, params);    
-    std::map<int, Booking> bookingDetails;
-    std::map<int, std::vector<std::shared_ptr<ISeat>>> seatsByBooking;
-    
-    for (const auto& row : result) {
-        int bookingID = std::stoi(row.at("BookingID"));
-        if (bookingDetails.find(bookingID) == bookingDetails.end()) {
-          
-            bookingDetails.emplace(
-                std::piecewise_construct,
-                std::forward_as_tuple(bookingID),
-                std::forward_as_tuple(
-                    bookingID,
-                    std::stoi(row.at("MovieID")),
-                    row.at("Title"),
-                    ShowTime(
-                        std::stoi(row.at("ShowTimeID")),
-                        row.at("Date"),
-                        row.at("StartTime"), 
-                        row.at("EndTime")
-                    )
-                )
+    auto db = _pool->reader();
+    auto cursor = db->query(sql_stmt, params);
+
+    // Rows arrive grouped by BookingID, so only the booking being built is kept
+    BookingView current;
+    int currentID = 0;
+    for (const ResultRow& row : cursor) {
+        int bookingID = row.getInt(0);
+        if (bookingID != currentID) {
+            if (currentID != 0) {
+                visitor(std::move(current));
+            }
+            current = BookingView(
+                bookingID,
+                row.getInt(5),
+                row.getString(4),
+                ShowTime(
+                    row.getInt(1),
+                    row.getInt64(2),
+                    row.getInt64(3)
+                ),
+                {},
+                0.0f
             );
-        }      
-
-        SeatType seatType;
-        std::string seatTypeStr = row.at("SeatType");
-        if (seatTypeStr == "Single") {
-            seatType = SeatType::SINGLE;
-        } else if (seatTypeStr == "Couple") {
-            seatType = SeatType::COUPLE;
-        } else {
-            seatType = SeatType::SINGLE;
+            currentID = bookingID;
         }
-        
-        float price = std::stof(row.at("Price"));
-        SeatFactory seatFactory;
-        ISeat* temp = seatFactory.createSeat(row.at("SeatID"), seatType, price);
-        std::shared_ptr<ISeat> seat(temp);
-        seatsByBooking[bookingID].push_back(seat);
-    }  
 
-    std::vector<BookingView> bookings;
-    for (const auto& pair : bookingDetails) {
-        int bookingID = pair.first;
-        Booking booking = pair.second;
-        float totalPrice = 0;
-        for (const auto& seat : seatsByBooking[bookingID]) {
-            totalPrice += seat->price();
-        }        
-          bookings.emplace_back(
-            bookingID, 
-            booking.movieID,
-            booking.movieTitle,
-            booking.showTime,
-            seatsByBooking[bookingID],
-            totalPrice
-        );
+        // Seat details come from the catalog instead of being rebuilt per row
+        const ISeat* seat = _seatCatalog->find(row.getText(6));
+        if (!seat) {
+            continue;
+        }
+        current.totalPrice += seat->price();
+        current.bookedSeats.push_back(seat);
+    }
+    if (currentID != 0) {
+        visitor(std::move(current));
     }
 
-    return bookings;
+    if (!cursor.ok()) {
+        throw std::runtime_error(
+            std::format("Failed to read bookings for userID : {}\n", userID)
+        );
+    }
 }
 
 std::vector<SeatView> BookingRepository::viewSeatsStatus(const int& showTimeID) {
-    std::string sql_stmt = "select SeatID, SeatType, Price from SEAT";
-    auto seatInfo = _dbConnection->executeQuery(sql_stmt, {});
-    sql_stmt = "select SeatID from BOOKSEAT "
-            "join BOOKING b on b.BookingID = BOOKSEAT.BookingID "
-            "where ShowTimeID = ?";
-    std::vector<std::string> params = {std::to_string(showTimeID)};
-    auto bookedSeats = _dbConnection->executeQuery(sql_stmt, params);
-    std::map<std::string, bool> bookedSeatsMap;
-    for (const auto& row : bookedSeats) {
-        bookedSeatsMap[row.at("SeatID")] = true;
-    }    
-    std::map<std::string, SeatView> seatDetails;
-    for (const auto& row : seatInfo) {
-        std::string seatID = row.at("SeatID");
-        SeatType seatType;
-        std::string seatTypeStr = row.at("SeatType");
-        if (seatTypeStr == "Single") {
-            seatType = SeatType::SINGLE;
-        } else if (seatTypeStr == "Couple") {
-            seatType = SeatType::COUPLE;
-        } else {
-            seatType = SeatType::SINGLE; // Giá trị mặc định
-        }
-        
-        float price = std::stof(row.at("Price"));
-        SeatFactory seatFactory;
-        ISeat* temp = seatFactory.createSeat(seatID, seatType, price);
-        std::shared_ptr<ISeat> seat(temp);
-        SeatStatus status = bookedSeatsMap[seatID] ? SeatStatus::BOOKED : SeatStatus::AVAILABLE;
-        seatDetails.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(seatID),
-            std::forward_as_tuple(seat, status)
-        );
-    }
-    std::vector<SeatView> seatsView;
-    for (const auto& pair : seatDetails) {
-        seatsView.push_back(pair.second);
-    }
-    return seatsView;
+    std::vector<SeatView> seats = _inventory->seatsStatus(showTimeID);
+    _holds->markHeld(showTimeID, seats);
+    return seats;
 }
 
 int BookingRepository::getLatestBookingID(const int& userID) {
     std::string sql_stmt = "select BookingID from BOOKING where UserID = ? order by BookingID desc limit 1";
     std::vector<std::string> params = {std::to_string(userID)};
-    auto result = _dbConnection->executeQuery(sql_stmt, params);
+    auto result = _pool->reader()->executeQuery(sql_stmt, params);
     if (result.empty()) {
         return 0; // No bookings found
     }
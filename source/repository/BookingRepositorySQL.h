@@ -9,7 +9,11 @@
 #ifndef _BOOKINGREPOSITORY_H_
 #define _BOOKINGREPOSITORY_H_
 #include "IBookingRepository.h"
-#include "../database/DatabaseConnection.h"
+#include "SeatCatalog.h"
+#include "SeatInventory.h"
+#include "SeatHoldManager.h"
+#include "../database/ConnectionPool.h"
+#include "../database/Transaction.h"
 #include "../model/ShowTime.h"
 #include "../model/Booking.h"
 #include <stdexcept>
@@ -49,58 +53,144 @@
  * @code
  * auto bookingRepo = std::make_unique<BookingRepository>("database.db");
  * 
- * // Create a booking
- * bookingRepo->addBooking(userId, showTimeId);
- * int bookingId = bookingRepo->getLatestBookingID(userId);
- * 
- * // Reserve seats
+ * // Create a booking with its seats in one transaction
  * std::vector<std::string> seats = {"A1", "A2"};
- * bookingRepo->addBookedSeats(bookingId, seats);
+ * int bookingId = bookingRepo->createBooking(userId, showTimeId, seats);
  * 
  * // View booking history
  * auto bookings = bookingRepo->viewAllBookings(userId);
  * @endcode
  * 
  * @note All operations are transactional to ensure data consistency
- * @warning Database connection must remain valid throughout repository lifetime
+ * @note Safe to call from several threads: each call leases its own connection
  * 
  * @see IBookingRepository
  * @see BookingView
  * @see SeatView
- * @see DatabaseConnection
+ * @see ConnectionPool
  */
 class BookingRepository : public IBookingRepository {
 private:
     /**
-     * @brief Database connection for booking operations
+     * @brief Connections for booking operations
+     * 
+     * History queries lease a reader; bookings lease the single writer, so
+     * seat maps and history keep being served while a booking commits.
+     * 
+     * @note Shared with the other repositories of the application
+     */
+    std::shared_ptr<ConnectionPool> _pool;
+
+    /**
+     * @brief Seat objects shared by every SeatView and BookingView
+     * 
+     * Loaded once in the constructor. Views returned by this repository
+     * point into it, so they must not outlive the repository.
+     */
+    std::shared_ptr<const SeatCatalog> _seatCatalog;
+
+    /**
+     * @brief In-memory booked-seat bitsets, warmed in the constructor
+     * 
+     * Serves viewSeatsStatus() without SQL and is updated after every
+     * committed booking write made through this repository.
+     */
+    std::unique_ptr<SeatInventory> _inventory;
+
+    /**
+     * @brief Seats held by users who are still selecting, with a TTL
      * 
-     * Pointer to the database connection used for all booking-related
-     * database operations. Initialized during construction.
+     * Overlaid on the inventory by viewSeatsStatus() and checked by
+     * createBooking() before the write lock is taken.
+     */
+    std::unique_ptr<SeatHoldManager> _holds;
+
+    /**
+     * @brief Insert all seats of a booking with one multi-row INSERT
+     * 
+     * @param db Writer connection leased by the caller
+     * @param bookingID Booking the seats belong to
+     * @param bookedSeats Seat IDs to insert
      * 
-     * @note Repository owns and manages this connection
+     * @throws std::runtime_error If the insert fails
+     * 
+     * @note Must run inside a transaction opened by the caller on db
      */
-    DatabaseConnection* _dbConnection;
+    void insertBookedSeats(DatabaseConnection* db, const int& bookingID, const std::vector<std::string>& bookedSeats);
 
 public:
+    /**
+     * @brief Constructor with a shared connection pool
+     * 
+     * @param pool Pool lending the reader and writer connections
+     * 
+     * @post Seat catalog and seat inventory are loaded from the database
+     * @post Repository is ready for booking operations
+     * 
+     * @throws std::invalid_argument If pool is null
+     * @throws std::runtime_error If inventory loading fails
+     * 
+     * @see ConnectionPool
+     */
+    explicit BookingRepository(std::shared_ptr<ConnectionPool> pool);
+
     /**
      * @brief Constructor with database file path
      * 
-     * Initializes the booking repository with a database connection
-     * to the specified SQLite database file.
+     * Opens a private ConnectionPool on the specified SQLite database file.
      * 
      * @param dbFilePath Path to the SQLite database file
      * 
-     * @pre Database file path is valid and accessible
-     * @post Database connection is established
-     * @post Repository is ready for booking operations
-     * 
-     * @throws std::runtime_error If database connection fails
+     * @throws std::runtime_error If database connection or inventory loading fails
      * 
      * @note Creates database file if it doesn't exist
-     * @see DatabaseConnection
      */
     BookingRepository(std::string dbFilePath);
     
+    /**
+     * @brief Create a booking and reserve its seats atomically
+     * 
+     * Runs inside one BEGIN IMMEDIATE transaction, which takes the database
+     * write lock up front so concurrent buyers are serialized:
+     * - Rejects seats the in-memory inventory already knows to be booked,
+     *   or that another user holds, without touching the database
+     * - Rejects the request if any seat is already booked for the showtime
+     * - Inserts the BOOKING row and reads its ID back with RETURNING
+     * - Inserts every BOOKSEAT row with a single multi-row statement
+     * - Commits once, so the whole booking costs a single fsync
+     * - Marks the seats in the inventory after the commit and releases
+     *   the user's holds on them
+     * 
+     * @param userID Unique identifier of the user making the booking
+     * @param showTimeID Unique identifier of the movie showtime
+     * @param seats Seat IDs to reserve
+     * @return int Identifier of the new booking
+     * 
+     * @throws std::invalid_argument If seats is empty, has duplicates or unknown seats
+     * @throws SeatUnavailableException If any seat is already booked or held by another user
+     * @throws std::runtime_error If the transaction fails
+     */
+    int createBooking(const int& userID, const int& showTimeID, const std::vector<std::string>& seats) override;
+
+    /**
+     * @brief Hold a seat for a user for SeatHoldManager::DEFAULT_TTL
+     * 
+     * @return bool False if the seat is booked, held by another user or unknown
+     * 
+     * @note In memory only: no database access
+     */
+    bool holdSeat(const int& userID, const int& showTimeID, const std::string& seatID) override;
+
+    /**
+     * @brief Release a seat held by a user
+     */
+    bool releaseSeat(const int& userID, const int& showTimeID, const std::string& seatID) override;
+
+    /**
+     * @brief Release every seat held by a user
+     */
+    void releaseHolds(const int& userID) override;
+    
     /**
      * @brief Create a new booking for user and showtime
      * 
@@ -147,7 +237,7 @@ public:
      * @throws std::runtime_error If booking doesn't exist
      * 
      * @par Atomicity
-     * - All seats are booked as a single transaction
+     * - All seats are inserted by one statement inside a single transaction
      * - If any seat fails, entire operation is rolled back
      * - Ensures booking consistency
      * 
@@ -198,11 +288,29 @@ public:
      * - Reserved seat information
      * - Total booking price
      * 
-     * @note Results are typically ordered by booking date (newest first)
+     * @note Results are ordered by BookingID, seats by SeatID
+     * @note Seat pointers refer to this repository's SeatCatalog
      * @see BookingView for complete data structure
+     * @see forEachBooking() to stream large histories
      */
     std::vector<BookingView> viewAllBookings(const int& userID) override;
     
+    /**
+     * @brief Stream a user's bookings without buffering the result set
+     * 
+     * Steps a single query ordered by BookingID and SeatID, starting a new
+     * BookingView whenever the BookingID changes and handing the finished one
+     * to the visitor.
+     * 
+     * @param userID Unique identifier of the user
+     * @param visitor Receives each complete booking
+     * 
+     * @throws std::runtime_error If the query fails
+     * 
+     * @see viewAllBookings()
+     */
+    void forEachBooking(const int& userID, const std::function<void(BookingView&&)>& visitor) override;
+    
     /**
      * @brief Get seat availability status for a showtime
      * 
@@ -223,7 +331,11 @@ public:
      * - Current availability status
      * - Booking status for the specific showtime
      * 
-     * @note Status reflects real-time seat availability
+     * @note Served from the in-memory SeatInventory: one pass over the
+     *       showtime's bitset, no database query; seats with a live hold
+     *       are reported as SeatStatus::HELD
+     * @note Seat pointers refer to this repository's SeatCatalog; no seat
+     *       object is allocated per call
      * @see SeatView for complete data structure
      * @see addBookedSeats() for seat reservation
      */
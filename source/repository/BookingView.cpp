@@ -5,6 +5,6 @@ BookingView::BookingView(
     const int& movieID,
     const std::string& title,
     const ShowTime& showTime,
-    const std::vector<std::shared_ptr<ISeat>>& bookedSeats,
+    const std::vector<const ISeat*>& bookedSeats,
     const float& totalPrice
 ) : bookingID(bookingID), movieID(movieID), movieTitle(title), showTime(showTime), bookedSeats(bookedSeats), totalPrice(totalPrice) {}
\ No newline at end of file
@@ -12,7 +12,6 @@
 #include "../model/ISeat.h"
 #include <vector>
 #include <string>
-#include <memory>
 
 /**
  * @class BookingView
@@ -45,10 +44,10 @@
  * 
  * @par Usage Example
  * @code
- * // Create seat collection
- * std::vector<std::shared_ptr<ISeat>> seats = {
- *     std::make_shared<SingleSeat>("A1", SeatType::SINGLE, 12.99f),
- *     std::make_shared<SingleSeat>("A2", SeatType::SINGLE, 12.99f)
+ * // Seats come from the shared SeatCatalog
+ * std::vector<const ISeat*> seats = {
+ *     seatCatalog->find("A1"),
+ *     seatCatalog->find("A2")
  * };
  * 
  * // Create showtime
@@ -60,13 +59,14 @@
  * // Display booking information
  * std::cout << "Booking #" << view.bookingID << std::endl;
  * std::cout << "Movie: " << view.movieTitle << std::endl;
- * std::cout << "Showtime: " << view.showTime.date << " at " << view.showTime.startTime << std::endl;
+ * std::cout << "Showtime: " << view.showTime.date() << " at " << view.showTime.startTime() << std::endl;
  * std::cout << "Seats: " << view.bookedSeats.size() << " seats reserved" << std::endl;
  * std::cout << "Total: $" << view.totalPrice << std::endl;
  * @endcode
  * 
  * @note This class is optimized for read operations and display purposes
- * @warning Do not modify seat objects after creating BookingView
+ * @warning Seat pointers are not owned; they stay valid while the SeatCatalog
+ *          of the repository that produced the view is alive
  * 
  * @see ShowTime
  * @see ISeat
@@ -124,10 +124,11 @@ public:
      * Vector containing all seats that have been reserved as part of
      * this booking. Each seat includes complete seat information.
      * 
-     * @note Seats should not be modified after booking creation
+     * @note Entries point into the repository's immutable SeatCatalog
      * @see ISeat for seat interface details
+     * @see SeatCatalog
      */
-    std::vector<std::shared_ptr<ISeat>> bookedSeats;
+    std::vector<const ISeat*> bookedSeats;
     
     /**
      * @brief Total booking price
@@ -168,14 +169,14 @@ public:
      * - Seat collection should not be empty for paid bookings
      * - Total price should be non-negative
      * 
-     * @note Constructor performs deep copy of seat information
+     * @note Only the seat pointers are copied, never the seats themselves
      * @see ShowTime constructor for showtime validation
      * @see ISeat for seat object requirements
      * 
      * @par Example
      * @code
-     * std::vector<std::shared_ptr<ISeat>> seats;
-     * seats.push_back(std::make_shared<SingleSeat>("A1", SeatType::SINGLE, 12.99f));
+     * std::vector<const ISeat*> seats;
+     * seats.push_back(seatCatalog->find("A1"));
      * 
      * ShowTime show(101, "2025-06-15", "19:30", "22:00");
      * BookingView view(12345, 67, "Inception", show, seats, 12.99f);
@@ -185,7 +186,7 @@ public:
                 const int& movieID,
                 const std::string& title,
                 const ShowTime& showTime,
-                const std::vector<std::shared_ptr<ISeat>>& bookedSeats,
+                const std::vector<const ISeat*>& bookedSeats,
                 const float& totalPrice);
     
     /**
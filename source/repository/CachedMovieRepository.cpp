@@ -0,0 +1,215 @@
+#include "CachedMovieRepository.h"
+#include "../model/Movie.h"
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+CachedMovieRepository::CachedMovieRepository(std::shared_ptr<IMovieRepository> inner)
+    : inner(std::move(inner)), version(0), hits(0), misses(0), invalidations(0) {
+    if (!this->inner) {
+        throw std::invalid_argument("CachedMovieRepository needs a repository to wrap.");
+    }
+}
+
+std::vector<MovieDTO> CachedMovieRepository::getAllMovies() {
+    std::uint64_t seen;
+    {
+        std::shared_lock lock(mutex);
+        if (allMovies) {
+            ++hits;
+            return *allMovies;
+        }
+        seen = version;
+    }
+
+    ++misses;
+    auto loaded = inner->getAllMovies();
+
+    std::unique_lock lock(mutex);
+    // A write in the meantime may have made the loaded list stale
+    if (version == seen) {
+        allMovies = loaded;
+    }
+    return loaded;
+}
+
+std::vector<MovieDTO> CachedMovieRepository::getMoviesPage(int afterMovieId, std::size_t limit) {
+    const auto key = std::make_pair(afterMovieId, limit);
+    std::uint64_t seen;
+    {
+        std::shared_lock lock(mutex);
+        auto it = pages.find(key);
+        if (it != pages.end()) {
+            ++hits;
+            return it->second;
+        }
+        seen = version;
+    }
+
+    ++misses;
+    auto loaded = inner->getMoviesPage(afterMovieId, limit);
+
+    std::unique_lock lock(mutex);
+    if (version == seen) {
+        pages[key] = loaded;
+    }
+    return loaded;
+}
+
+std::vector<MovieDTO> CachedMovieRepository::searchMovies(const std::string& query, std::size_t limit) {
+    return inner->searchMovies(query, limit);
+}
+
+std::vector<ScheduledShowTime> CachedMovieRepository::getShowTimesBetween(std::int64_t from, std::int64_t to) {
+    return inner->getShowTimesBetween(from, to);
+}
+
+std::shared_ptr<IMovie> CachedMovieRepository::getMovieById(int id) {
+    std::uint64_t seen;
+    {
+        std::shared_lock lock(mutex);
+        auto it = movies.find(id);
+        if (it != movies.end()) {
+            ++hits;
+            if (!it->second) {
+                return nullptr;
+            }
+            const MovieRecord& m = *it->second;
+            return std::make_shared<Movie>(m.id, m.title, m.genre, m.description, m.rating);
+        }
+        seen = version;
+    }
+
+    ++misses;
+    auto loaded = inner->getMovieById(id);
+
+    std::unique_lock lock(mutex);
+    if (version == seen) {
+        if (loaded) {
+            movies[id] = MovieRecord{loaded->getId(), loaded->getTitle(), loaded->getGenre(),
+                                     loaded->getDescription(), loaded->getRating()};
+        } else {
+            movies[id] = std::nullopt;
+        }
+    }
+    return loaded;
+}
+
+std::vector<ShowTime> CachedMovieRepository::getShowTimesByMovieId(int id) {
+    std::uint64_t seen;
+    {
+        std::shared_lock lock(mutex);
+        auto it = showTimes.find(id);
+        if (it != showTimes.end()) {
+            ++hits;
+            return it->second;
+        }
+        seen = version;
+    }
+
+    ++misses;
+    auto loaded = inner->getShowTimesByMovieId(id);
+
+    std::unique_lock lock(mutex);
+    if (version == seen) {
+        showTimes[id] = loaded;
+    }
+    return loaded;
+}
+
+int CachedMovieRepository::addMovie(std::shared_ptr<IMovie> movie) {
+    int id = inner->addMovie(std::move(movie));
+
+    std::unique_lock lock(mutex);
+    invalidate();
+    allMovies.reset();
+    pages.clear();
+    // The ID may have been looked up (and cached as "not found") before
+    movies.erase(id);
+    return id;
+}
+
+int CachedMovieRepository::addMovie(std::shared_ptr<IMovie> movie, std::span<const ShowTimeSpec> schedule) {
+    int id = inner->addMovie(std::move(movie), schedule);
+
+    std::unique_lock lock(mutex);
+    invalidate();
+    allMovies.reset();
+    pages.clear();
+    movies.erase(id);
+    showTimes.erase(id);
+    return id;
+}
+
+void CachedMovieRepository::deleteMovie(int id) {
+    inner->deleteMovie(id);
+
+    std::unique_lock lock(mutex);
+    invalidate();
+    allMovies.reset();
+    pages.clear();
+    movies.erase(id);
+    showTimes.erase(id);
+}
+
+void CachedMovieRepository::addShowTime(int movieId, std::int64_t startsAt, std::int64_t endsAt, int auditoriumId) {
+    inner->addShowTime(movieId, startsAt, endsAt, auditoriumId);
+
+    std::unique_lock lock(mutex);
+    invalidate();
+    showTimes.erase(movieId);
+}
+
+void CachedMovieRepository::addShowTimes(int movieId, std::span<const ShowTimeSpec> schedule) {
+    inner->addShowTimes(movieId, schedule);
+
+    std::unique_lock lock(mutex);
+    invalidate();
+    showTimes.erase(movieId);
+}
+
+void CachedMovieRepository::deleteShowTime(int movieId, int ShowTimeId) {
+    inner->deleteShowTime(movieId, ShowTimeId);
+
+    std::unique_lock lock(mutex);
+    invalidate();
+    showTimes.erase(movieId);
+}
+
+void CachedMovieRepository::deleteAllShowTimes(int movieId) {
+    inner->deleteAllShowTimes(movieId);
+
+    std::unique_lock lock(mutex);
+    invalidate();
+    showTimes.erase(movieId);
+}
+
+void CachedMovieRepository::clear() {
+    std::unique_lock lock(mutex);
+    invalidate();
+    allMovies.reset();
+    pages.clear();
+    movies.clear();
+    showTimes.clear();
+}
+
+CachedMovieRepository::Stats CachedMovieRepository::stats() const {
+    Stats snapshot;
+    snapshot.hits = hits.load();
+    snapshot.misses = misses.load();
+    snapshot.invalidations = invalidations.load();
+    std::shared_lock lock(mutex);
+    snapshot.version = version;
+    return snapshot;
+}
+
+void CachedMovieRepository::resetStats() {
+    hits = 0;
+    misses = 0;
+    invalidations = 0;
+}
+
+void CachedMovieRepository::invalidate() {
+    ++version;
+    ++invalidations;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file CachedMovieRepository.h
+ * @brief Read-through, write-invalidated cache in front of an IMovieRepository
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef _CACHEDMOVIEREPOSITORY_H_
+#define _CACHEDMOVIEREPOSITORY_H_
+#include "IMovieRepository.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @class CachedMovieRepository
+ * @brief Keeps the movie catalog in memory so browsing never reaches SQLite
+ *
+ * The catalog (movie list and pages, movie details, showtimes per movie) is read on
+ * almost every request but only changes when an administrator uses
+ * MovieManagerService. This decorator answers reads from memory after the
+ * first load and forwards writes to the wrapped repository, dropping exactly
+ * the entries a write affects:
+ *
+ * | Write                    | Invalidated entries                                   |
+ * |--------------------------|-------------------------------------------------------|
+ * | addMovie                 | movie list and pages, the new movie ID                |
+ * | addMovie(movie, times)   | movie list and pages, the new movie ID                |
+ * | deleteMovie(id)          | movie list and pages, movie @c id, showtimes of @c id |
+ * | addShowTime(id, ...)     | showtimes of @c id                                    |
+ * | addShowTimes(id, ...)    | showtimes of @c id                                    |
+ * | deleteShowTime(id, ...)  | showtimes of @c id                                    |
+ * | deleteAllShowTimes(id)   | showtimes of @c id                                    |
+ *
+ * Every write also bumps a version number. A miss remembers the version
+ * before it queries the wrapped repository and stores its result only if the
+ * version is unchanged, so a load that raced with a write can never put the
+ * pre-write data back into the cache.
+ *
+ * Unknown movie IDs are cached as well (as "not found"), so repeated lookups
+ * of a deleted movie do not reach the database either. Searches and
+ * time-window queries are not cached: they are rarely repeated, and the
+ * full-text and interval indexes answer them directly.
+ *
+ * @details
+ * - Reads share a std::shared_mutex; writes and cache fills take it exclusively
+ * - The database is never queried while the lock is held
+ * - getMovieById() returns a fresh Movie copy, so callers may modify it freely
+ * - Hits, misses and invalidations are counted (see stats())
+ *
+ * @par Usage Example
+ * @code
+ * auto movies = std::make_shared<CachedMovieRepository>(
+ *     std::make_shared<MovieRepositorySQL>(connectionPool));
+ * auto viewer = std::make_shared<MovieViewerService>(movies);
+ * auto manager = std::make_shared<MovieManagerService>(movies);  // same instance!
+ *
+ * viewer->showAllMovies();   // miss: loads from SQLite
+ * viewer->showAllMovies();   // hit
+ * manager->deleteMovie(3);   // drops the list, movie 3 and its showtimes
+ * @endcode
+ *
+ * @warning Only writes made through this instance invalidate it. Every writer
+ *          in the process must share it, and another process writing the same
+ *          database file (e.g. a kiosk next to BookingServer) is not seen
+ *          until clear() is called.
+ *
+ * @see IMovieRepository
+ * @see MovieRepositorySQL
+ */
+class CachedMovieRepository : public IMovieRepository {
+public:
+    /**
+     * @brief Counters describing how well the cache works
+     */
+    struct Stats {
+        std::uint64_t hits = 0;          ///< Reads answered from memory
+        std::uint64_t misses = 0;        ///< Reads forwarded to the wrapped repository
+        std::uint64_t invalidations = 0; ///< Writes that dropped cached entries
+        std::uint64_t version = 0;       ///< Number of writes seen so far
+
+        double hitRate() const {
+            return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(hits + misses);
+        }
+    };
+
+    /**
+     * @brief Wrap a repository
+     *
+     * @throws std::invalid_argument If inner is null
+     */
+    explicit CachedMovieRepository(std::shared_ptr<IMovieRepository> inner);
+
+    std::vector<MovieDTO> getAllMovies() override;
+    std::vector<MovieDTO> getMoviesPage(int afterMovieId, std::size_t limit) override;
+    std::shared_ptr<IMovie> getMovieById(int id) override;
+    std::vector<ShowTime> getShowTimesByMovieId(int id) override;
+    std::vector<MovieDTO> searchMovies(const std::string& query, std::size_t limit) override;
+    std::vector<ScheduledShowTime> getShowTimesBetween(std::int64_t from, std::int64_t to) override;
+
+    int addMovie(std::shared_ptr<IMovie> movie) override;
+    int addMovie(std::shared_ptr<IMovie> movie, std::span<const ShowTimeSpec> schedule) override;
+    void deleteMovie(int id) override;
+    void addShowTime(int movieId, std::int64_t startsAt, std::int64_t endsAt, int auditoriumId) override;
+    void addShowTimes(int movieId, std::span<const ShowTimeSpec> schedule) override;
+    void deleteShowTime(int movieId, int ShowTimeId) override;
+    void deleteAllShowTimes(int movieId) override;
+
+    /**
+     * @brief Drop every cached entry, e.g. after the database was changed elsewhere
+     */
+    void clear();
+
+    /**
+     * @brief Snapshot of the counters
+     */
+    Stats stats() const;
+
+    /**
+     * @brief Zero the hit, miss and invalidation counters (the version is kept)
+     */
+    void resetStats();
+
+private:
+    /**
+     * @brief Movie fields copied out of an IMovie; std::nullopt caches "not found"
+     */
+    struct MovieRecord {
+        int id;
+        std::string title;
+        std::string genre;
+        std::string description;
+        float rating;
+    };
+
+    /**
+     * @brief Start a write: bump the version and count the invalidation
+     *
+     * @note Caller must hold the lock exclusively
+     */
+    void invalidate();
+
+    std::shared_ptr<IMovieRepository> inner;
+
+    mutable std::shared_mutex mutex;
+    std::uint64_t version;                                            ///< Guarded by mutex
+    std::optional<std::vector<MovieDTO>> allMovies;                   ///< Guarded by mutex
+    std::map<std::pair<int, std::size_t>, std::vector<MovieDTO>> pages; ///< (after, limit), guarded by mutex
+    std::unordered_map<int, std::optional<MovieRecord>> movies;       ///< Guarded by mutex
+    std::unordered_map<int, std::vector<ShowTime>> showTimes;         ///< Guarded by mutex
+
+    std::atomic<std::uint64_t> hits;
+    std::atomic<std::uint64_t> misses;
+    std::atomic<std::uint64_t> invalidations;
+};
+
+#endif
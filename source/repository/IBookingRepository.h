@@ -9,8 +9,10 @@
 #define _IBOOKINGREPOSITORY_H_
 #include <string>
 #include <vector>
+#include <functional>
 #include "BookingView.h"
 #include "SeatView.h"
+#include "SeatUnavailableException.h"
 
 /**
  * @interface IBookingRepository
@@ -42,15 +44,11 @@
  * Usage Example:
  * @code
  * std::unique_ptr<IBookingRepository> bookingRepo = 
- *     std::make_unique<BookingRepositorySQL>(dbConnection);
+ *     std::make_unique<BookingRepositorySQL>(connectionPool);
  * 
- * // Create a new booking
- * bookingRepo->addBooking(userId, showTimeId);
- * int bookingId = bookingRepo->getLatestBookingID(userId);
- * 
- * // Reserve seats for the booking
+ * // Create a booking and reserve its seats in one transaction
  * std::vector<std::string> seats = {"A1", "A2"};
- * bookingRepo->addBookedSeats(bookingId, seats);
+ * int bookingId = bookingRepo->createBooking(userId, showTimeId, seats);
  * 
  * // View booking history
  * auto bookings = bookingRepo->viewAllBookings(userId);
@@ -71,6 +69,70 @@ public:
      */
     virtual ~IBookingRepository() = default;
     
+    /**
+     * @brief Atomically creates a booking together with its seats
+     * 
+     * Checks that none of the requested seats is already booked for the
+     * showtime, creates the booking record and reserves every seat inside a
+     * single write transaction. Either the whole booking is stored or nothing
+     * is written.
+     * 
+     * @param userID Unique identifier of the user making the booking
+     * @param showTimeID Unique identifier of the movie showtime being booked
+     * @param seats Seat identifiers to reserve (e.g., "A1", "B5")
+     * @return The identifier of the newly created booking
+     * 
+     * @pre seats must not be empty and must not contain duplicates
+     * @post On success the booking and all of its seats are persisted
+     * @post On failure no booking or seat record has been written
+     * 
+     * @throw std::invalid_argument if seats is empty, has duplicates or names unknown seats
+     * @throw SeatUnavailableException if any seat is already booked for the showtime
+     *        or held by another user (see holdSeat())
+     * @throw std::runtime_error if the transaction fails due to system issues
+     * 
+     * @note The user's own holds on the seats are released once the booking is stored
+     * @note Prefer this over addBooking() + getLatestBookingID() + addBookedSeats(),
+     *       which cannot prevent two buyers from taking the same seat
+     * 
+     * Usage:
+     * @code
+     * try {
+     *     int bookingId = repository->createBooking(userId, showTimeId, {"A1", "A2"});
+     * } catch (const SeatUnavailableException& e) {
+     *     // Some seats were taken by someone else, nothing was booked
+     * }
+     * @endcode
+     */
+    virtual int createBooking(const int& userID, const int& showTimeID, const std::vector<std::string>& seats) = 0;
+
+    /**
+     * @brief Hold a seat for a user while they finish selecting seats
+     * 
+     * A hold lasts a short, implementation-defined time unless renewed by
+     * holding the seat again. Held seats are reported as SeatStatus::HELD by
+     * viewSeatsStatus() and cannot be booked by other users.
+     * 
+     * @param userID User placing the hold
+     * @param showTimeID Showtime of the seat
+     * @param seatID Seat identifier
+     * @return true if the user now holds the seat; false if it is booked,
+     *         held by someone else or unknown
+     */
+    virtual bool holdSeat(const int& userID, const int& showTimeID, const std::string& seatID) = 0;
+
+    /**
+     * @brief Release a seat held by a user (e.g., the seat was deselected)
+     * 
+     * @return true if the user held the seat
+     */
+    virtual bool releaseSeat(const int& userID, const int& showTimeID, const std::string& seatID) = 0;
+
+    /**
+     * @brief Release every seat held by a user (e.g., on logout)
+     */
+    virtual void releaseHolds(const int& userID) = 0;
+    
     /**
      * @brief Creates a new booking record for a user and showtime
      * 
@@ -208,6 +270,34 @@ public:
      */
     virtual std::vector<BookingView> viewAllBookings(const int& userID) = 0;
     
+    /**
+     * @brief Streams the booking history of a user one booking at a time
+     * 
+     * Visits every booking of the user in ascending BookingID order. Seats are
+     * grouped into their booking while the result set is being read, so at
+     * most one booking is held in memory regardless of the history size.
+     * 
+     * @param userID Unique identifier of the user to query
+     * @param visitor Called once per complete booking; it may take ownership
+     *                of the BookingView by moving from it
+     * 
+     * @pre userID must be a valid, existing user identifier
+     * @post visitor has been called once for each of the user's bookings
+     * 
+     * @throw std::runtime_error if query fails due to system issues
+     * 
+     * @note viewAllBookings() is equivalent to collecting every visited booking
+     * 
+     * Usage:
+     * @code
+     * float spent = 0;
+     * repository->forEachBooking(userId, [&](BookingView&& booking) {
+     *     spent += booking.totalPrice;
+     * });
+     * @endcode
+     */
+    virtual void forEachBooking(const int& userID, const std::function<void(BookingView&&)>& visitor) = 0;
+    
     /**
      * @brief Retrieves seat availability status for a specific showtime
      * 
@@ -226,7 +316,8 @@ public:
      * @throw std::runtime_error if query fails due to system issues
      * 
      * @note Status reflects real-time availability
-     * @note Includes both available and booked seats
+     * @note Includes available, booked and held seats; a user's own holds
+     *       are reported as HELD too
      * @note Seat order may be implementation-dependent
      * 
      * Usage:
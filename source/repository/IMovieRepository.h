@@ -13,7 +13,13 @@
 #include "MovieDTO.h"
 #include "../model/IMovie.h"
 #include "../model/ShowTime.h"
+#include "ScheduledShowTime.h"
+#include "ShowTimeOverlapException.h"
+#include "ShowTimeSpec.h"
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <iostream>
 
@@ -69,6 +75,51 @@ public:
      * @see MovieDTO
      */
     virtual std::vector<MovieDTO> getAllMovies() = 0;
+
+    /**
+     * @brief Retrieve one page of movies in MovieID order (keyset pagination)
+     * 
+     * Returns the movies whose ID is greater than @p afterMovieId. The next
+     * page starts after the ID of the last movie returned, so every page is
+     * a range seek on the primary key, however deep into the catalog it is.
+     * 
+     * @param afterMovieId ID of the last movie of the previous page, 0 for the first page
+     * @param limit Maximum number of movies to return
+     * @return std::vector<MovieDTO> Up to @p limit movies, ordered by ID
+     * 
+     * @retval Fewer than limit movies on the last page
+     * @retval Empty vector past the end of the catalog
+     * 
+     * @par Usage Example
+     * @code
+     * int after = 0;
+     * for (auto page = repo->getMoviesPage(after, 50); !page.empty(); page = repo->getMoviesPage(after, 50)) {
+     *     // ...
+     *     after = page.back().id;
+     * }
+     * @endcode
+     * 
+     * @see getAllMovies
+     */
+    virtual std::vector<MovieDTO> getMoviesPage(int afterMovieId, std::size_t limit) = 0;
+
+    /**
+     * @brief Full-text search over movie titles, genres and descriptions
+     * 
+     * Every word of @p query must match the start of a word of the movie
+     * ("aven" finds "Avengers"); case and accents are ignored. Punctuation
+     * in the query only separates words, so user input can be passed as is.
+     * 
+     * @param query Words typed by the user
+     * @param limit Maximum number of movies to return
+     * @return std::vector<MovieDTO> Matching movies, best match first
+     *         (matches in the title rank above matches in the description)
+     * 
+     * @retval Empty vector if nothing matches or the query has no words
+     * 
+     * @see getMoviesPage
+     */
+    virtual std::vector<MovieDTO> searchMovies(const std::string& query, std::size_t limit) = 0;
     
     /**
      * @brief Retrieve a specific movie by its unique identifier
@@ -104,6 +155,24 @@ public:
      * @see IMovie
      */
     virtual int addMovie(std::shared_ptr<IMovie> movie) = 0;
+
+    /**
+     * @brief Add a movie together with its showtimes, all or nothing
+     * 
+     * Either the movie and every showtime are stored, or nothing is: an
+     * invalid or overlapping showtime leaves no movie behind.
+     * 
+     * @param movie Smart pointer to movie object to be added
+     * @param showTimes Showtimes of the new movie (may be empty)
+     * @return int Generated movie ID
+     * 
+     * @throws std::invalid_argument if a showtime does not end after it starts
+     * @throws ShowTimeOverlapException if a showtime overlaps a scheduled one,
+     *         or another one of @p showTimes, in its auditorium
+     * 
+     * @see addShowTimes()
+     */
+    virtual int addMovie(std::shared_ptr<IMovie> movie, std::span<const ShowTimeSpec> showTimes) = 0;
     
     /**
      * @brief Remove a movie from the repository
@@ -129,21 +198,58 @@ public:
      * The showtime defines when the movie will be screened.
      * 
      * @param movieId ID of the movie for this showtime
-     * @param Date Screening date in YYYY-MM-DD format
-     * @param StartTime Start time in HH:MM format
-     * @param EndTime End time in HH:MM format
+     * @param startsAt Start, in epoch seconds (see ShowTime::toEpoch())
+     * @param endsAt End, in epoch seconds
+     * @param auditoriumId Auditorium the movie is screened in
      * 
      * @pre movieId > 0 and movie exists
-     * @pre Date is valid and not in the past
-     * @pre StartTime < EndTime
+     * @pre startsAt is not in the past
      * @post New showtime is created and associated with movie
      * 
-     * @throws InvalidDateException if date format is invalid
-     * @throws RepositoryException if movie doesn't exist
+     * @throws std::invalid_argument if endsAt is not after startsAt
+     * @throws ShowTimeOverlapException if the auditorium is already busy
+     *         during part of that time (nothing is written)
      * 
      * @see ShowTime
      */
-    virtual void addShowTime(int movieId, std::string& Date, std::string& StartTime, std::string& EndTime) = 0;
+    virtual void addShowTime(int movieId, std::int64_t startsAt, std::int64_t endsAt, int auditoriumId) = 0;
+
+    /**
+     * @brief Add many showtimes of one movie at once, all or nothing
+     * 
+     * Every showtime is validated before anything is written, then all of
+     * them are inserted in a single transaction. Each is checked for
+     * overlaps against the schedule, including the showtimes of the same
+     * batch inserted before it.
+     * 
+     * @param movieId ID of the movie for these showtimes
+     * @param showTimes Showtimes to add (may be empty)
+     * 
+     * @throws std::invalid_argument if a showtime does not end after it starts
+     * @throws ShowTimeOverlapException if a showtime overlaps another one in
+     *         its auditorium (nothing is written)
+     * 
+     * @see ShowTimeSpec
+     */
+    virtual void addShowTimes(int movieId, std::span<const ShowTimeSpec> showTimes) = 0;
+
+    /**
+     * @brief Retrieve everything playing during a time window, in all auditoriums
+     * 
+     * A showtime is returned if it runs at some point between @p from and
+     * @p to (one that ends exactly at @p from or starts exactly at @p to
+     * is not).
+     * 
+     * @param from Start of the window, in epoch seconds
+     * @param to End of the window, after @p from
+     * @return std::vector<ScheduledShowTime> Showtimes with their movie and
+     *         auditorium, ordered by start time then auditorium
+     * 
+     * @throws std::invalid_argument if the window is empty
+     * 
+     * @see ScheduledShowTime
+     */
+    virtual std::vector<ScheduledShowTime> getShowTimesBetween(std::int64_t from, std::int64_t to) = 0;
     
     /**
      * @brief Remove a specific showtime
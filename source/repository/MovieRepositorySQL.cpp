@@ -2,39 +2,208 @@
 #include "Movie.h"
 #include "MovieMapper.h"
 #include "../model/ShowTime.h"
+#include "../database/Transaction.h"
+#include <cctype>
+#include <cstdint>
+#include <utility>
 
-// MovieRepositorySQL::MovieRepositorySQL(std::shared_ptr<DatabaseConnection> conn) {
-//     dbConn = conn.get();
-// }
+namespace {
 
-MovieRepositorySQL::MovieRepositorySQL(const std::string& filePath) {
-    dbConn = DatabaseConnection::getInstance();
-    if (!dbConn->connect(filePath)) {
-        throw std::runtime_error("Failed to connect to database");
+// "star wa" -> "star"* "wa"*  (every word must match, as a prefix)
+std::string toPrefixMatch(const std::string& query) {
+    std::string match;
+    std::string word;
+    auto flush = [&match, &word]() {
+        if (!word.empty()) {
+            match += (match.empty() ? "\"" : " \"") + word + "\"*";
+            word.clear();
+        }
+    };
+    for (char c : query) {
+        unsigned char byte = static_cast<unsigned char>(c);
+        // Bytes of multi-byte UTF-8 characters are kept, the tokenizer folds them
+        if (byte >= 0x80 || std::isalnum(byte)) {
+            word += c;
+        } else {
+            flush();
+        }
+    }
+    flush();
+    return match;
+}
+
+// Parameters are bound as text, so every number is cast back before it is compared.
+// The R*Tree narrows the search to boxes overlapping [start, end) to the minute;
+// the exact times of those few candidates are then compared to the second.
+const char* const OVERLAPPING_SHOWTIMES_SQL =
+    "SELECT s.ShowTimeID FROM SHOWTIME_RTREE r JOIN SHOWTIME s ON s.ShowTimeID = r.ShowTimeID "
+    "WHERE r.MinAuditorium <= CAST(?1 AS INTEGER) AND r.MaxAuditorium >= CAST(?1 AS INTEGER) "
+    "AND r.StartMinute < (CAST(?3 AS INTEGER) + 59) / 60 AND r.EndMinute > CAST(?2 AS INTEGER) / 60 "
+    "AND s.StartsAt < CAST(?3 AS INTEGER) AND s.EndsAt > CAST(?2 AS INTEGER) "
+    "ORDER BY s.ShowTimeID";
+
+const char* const SHOWTIMES_BETWEEN_SQL =
+    "SELECT s.ShowTimeID, s.StartsAt, s.EndsAt, s.MovieID, m.Title, s.AuditoriumID "
+    "FROM SHOWTIME_RTREE r JOIN SHOWTIME s ON s.ShowTimeID = r.ShowTimeID JOIN MOVIE m ON m.MovieID = s.MovieID "
+    "WHERE r.StartMinute < (CAST(?2 AS INTEGER) + 59) / 60 AND r.EndMinute > CAST(?1 AS INTEGER) / 60 "
+    "AND s.StartsAt < CAST(?2 AS INTEGER) AND s.EndsAt > CAST(?1 AS INTEGER) "
+    "ORDER BY s.StartsAt, s.AuditoriumID";
+
+const char* const INSERT_SHOWTIME_SQL =
+    "INSERT INTO SHOWTIME (MovieID, StartsAt, EndsAt, AuditoriumID) "
+    "VALUES (?, CAST(? AS INTEGER), CAST(? AS INTEGER), ?)";
+
+// Whole batch first, so a bad entry is reported before the write lock is taken
+void validateShowTimes(std::span<const ShowTimeSpec> showTimes) {
+    for (const ShowTimeSpec& showTime : showTimes) {
+        // Kiểm tra thời gian kết thúc > thời gian bắt đầu
+        if (showTime.endsAt <= showTime.startsAt) {
+            throw std::invalid_argument("End time must be after start time");
+        }
+        // Feeds and the admin screen give a show as a date and two times of day, which cannot
+        // express 24 hours or more (see ShowTime::toEndEpoch); keep the catalog within that
+        if (showTime.endsAt - showTime.startsAt >= ShowTime::SECONDS_PER_DAY) {
+            throw std::invalid_argument("Showtime must be shorter than a day");
+        }
     }
 }
 
+// Runs inside the caller's IMMEDIATE transaction. Both statements come from the
+// connection's statement cache, so they are compiled once for the whole batch, and
+// every insert is in SHOWTIME_RTREE (via its trigger) before the next one is checked.
+void insertShowTimes(DatabaseConnection* db, int movieId, std::span<const ShowTimeSpec> showTimes) {
+    const std::string movie = std::to_string(movieId);
+    std::vector<int> overlapping;
+    for (const ShowTimeSpec& showTime : showTimes) {
+        std::string auditorium = std::to_string(showTime.auditoriumID);
+        std::string startsAt = std::to_string(showTime.startsAt);
+        std::string endsAt = std::to_string(showTime.endsAt);
+
+        if (!db->forEachRow(OVERLAPPING_SHOWTIMES_SQL, {auditorium, startsAt, endsAt},
+                            [&overlapping](const ResultRow& row) { overlapping.push_back(row.getInt(0)); })) {
+            throw std::runtime_error("Failed to check the schedule of auditorium " + auditorium);
+        }
+        if (!overlapping.empty()) {
+            throw ShowTimeOverlapException(showTime.auditoriumID, std::move(overlapping));
+        }
+
+        if (!db->executeNonQuery(INSERT_SHOWTIME_SQL, {movie, startsAt, endsAt, auditorium})) {
+            throw std::runtime_error("Failed to add showtime to database");
+        }
+    }
+}
+
+// last_insert_rowid() is per connection, so the caller's lease must do both statements
+int insertMovie(DatabaseConnection* db, const IMovie& movie) {
+    const std::string sql = "INSERT INTO MOVIE (Title, Genre, Descriptions, Rating) "
+                           "VALUES (?, ?, ?, ?)";
+    bool success = db->executeNonQuery(sql, {
+        movie.getTitle(),
+        movie.getGenre(),
+        movie.getDescription(),
+        std::to_string(movie.getRating())
+    });
+
+    if (!success) {
+        throw std::runtime_error("Failed to add movie to database");
+    }
+    // Retrieve the last inserted ID
+    // This is specific to SQLite. Other databases might have different ways.
+    auto result = db->executeQuery("SELECT last_insert_rowid();");
+    if (!result.empty() && result[0].count("last_insert_rowid()")) {
+        return std::stoi(result[0].at("last_insert_rowid()"));
+    }
+    throw std::runtime_error("Failed to retrieve last inserted movie ID.");
+}
+
+} // namespace
+
+MovieRepositorySQL::MovieRepositorySQL(std::shared_ptr<ConnectionPool> pool) : pool(std::move(pool)) {
+    if (!this->pool) {
+        throw std::invalid_argument("MovieRepositorySQL needs a connection pool");
+    }
+}
+
+MovieRepositorySQL::MovieRepositorySQL(const std::string& filePath)
+    : MovieRepositorySQL(std::make_shared<ConnectionPool>(filePath)) {
+}
+
 std::vector<MovieDTO> MovieRepositorySQL::getAllMovies() {
     const std::string sql = "SELECT MovieID, Title, Genre, Rating FROM MOVIE";
-    auto results = dbConn->executeQuery(sql);
+    auto db = pool->reader();
+    auto cursor = db->query(sql);
+
+    std::vector<MovieDTO> movies;
+    while (cursor.next()) {
+        const ResultRow& row = cursor.row();
+        movies.emplace_back(
+            row.getInt(0),
+            row.getString(1),
+            row.getString(2),
+            static_cast<float>(row.getDouble(3))
+        );
+    }
+    return movies;
+}
+
+std::vector<MovieDTO> MovieRepositorySQL::getMoviesPage(int afterMovieId, std::size_t limit) {
+    const std::string sql = "SELECT MovieID, Title, Genre, Rating FROM MOVIE "
+                            "WHERE MovieID > ? ORDER BY MovieID LIMIT ?";
+    auto db = pool->reader();
+    auto cursor = db->query(sql, {std::to_string(afterMovieId), std::to_string(limit)});
+
+    std::vector<MovieDTO> movies;
+    movies.reserve(limit);
+    while (cursor.next()) {
+        const ResultRow& row = cursor.row();
+        movies.emplace_back(
+            row.getInt(0),
+            row.getString(1),
+            row.getString(2),
+            static_cast<float>(row.getDouble(3))
+        );
+    }
+    // A short page means the end of the catalog, so a failed read must not look like one
+    if (!cursor.ok()) {
+        throw std::runtime_error("Failed to read movies after ID " + std::to_string(afterMovieId));
+    }
+    return movies;
+}
+
+std::vector<MovieDTO> MovieRepositorySQL::searchMovies(const std::string& query, std::size_t limit) {
+    const std::string match = toPrefixMatch(query);
+    if (match.empty() || limit == 0) {
+        return {};
+    }
+
+    // bm25 weights: Title, Genre, Descriptions
+    const std::string sql = "SELECT m.MovieID, m.Title, m.Genre, m.Rating "
+                            "FROM MOVIE_FTS JOIN MOVIE m ON m.MovieID = MOVIE_FTS.rowid "
+                            "WHERE MOVIE_FTS MATCH ? "
+                            "ORDER BY bm25(MOVIE_FTS, 10.0, 4.0, 1.0), m.MovieID LIMIT ?";
+    auto db = pool->reader();
+    auto cursor = db->query(sql, {match, std::to_string(limit)});
 
     std::vector<MovieDTO> movies;
-    for (const auto& row : results) {
-        auto movie = std::make_shared<Movie>(
-            std::stoi(row.at("MovieID")),
-            row.at("Title"),
-            row.at("Genre"),
-            "", // description tạm bỏ qua 
-            std::stof(row.at("Rating"))
+    while (cursor.next()) {
+        const ResultRow& row = cursor.row();
+        movies.emplace_back(
+            row.getInt(0),
+            row.getString(1),
+            row.getString(2),
+            static_cast<float>(row.getDouble(3))
         );
-        movies.push_back(MovieMapper::toDTO(movie));
+    }
+    // "No match" and "no MOVIE_FTS table" (schema not migrated) must not look the same
+    if (!cursor.ok()) {
+        throw std::runtime_error("Failed to search movies for \"" + query + "\"");
     }
     return movies;
 }
 
 std::shared_ptr<IMovie> MovieRepositorySQL::getMovieById(int id) {
     const std::string sql = "SELECT MovieID, Title, Genre, Descriptions, Rating FROM MOVIE WHERE MovieID = ?";
-    auto results = dbConn->executeQuery(sql, {std::to_string(id)});
+    auto results = pool->reader()->executeQuery(sql, {std::to_string(id)});
 
     if (results.empty()) {
         return nullptr;
@@ -50,85 +219,68 @@ std::shared_ptr<IMovie> MovieRepositorySQL::getMovieById(int id) {
     );
 }
 
-// Các hàm helper có thể thêm vào
-bool isValidDate(const std::string& date) {
-    // Kiểm tra định dạng YYYY-MM-DD
-    std::regex pattern(R"(\d{4}-\d{2}-\d{2})");
-    return std::regex_match(date, pattern);
+void MovieRepositorySQL::addShowTime(int movieId, std::int64_t startsAt, std::int64_t endsAt, int auditoriumId) {
+    ShowTimeSpec showTime(startsAt, endsAt, auditoriumId);
+    addShowTimes(movieId, std::span<const ShowTimeSpec>(&showTime, 1));
 }
 
-bool isValidTime(const std::string& time) {
-    // Kiểm tra định dạng HH:MM:SS hoặc HH:MM
-    std::regex patternWithSeconds(R"(\d{2}:\d{2}:\d{2})");
-    std::regex patternWithoutSeconds(R"(\d{2}:\d{2})");
-    return std::regex_match(time, patternWithSeconds) || std::regex_match(time, patternWithoutSeconds);
+void MovieRepositorySQL::addShowTimes(int movieId, std::span<const ShowTimeSpec> showTimes) {
+    validateShowTimes(showTimes);
+    if (showTimes.empty()) {
+        return;
+    }
+
+    // IMMEDIATE takes the write lock now, so no showtime can be added between the checks and the inserts
+    auto db = pool->writer();
+    Transaction transaction(db.get(), Transaction::Mode::IMMEDIATE);
+    insertShowTimes(db.get(), movieId, showTimes);
+    transaction.commit();
 }
 
-void MovieRepositorySQL::addShowTime(int movieId, std::string& Date, std::string& StartTime, std::string& EndTime) {
-    // Tự động thêm giây nếu định dạng là HH:MM
-    auto addSeconds = [](std::string& time) {
-        if (std::regex_match(time, std::regex(R"(\d{2}:\d{2})"))) {
-            time += ":00";
-        }
-    };
-    
-    addSeconds(StartTime);
-    addSeconds(EndTime);
-    
-    // Validate định dạng ngày và giờ
-    if (!isValidDate(Date) || !isValidTime(StartTime) || !isValidTime(EndTime)) {
-        throw std::invalid_argument("Invalid date or time format");
+std::vector<ScheduledShowTime> MovieRepositorySQL::getShowTimesBetween(std::int64_t from, std::int64_t to) {
+    if (to <= from) {
+        throw std::invalid_argument("End of the window must be after its start");
     }
 
-    // Kiểm tra thời gian kết thúc > thời gian bắt đầu
-    if (EndTime <= StartTime) {
-        throw std::invalid_argument("End time must be after start time");
+    std::vector<ScheduledShowTime> schedule;
+    auto db = pool->reader();
+    auto cursor = db->query(SHOWTIMES_BETWEEN_SQL, {std::to_string(from), std::to_string(to)});
+    while (cursor.next()) {
+        const ResultRow& row = cursor.row();
+        schedule.emplace_back(
+            row.getInt(3),
+            row.getString(4),
+            row.getInt(5),
+            ShowTime(row.getInt(0), row.getInt64(1), row.getInt64(2))
+        );
     }
-
-    // Câu lệnh SQL phù hợp với cấu trúc bảng
-    const std::string sql = "INSERT INTO SHOWTIME (MovieID, Date, StartTime, EndTime) VALUES (?, ?, ?, ?)";
-    
-    bool success = dbConn->executeNonQuery(sql, {
-        std::to_string(movieId),  // MovieID
-        Date,                     // Date (YYYY-MM-DD)
-        StartTime,                // StartTime (HH:MM:SS)
-        EndTime                   // EndTime (HH:MM:SS)
-    });
-
-    if (!success) {
-        throw std::runtime_error("Failed to add showtime to database");
+    // An empty schedule is a valid answer; a failed read (no SHOWTIME_RTREE, SQLITE_BUSY) is not one
+    if (!cursor.ok()) {
+        throw std::runtime_error("Failed to read the showtimes between " + std::to_string(from) + " and " +
+                                 std::to_string(to));
     }
+    return schedule;
 }
 
 
-
 int MovieRepositorySQL::addMovie(std::shared_ptr<IMovie> movie) {
-    const std::string sql = "INSERT INTO MOVIE (Title, Genre, Descriptions, Rating) "
-                           "VALUES (?, ?, ?, ?)";
-    
-    bool success = dbConn->executeNonQuery(sql, {
-        movie->getTitle(),
-        movie->getGenre(),
-        movie->getDescription(),
-        std::to_string(movie->getRating())
-    });
+    return insertMovie(pool->writer().get(), *movie);
+}
 
+int MovieRepositorySQL::addMovie(std::shared_ptr<IMovie> movie, std::span<const ShowTimeSpec> showTimes) {
+    validateShowTimes(showTimes);
 
-    if (!success) {
-        throw std::runtime_error("Failed to add movie to database");
-    }
-    // Retrieve the last inserted ID
-    // This is specific to SQLite. Other databases might have different ways.
-    auto result = dbConn->executeQuery("SELECT last_insert_rowid();");
-    if (!result.empty() && result[0].count("last_insert_rowid()")) {
-        return std::stoi(result[0].at("last_insert_rowid()"));
-    }
-    throw std::runtime_error("Failed to retrieve last inserted movie ID.");
+    auto db = pool->writer();
+    Transaction transaction(db.get(), Transaction::Mode::IMMEDIATE);
+    int movieId = insertMovie(db.get(), *movie);
+    insertShowTimes(db.get(), movieId, showTimes);
+    transaction.commit();
+    return movieId;
 }
 
 void MovieRepositorySQL::deleteMovie(int id) {
     const std::string sql = "DELETE FROM MOVIE WHERE MovieID = ?";
-    bool success = dbConn->executeNonQuery(sql, {std::to_string(id)});
+    bool success = pool->writer()->executeNonQuery(sql, {std::to_string(id)});
     
     if (!success) {
         throw std::runtime_error("Failed to delete movie from database");
@@ -136,28 +288,26 @@ void MovieRepositorySQL::deleteMovie(int id) {
 }
 
 MovieRepositorySQL::~MovieRepositorySQL() {
-    // Don't delete dbConn since it's a singleton managed by DatabaseConnection class
+    // Connections are owned by the pool
 }
 
 std::vector<ShowTime> MovieRepositorySQL::getShowTimesByMovieId(int id) {
-    const std::string sql = "SELECT ShowTimeID, Date, StartTime, EndTime FROM SHOWTIME WHERE MovieID = ?";
-    auto results = dbConn->executeQuery(sql, {std::to_string(id)});
+    const std::string sql = "SELECT ShowTimeID, StartsAt, EndsAt FROM SHOWTIME "
+                            "WHERE MovieID = ? AND StartsAt IS NOT NULL ORDER BY StartsAt";
+    auto db = pool->reader();
+    auto cursor = db->query(sql, {std::to_string(id)});
     
     std::vector<ShowTime> showTimes;
-    for (const auto& row : results) {
-        int showTimeID = std::stoi(row.at("ShowTimeID"));
-        std::string date = row.at("Date");
-        std::string startTime = row.at("StartTime");
-        std::string endTime = row.at("EndTime");
-        showTimes.emplace_back(showTimeID, date, startTime, endTime);
+    while (cursor.next()) {
+        const ResultRow& row = cursor.row();
+        showTimes.emplace_back(row.getInt(0), row.getInt64(1), row.getInt64(2));
     }
     return showTimes;
 }
 
-
 void MovieRepositorySQL::deleteAllShowTimes(int movieId) {
     const std::string sql = "DELETE FROM SHOWTIME WHERE MovieID = ?";
-    bool success = dbConn->executeNonQuery(sql, {std::to_string(movieId)});
+    bool success = pool->writer()->executeNonQuery(sql, {std::to_string(movieId)});
     
     if (!success) {
         throw std::runtime_error("Failed to delete all showtimes from database");
@@ -167,7 +317,7 @@ void MovieRepositorySQL::deleteAllShowTimes(int movieId) {
 
 void MovieRepositorySQL::deleteShowTime(int movieId, int ShowTimeID) {
     const std::string sql = "DELETE FROM SHOWTIME WHERE MovieID = ? AND ShowTimeID = ?";
-    bool success = dbConn->executeNonQuery(sql, {std::to_string(movieId), std::to_string(ShowTimeID)});
+    bool success = pool->writer()->executeNonQuery(sql, {std::to_string(movieId), std::to_string(ShowTimeID)});
     
     if (!success) {
         throw std::runtime_error("Failed to delete showtime from database");
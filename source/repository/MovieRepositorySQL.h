@@ -10,14 +10,14 @@
 #define MOVIEREPOSITORYSQL_H
 
 #include "../repository/IMovieRepository.h"
-#include "../database/DatabaseConnection.h"
+#include "../database/ConnectionPool.h"
 #include "../model/ShowTime.h"
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 #include <iostream>
 #include <stdexcept>
-#include <regex>
 
 /**
  * @class MovieRepositorySQL
@@ -38,7 +38,7 @@
  * 
  * @par Design Patterns Used
  * - Repository Pattern: Implements IMovieRepository interface
- * - Singleton Pattern: Uses DatabaseConnection singleton
+ * - Object Pool: Leases reader and writer connections from a ConnectionPool
  * - DTO Pattern: Returns MovieDTO objects for data transfer
  * - RAII: Automatic resource management in destructor
  * 
@@ -60,40 +60,48 @@
  * int movieId = repository.addMovie(movie);
  * 
  * // Add showtime
- * std::string date = "2025-06-01";
- * std::string startTime = "19:30";
- * std::string endTime = "22:00";
- * repository.addShowTime(movieId, date, startTime, endTime);
+ * repository.addShowTime(movieId, *ShowTime::toEpoch("2025-06-01", "19:30"),
+ *                        *ShowTime::toEpoch("2025-06-01", "22:00"), auditoriumId);
  * @endcode
  * 
- * @warning Database connection must remain valid throughout repository lifetime
+ * @note Queries lease a reader connection, so catalog reads run in parallel
+ *       with each other and with the booking writer
  * 
  * @see IMovieRepository
- * @see DatabaseConnection
+ * @see ConnectionPool
  * @see MovieDTO
  * @see ShowTime
  */
 class MovieRepositorySQL : public IMovieRepository {
 private:
     /**
-     * @brief Database connection instance
+     * @brief Connections for all SQL operations
      * 
-     * Pointer to the singleton database connection used for all
-     * SQL operations. Managed by DatabaseConnection class lifecycle.
+     * Reads lease a reader, inserts and deletes lease the writer.
+     * Shared with the other repositories of the application.
      */
-    DatabaseConnection* dbConn;
+    std::shared_ptr<ConnectionPool> pool;
 
 public:
+    /**
+     * @brief Constructor with a shared connection pool
+     * 
+     * @param pool Pool lending the reader and writer connections
+     * 
+     * @throws std::invalid_argument if pool is null
+     */
+    explicit MovieRepositorySQL(std::shared_ptr<ConnectionPool> pool);
+
     /**
      * @brief Constructor with database file path
      * 
-     * Initializes the repository with a specific SQLite database file.
-     * Establishes connection and prepares database schema if needed.
+     * Initializes the repository with a specific SQLite database file,
+     * through a ConnectionPool private to this repository.
      * 
      * @param filePath Path to the SQLite database file
      * 
      * @pre filePath is a valid file path
-     * @post dbConn != nullptr and connection is established
+     * @post pool != nullptr and its connections are established
      * 
      * @throws std::runtime_error if database connection fails
      * @throws std::invalid_argument if filePath is empty
@@ -125,6 +133,40 @@ public:
      */
     std::vector<MovieDTO> getAllMovies() override;
 
+    /**
+     * @brief Retrieve one page of movies after a given MovieID
+     * 
+     * Runs @c WHERE MovieID > ? ORDER BY MovieID LIMIT ? on the primary
+     * key, so the cost of a page does not grow with its position in the
+     * catalog (unlike OFFSET).
+     * 
+     * @param afterMovieId Last MovieID of the previous page, 0 for the first page
+     * @param limit Maximum number of movies returned
+     * @return std::vector<MovieDTO> Movies ordered by MovieID
+     * 
+     * @see IMovieRepository::getMoviesPage
+     */
+    std::vector<MovieDTO> getMoviesPage(int afterMovieId, std::size_t limit) override;
+
+    /**
+     * @brief Ranked prefix search through the MOVIE_FTS full-text index
+     * 
+     * Each word of the query becomes a quoted FTS5 prefix term, so the
+     * query never reaches the FTS5 syntax parser as an operator. Results
+     * are ordered by bm25 with the title weighted above the genre and the
+     * genre above the description.
+     * 
+     * @param query Words typed by the user
+     * @param limit Maximum number of movies returned
+     * @return std::vector<MovieDTO> Matching movies, best match first
+     * 
+     * @pre The schema is at version 4 or later (SchemaMigrator), which
+     *      creates MOVIE_FTS and the triggers that keep it up to date
+     * 
+     * @see IMovieRepository::searchMovies
+     */
+    std::vector<MovieDTO> searchMovies(const std::string& query, std::size_t limit) override;
+
     /**
      * @brief Retrieve specific movie by ID
      * 
@@ -166,6 +208,24 @@ public:
      */
     int addMovie(std::shared_ptr<IMovie> movie) override;
 
+    /**
+     * @brief Insert a movie and its showtimes in one IMMEDIATE transaction
+     * 
+     * Validates every showtime first, then inserts the movie and the
+     * showtimes as addShowTimes() does. Any failure rolls back the movie too.
+     * 
+     * @param movie Shared pointer to movie object to add
+     * @param showTimes Showtimes of the new movie (may be empty)
+     * @return int Generated unique movie ID
+     * 
+     * @throws std::invalid_argument if a showtime does not end after it starts
+     * @throws ShowTimeOverlapException if a showtime overlaps another one in its auditorium
+     * @throws std::runtime_error if database operation fails
+     * 
+     * @pre The schema is at version 6 or later (SchemaMigrator)
+     */
+    int addMovie(std::shared_ptr<IMovie> movie, std::span<const ShowTimeSpec> showTimes) override;
+
     /**
      * @brief Delete movie from database
      * 
@@ -188,27 +248,72 @@ public:
     /**
      * @brief Add showtime for a movie
      * 
-     * Creates a new showtime schedule for an existing movie with
-     * date and time validation.
+     * Creates a new showtime schedule for an existing movie.
      * 
      * @param movieId ID of the movie to schedule
-     * @param Date Show date in YYYY-MM-DD format
-     * @param StartTime Start time in HH:MM format
-     * @param EndTime End time in HH:MM format
+     * @param startsAt Start, in epoch seconds
+     * @param endsAt End, in epoch seconds
+     * @param auditoriumId Auditorium the movie is screened in
      * 
      * @pre movieId > 0 and movie exists
-     * @pre Date is valid and in future
-     * @pre StartTime and EndTime are valid and StartTime < EndTime
+     * @pre startsAt is in the future
      * 
      * @post New showtime record created
      * @post Seats initialized for the showtime
      * 
-     * @throws std::invalid_argument if date/time format is invalid
+     * @par Overlap Check
+     * Inside one IMMEDIATE transaction, the SHOWTIME_RTREE interval index is
+     * searched for showtimes of the same auditorium whose (minute-rounded)
+     * box overlaps the new one, their exact times are compared, and the row
+     * is inserted only if none overlaps. The search is logarithmic in the
+     * number of showtimes instead of a scan of SHOWTIME.
+     * 
+     * @throws std::invalid_argument if endsAt is not after startsAt
+     * @throws ShowTimeOverlapException if the auditorium is busy during part of that time
      * @throws std::runtime_error if movie doesn't exist
      * 
-     * @see isValidDate() and isValidTime() for validation rules
+     * @pre The schema is at version 6 or later (SchemaMigrator)
+     */
+    void addShowTime(int movieId, std::int64_t startsAt, std::int64_t endsAt, int auditoriumId) override;
+
+    /**
+     * @brief Add many showtimes of a movie in one IMMEDIATE transaction
+     * 
+     * Validates the whole batch, takes the write lock once, and runs the
+     * overlap check and the insert of each showtime with statements that
+     * are compiled once (the connection's statement cache) for the whole
+     * batch. Scheduling a season this way costs one commit instead of one
+     * per showtime.
+     * 
+     * @param movieId ID of the movie to schedule
+     * @param showTimes Showtimes to add (may be empty)
+     * 
+     * @throws std::invalid_argument if a showtime does not end after it starts
+     * @throws ShowTimeOverlapException if a showtime overlaps another one in its
+     *         auditorium, scheduled or earlier in the batch (nothing is written)
+     * @throws std::runtime_error if database operation fails
+     * 
+     * @pre The schema is at version 6 or later (SchemaMigrator)
+     */
+    void addShowTimes(int movieId, std::span<const ShowTimeSpec> showTimes) override;
+
+    /**
+     * @brief Retrieve the showtimes running during a time window
+     * 
+     * A range search on the SHOWTIME_RTREE interval index, joined to
+     * SHOWTIME and MOVIE for the candidates only.
+     * 
+     * @param from Start of the window, in epoch seconds
+     * @param to End of the window, in epoch seconds
+     * @return std::vector<ScheduledShowTime> Ordered by start time, then auditorium
+     * 
+     * @throws std::invalid_argument if the window is empty
+     * 
+     * @pre The schema is at version 6 or later (SchemaMigrator)
+     * 
+     * @see IMovieRepository::getShowTimesBetween
      */
-    void addShowTime(int movieId, std::string& Date, std::string& StartTime, std::string& EndTime) override;
+    std::vector<ScheduledShowTime> getShowTimesBetween(std::int64_t from, std::int64_t to) override;
 
     /**
      * @brief Delete specific showtime
@@ -236,7 +341,7 @@ public:
      * including available and past showtimes.
      * 
      * @param id Movie ID to get showtimes for
-     * @return std::vector<ShowTime> Vector of showtime objects
+     * @return std::vector<ShowTime> Vector of showtime objects, earliest first
      * 
      * @retval Empty vector if no showtimes exist
      * @retval Vector of ShowTime objects with schedule details
@@ -267,47 +372,10 @@ public:
     /**
      * @brief Destructor - cleanup database resources
      * 
-     * Ensures proper cleanup of database connections and resources.
-     * DatabaseConnection singleton manages actual connection lifecycle.
+     * Releases this repository's share of the connection pool; the
+     * connections close with the last repository using the pool.
      */
     ~MovieRepositorySQL();
 };
 
-/**
- * @brief Validate date format and value
- * 
- * Checks if a date string is in valid YYYY-MM-DD format
- * and represents a real calendar date.
- * 
- * @param date Date string to validate
- * @return bool True if date is valid, false otherwise
- * 
- * @par Validation Rules
- * - Format: YYYY-MM-DD
- * - Year: 1900-2100
- * - Month: 01-12
- * - Day: Valid for the month/year
- * 
- * @see addShowTime() which uses this validation
- */
-bool isValidDate(const std::string &date);
-
-/**
- * @brief Validate time format
- * 
- * Checks if a time string is in valid HH:MM format
- * with proper hour and minute ranges.
- * 
- * @param time Time string to validate
- * @return bool True if time is valid, false otherwise
- * 
- * @par Validation Rules
- * - Format: HH:MM
- * - Hours: 00-23
- * - Minutes: 00-59
- * 
- * @see addShowTime() which uses this validation
- */
-bool isValidTime(const std::string &time);
-
 #endif // MOVIEREPOSITORYSQL_H
\ No newline at end of file
@@ -0,0 +1,46 @@
+/**
+ * @file ScheduledShowTime.h
+ * @brief Read-only view of a showtime together with its movie and auditorium
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef _SCHEDULEDSHOWTIME_H_
+#define _SCHEDULEDSHOWTIME_H_
+#include "../model/ShowTime.h"
+#include <string>
+#include <utility>
+
+/**
+ * @struct ScheduledShowTime
+ * @brief One row of the schedule: what is playing, where and when
+ *
+ * Returned by IMovieRepository::getShowTimesBetween(), which answers
+ * "what is playing between 18:00 and 21:00 on date X" across all movies.
+ *
+ * @par Usage Example
+ * @code
+ * for (const auto& entry : repo->getShowTimesBetween(*ShowTime::toEpoch("2025-05-10", "18:00"),
+ *                                                          *ShowTime::toEpoch("2025-05-10", "21:00"))) {
+ *     std::cout << entry.movieTitle << " in auditorium " << entry.auditoriumID
+ *               << " at " << entry.showTime.startTime() << "\n";
+ * }
+ * @endcode
+ *
+ * @see ShowTime
+ * @see BookingView for the same movie/showtime pairing on bookings
+ */
+struct ScheduledShowTime {
+    int movieID;             ///< Movie being shown
+    std::string movieTitle;  ///< Title of the movie, for display
+    int auditoriumID;        ///< Auditorium the showtime is scheduled in
+    ShowTime showTime;       ///< Showtime ID, start and end
+
+    ScheduledShowTime(int movieID, std::string movieTitle, int auditoriumID, ShowTime showTime)
+        : movieID(movieID), movieTitle(std::move(movieTitle)), auditoriumID(auditoriumID), showTime(std::move(showTime)) {}
+
+    ScheduledShowTime() : movieID(0), auditoriumID(0) {}
+};
+
+#endif
@@ -0,0 +1,23 @@
+#include "SeatCatalog.h"
+#include "../model/SeatFactory.h"
+#include <stdexcept>
+
+std::shared_ptr<const SeatCatalog> SeatCatalog::load(DatabaseConnection* db) {
+    std::shared_ptr<SeatCatalog> catalog(new SeatCatalog());
+    SeatFactory seatFactory;
+
+    auto cursor = db->query("select s.SeatID, s.SeatType, coalesce(s.Price, t.Price, 0) "
+                            "from SEAT s left join SEATTYPE t on t.SeatType = s.SeatType "
+                            "order by s.SeatID");
+    while (cursor.next()) {
+        const ResultRow& row = cursor.row();
+        std::string seatID = row.getString(0);
+        float price = static_cast<float>(row.getDouble(2));
+        catalog->_index.emplace(seatID, catalog->_seats.size());
+        catalog->_seats.emplace_back(seatFactory.createSeat(seatID, SeatFactory::toSeatType(row.getText(1)), price));
+    }
+    if (!cursor.ok()) {
+        throw std::runtime_error("Failed to load the seat catalog.");
+    }
+    return catalog;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file SeatCatalog.h
+ * @brief Immutable, shared set of the theater's seat objects
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef _SEATCATALOG_H_
+#define _SEATCATALOG_H_
+#include "../model/ISeat.h"
+#include "../database/DatabaseConnection.h"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class SeatCatalog
+ * @brief Flyweight store holding exactly one ISeat object per seat
+ *
+ * The catalog is read once from the SEAT and SEATTYPE tables and never
+ * changes afterwards. SeatView and BookingView refer to its entries through
+ * plain const pointers, so building a seat map or a booking history no
+ * longer allocates seat objects or touches shared_ptr reference counts.
+ *
+ * Seats are stored in SeatID order; the position of a seat is its index,
+ * which SeatInventory also uses as the bit number in its bitsets.
+ *
+ * @par Usage Example
+ * @code
+ * auto catalog = SeatCatalog::load(db);
+ *
+ * const ISeat* seat = catalog->find("A1");
+ * std::size_t index = catalog->indexOf("A1"); // 0
+ * for (std::size_t i = 0; i < catalog->size(); ++i) {
+ *     render(catalog->at(i));
+ * }
+ * @endcode
+ *
+ * @warning Pointers handed out by the catalog are valid only while a
+ *          shared_ptr to the catalog is alive (normally the repository's)
+ *
+ * @see SeatInventory
+ * @see SeatView
+ * @see BookingView
+ */
+class SeatCatalog {
+public:
+    /**
+     * @brief Returned by indexOf() for an unknown seat
+     */
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+private:
+    /**
+     * @brief Hash that lets the index be searched with a string_view
+     */
+    struct SeatIDHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view id) const { return std::hash<std::string_view>{}(id); }
+    };
+
+    /**
+     * @brief One seat object per seat, ordered by SeatID
+     */
+    std::vector<std::unique_ptr<ISeat>> _seats;
+
+    /**
+     * @brief SeatID -> position in _seats
+     */
+    std::unordered_map<std::string, std::size_t, SeatIDHash, std::equal_to<>> _index;
+
+    SeatCatalog() = default;
+
+public:
+    SeatCatalog(const SeatCatalog&) = delete;
+    SeatCatalog& operator=(const SeatCatalog&) = delete;
+
+    /**
+     * @brief Read every seat from the database
+     *
+     * The price of a seat comes from SEAT.Price, falling back to the price
+     * of its SEATTYPE when the seat has none.
+     *
+     * @param db Open database connection
+     * @return std::shared_ptr<const SeatCatalog> The immutable catalog
+     *
+     * @throws std::runtime_error If the seats cannot be read
+     */
+    static std::shared_ptr<const SeatCatalog> load(DatabaseConnection* db);
+
+    /**
+     * @brief Number of seats
+     */
+    std::size_t size() const { return _seats.size(); }
+
+    /**
+     * @brief Seat at a position
+     *
+     * @param index Position in SeatID order, must be < size()
+     */
+    const ISeat* at(std::size_t index) const { return _seats[index].get(); }
+
+    /**
+     * @brief Position of a seat
+     *
+     * @param seatID Seat identifier (e.g., "A1")
+     * @return std::size_t Index of the seat, or npos if unknown
+     */
+    std::size_t indexOf(std::string_view seatID) const {
+        auto it = _index.find(seatID);
+        return it == _index.end() ? npos : it->second;
+    }
+
+    /**
+     * @brief Look a seat up by ID
+     *
+     * @param seatID Seat identifier (e.g., "A1")
+     * @return const ISeat* The seat, or nullptr if unknown
+     */
+    const ISeat* find(std::string_view seatID) const {
+        std::size_t index = indexOf(seatID);
+        return index == npos ? nullptr : at(index);
+    }
+};
+
+#endif
@@ -0,0 +1,137 @@
+#include "SeatHoldManager.h"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+SeatHoldManager::SeatHoldManager(std::shared_ptr<const SeatCatalog> catalog, Clock::duration ttl,
+                                 Clock::duration tick, TimeSource now)
+    : _catalog(std::move(catalog)), _ttl(ttl), _tick(tick), _now(std::move(now)), _lastTick(0) {
+    if (ttl <= Clock::duration::zero() || tick <= Clock::duration::zero()) {
+        throw std::invalid_argument("Seat hold TTL and tick must be positive.");
+    }
+    _epoch = _now();
+    // Round up so a hold never expires before its TTL
+    _ttlTicks = static_cast<std::uint64_t>((ttl + tick - Clock::duration(1)) / tick);
+    _wheel.resize(_ttlTicks + 1);
+}
+
+std::uint64_t SeatHoldManager::keyOf(int showTimeID, std::size_t seatIndex) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(showTimeID)) << 32) | static_cast<std::uint32_t>(seatIndex);
+}
+
+std::uint64_t SeatHoldManager::currentTick() const {
+    return static_cast<std::uint64_t>((_now() - _epoch) / _tick);
+}
+
+void SeatHoldManager::expire() {
+    const std::uint64_t now = currentTick();
+    if (now <= _lastTick) {
+        return;
+    }
+    // After a long idle period every slot is visited once, not once per elapsed tick
+    const std::uint64_t steps = std::min<std::uint64_t>(now - _lastTick, _wheel.size());
+    for (std::uint64_t t = _lastTick + 1; t <= _lastTick + steps; ++t) {
+        std::erase_if(_wheel[t % _wheel.size()], [this, now](const WheelEntry& entry) {
+            if (entry.expiryTick > now) {
+                return false;
+            }
+            auto it = _holds.find(entry.key);
+            // A renewed or released hold no longer matches its old wheel entry
+            if (it != _holds.end() && it->second.expiryTick == entry.expiryTick) {
+                _holds.erase(it);
+            }
+            return true;
+        });
+    }
+    _lastTick = now;
+}
+
+bool SeatHoldManager::hold(int showTimeID, std::string_view seatID, int holderID) {
+    std::size_t index = _catalog->indexOf(seatID);
+    if (index == SeatCatalog::npos) {
+        return false;
+    }
+
+    std::lock_guard lock(_mutex);
+    expire();
+    const std::uint64_t key = keyOf(showTimeID, index);
+    auto it = _holds.find(key);
+    if (it != _holds.end() && it->second.holderID != holderID) {
+        return false;
+    }
+
+    const std::uint64_t expiryTick = _lastTick + _ttlTicks;
+    _holds[key] = Hold{holderID, expiryTick};
+    _wheel[expiryTick % _wheel.size()].push_back(WheelEntry{key, expiryTick});
+    return true;
+}
+
+bool SeatHoldManager::release(int showTimeID, std::string_view seatID, int holderID) {
+    std::size_t index = _catalog->indexOf(seatID);
+    if (index == SeatCatalog::npos) {
+        return false;
+    }
+
+    std::lock_guard lock(_mutex);
+    expire();
+    auto it = _holds.find(keyOf(showTimeID, index));
+    if (it == _holds.end() || it->second.holderID != holderID) {
+        return false;
+    }
+    // The wheel entry becomes stale and is dropped when its slot comes up
+    _holds.erase(it);
+    return true;
+}
+
+void SeatHoldManager::release(int showTimeID, const std::vector<std::string>& seatIDs, int holderID) {
+    for (const auto& seatID : seatIDs) {
+        release(showTimeID, seatID, holderID);
+    }
+}
+
+std::size_t SeatHoldManager::releaseAll(int holderID) {
+    std::lock_guard lock(_mutex);
+    expire();
+    return std::erase_if(_holds, [holderID](const auto& entry) {
+        return entry.second.holderID == holderID;
+    });
+}
+
+std::vector<std::string> SeatHoldManager::heldByOthers(int showTimeID, const std::vector<std::string>& seatIDs, int holderID) {
+    std::vector<std::string> held;
+    std::lock_guard lock(_mutex);
+    expire();
+    if (_holds.empty()) {
+        return held;
+    }
+    for (const auto& seatID : seatIDs) {
+        std::size_t index = _catalog->indexOf(seatID);
+        if (index == SeatCatalog::npos) {
+            continue;
+        }
+        auto it = _holds.find(keyOf(showTimeID, index));
+        if (it != _holds.end() && it->second.holderID != holderID) {
+            held.push_back(seatID);
+        }
+    }
+    return held;
+}
+
+void SeatHoldManager::markHeld(int showTimeID, std::vector<SeatView>& seats) {
+    std::lock_guard lock(_mutex);
+    expire();
+    if (_holds.empty()) {
+        return;
+    }
+    for (std::size_t i = 0; i < seats.size(); ++i) {
+        if (seats[i].status == SeatStatus::AVAILABLE && _holds.contains(keyOf(showTimeID, i))) {
+            seats[i].status = SeatStatus::HELD;
+        }
+    }
+}
+
+std::size_t SeatHoldManager::size() {
+    std::lock_guard lock(_mutex);
+    expire();
+    return _holds.size();
+}
@@ -0,0 +1,208 @@
+/**
+ * @file SeatHoldManager.h
+ * @brief Short-lived seat holds placed while a customer selects seats
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef _SEATHOLDMANAGER_H_
+#define _SEATHOLDMANAGER_H_
+#include "SeatView.h"
+#include "SeatCatalog.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class SeatHoldManager
+ * @brief Reserves seats for one holder for a limited time, in memory only
+ *
+ * A hold is placed when a customer clicks a seat in the seat map, so the
+ * seat shows as SeatStatus::HELD to everybody else and createBooking()
+ * rejects it for other users. Holds are not written to SQLite: they exist to
+ * turn most seat collisions into an immediate "seat taken" in the UI instead
+ * of a failed write transaction at commit time.
+ *
+ * Expiry uses a hashed timer wheel: time is cut into ticks and a hold that
+ * expires at tick @c t is filed in slot <tt>t % slots</tt>. The wheel has one
+ * slot more than the TTL spans, so each slot holds entries of a single tick.
+ * Every call first advances the wheel to the current tick and drops the holds
+ * filed in the slots it passes, which costs O(expired holds) instead of a
+ * scan of all holds. Renewed or released holds leave a stale wheel entry
+ * behind; it is recognised by its expiry tick and skipped.
+ *
+ * @details
+ * - Holders are identified by user ID; holding a seat again renews the TTL
+ * - Seat @c i is the catalog entry at index @c i, like in SeatInventory
+ * - All members are guarded by one mutex; every call may expire holds
+ *
+ * @par Usage Example
+ * @code
+ * SeatHoldManager holds(catalog);                  // 2 minute TTL
+ * if (!holds.hold(showTimeId, "A1", userId)) {
+ *     // Someone else is choosing this seat
+ * }
+ * auto seats = inventory.seatsStatus(showTimeId);
+ * holds.markHeld(showTimeId, seats);               // AVAILABLE -> HELD
+ * @endcode
+ *
+ * @note Holds are lost on restart, which only means customers reselect seats
+ * @see SeatInventory
+ * @see BookingRepository::createBooking
+ */
+class SeatHoldManager {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Source of the current time, replaceable in tests
+     */
+    using TimeSource = std::function<Clock::time_point()>;
+
+    /**
+     * @brief How long a hold lasts without being renewed
+     */
+    static constexpr std::chrono::seconds DEFAULT_TTL{120};
+
+    /**
+     * @brief Resolution of the timer wheel; holds expire up to one tick late
+     */
+    static constexpr std::chrono::milliseconds DEFAULT_TICK{1000};
+
+    /**
+     * @brief Create an empty hold table over a seat catalog
+     *
+     * @param catalog Seats that can be held
+     * @param ttl Lifetime of a hold
+     * @param tick Timer wheel resolution
+     * @param now Clock used for expiry
+     *
+     * @throws std::invalid_argument If ttl or tick is not positive
+     */
+    explicit SeatHoldManager(std::shared_ptr<const SeatCatalog> catalog,
+                             Clock::duration ttl = DEFAULT_TTL,
+                             Clock::duration tick = DEFAULT_TICK,
+                             TimeSource now = &Clock::now);
+
+    /**
+     * @brief Hold a seat for a holder, or renew the holder's existing hold
+     *
+     * @param showTimeID Showtime of the seat
+     * @param seatID Seat identifier
+     * @param holderID User placing the hold
+     * @return bool True if the holder now holds the seat; false if another
+     *         holder has it or the seat is unknown
+     */
+    bool hold(int showTimeID, std::string_view seatID, int holderID);
+
+    /**
+     * @brief Release a seat held by a holder
+     *
+     * @return bool False if the holder did not hold the seat
+     */
+    bool release(int showTimeID, std::string_view seatID, int holderID);
+
+    /**
+     * @brief Release several seats of a holder, e.g. after they were booked
+     */
+    void release(int showTimeID, const std::vector<std::string>& seatIDs, int holderID);
+
+    /**
+     * @brief Release every hold of a holder (logout)
+     *
+     * @return std::size_t Number of holds released
+     *
+     * @note Scans all holds; meant for rare events only
+     */
+    std::size_t releaseAll(int holderID);
+
+    /**
+     * @brief Filter a seat list down to seats held by someone else
+     *
+     * @param showTimeID Showtime to inspect
+     * @param seatIDs Requested seats
+     * @param holderID User asking; their own holds are not reported
+     * @return std::vector<std::string> Seats held by others, in the order requested
+     */
+    std::vector<std::string> heldByOthers(int showTimeID, const std::vector<std::string>& seatIDs, int holderID);
+
+    /**
+     * @brief Turn AVAILABLE entries of a seat map into HELD where a hold exists
+     *
+     * @param showTimeID Showtime the map belongs to
+     * @param seats Seat map in catalog order, as built by SeatInventory::seatsStatus()
+     */
+    void markHeld(int showTimeID, std::vector<SeatView>& seats);
+
+    /**
+     * @brief Number of live holds
+     */
+    std::size_t size();
+
+    /**
+     * @brief Lifetime of a hold
+     */
+    Clock::duration ttl() const { return _ttl; }
+
+private:
+    struct Hold {
+        int holderID;
+        std::uint64_t expiryTick;
+    };
+
+    struct WheelEntry {
+        std::uint64_t key;
+        std::uint64_t expiryTick;
+    };
+
+    /**
+     * @brief Pack a showtime and a catalog index into one hash key
+     */
+    static std::uint64_t keyOf(int showTimeID, std::size_t seatIndex);
+
+    /**
+     * @brief Tick number of the current time
+     */
+    std::uint64_t currentTick() const;
+
+    /**
+     * @brief Advance the wheel to the current tick, dropping expired holds
+     *
+     * @note Caller must hold _mutex
+     */
+    void expire();
+
+    std::shared_ptr<const SeatCatalog> _catalog;
+    Clock::duration _ttl;
+    Clock::duration _tick;
+    TimeSource _now;
+    Clock::time_point _epoch;
+    std::uint64_t _ttlTicks;
+
+    /**
+     * @brief keyOf(showtime, seat) -> live hold
+     */
+    std::unordered_map<std::uint64_t, Hold> _holds;
+
+    /**
+     * @brief Slot expiryTick % size() lists the holds expiring at that tick
+     */
+    std::vector<std::vector<WheelEntry>> _wheel;
+
+    /**
+     * @brief Last tick whose slot has been processed
+     */
+    std::uint64_t _lastTick;
+
+    std::mutex _mutex;
+};
+
+#endif
@@ -0,0 +1,102 @@
+#include "SeatInventory.h"
+#include <algorithm>
+#include <bit>
+#include <mutex>
+#include <stdexcept>
+
+SeatInventory::SeatInventory(std::shared_ptr<const SeatCatalog> catalog) : _catalog(std::move(catalog)) {}
+
+void SeatInventory::load(DatabaseConnection* db) {
+    const std::size_t words = wordCount();
+    std::unordered_map<int, std::vector<std::uint64_t>> booked;
+    auto cursor = db->query("select b.ShowTimeID, bs.SeatID from BOOKSEAT bs "
+                            "join BOOKING b on b.BookingID = bs.BookingID");
+    while (cursor.next()) {
+        const ResultRow& row = cursor.row();
+        std::size_t index = _catalog->indexOf(row.getText(1));
+        if (index == SeatCatalog::npos) {
+            continue;
+        }
+        auto& bits = booked[row.getInt(0)];
+        bits.resize(words);
+        bits[index / 64] |= std::uint64_t{1} << (index % 64);
+    }
+    if (!cursor.ok()) {
+        throw std::runtime_error("Failed to load booked seats into the seat inventory.");
+    }
+
+    std::unique_lock lock(_mutex);
+    _booked = std::move(booked);
+}
+
+const std::vector<std::uint64_t>* SeatInventory::bitsFor(int showTimeID) const {
+    auto it = _booked.find(showTimeID);
+    return it == _booked.end() ? nullptr : &it->second;
+}
+
+std::vector<SeatView> SeatInventory::seatsStatus(int showTimeID) const {
+    std::shared_lock lock(_mutex);
+    const auto* bits = bitsFor(showTimeID);
+    const std::size_t seatCount = _catalog->size();
+
+    std::vector<SeatView> seatsView;
+    seatsView.reserve(seatCount);
+    for (std::size_t w = 0; w < wordCount(); ++w) {
+        std::uint64_t word = bits ? (*bits)[w] : 0;
+        std::size_t end = std::min(seatCount, (w + 1) * 64);
+        for (std::size_t i = w * 64; i < end; ++i, word >>= 1) {
+            seatsView.emplace_back(_catalog->at(i), (word & 1) ? SeatStatus::BOOKED : SeatStatus::AVAILABLE);
+        }
+    }
+    return seatsView;
+}
+
+bool SeatInventory::isBooked(int showTimeID, const std::string& seatID) const {
+    std::shared_lock lock(_mutex);
+    const auto* bits = bitsFor(showTimeID);
+    std::size_t index = _catalog->indexOf(seatID);
+    if (!bits || index == SeatCatalog::npos) {
+        return false;
+    }
+    return ((*bits)[index / 64] >> (index % 64)) & 1;
+}
+
+std::vector<std::string> SeatInventory::bookedAmong(int showTimeID, const std::vector<std::string>& seatIDs) const {
+    std::shared_lock lock(_mutex);
+    std::vector<std::string> taken;
+    const auto* bits = bitsFor(showTimeID);
+    if (!bits) {
+        return taken;
+    }
+    for (const auto& seatID : seatIDs) {
+        std::size_t index = _catalog->indexOf(seatID);
+        if (index != SeatCatalog::npos && (((*bits)[index / 64] >> (index % 64)) & 1)) {
+            taken.push_back(seatID);
+        }
+    }
+    return taken;
+}
+
+std::size_t SeatInventory::bookedCount(int showTimeID) const {
+    std::shared_lock lock(_mutex);
+    const auto* bits = bitsFor(showTimeID);
+    std::size_t count = 0;
+    if (bits) {
+        for (std::uint64_t word : *bits) {
+            count += static_cast<std::size_t>(std::popcount(word));
+        }
+    }
+    return count;
+}
+
+void SeatInventory::markBooked(int showTimeID, const std::vector<std::string>& seatIDs) {
+    std::unique_lock lock(_mutex);
+    auto& bits = _booked[showTimeID];
+    bits.resize(wordCount());
+    for (const auto& seatID : seatIDs) {
+        std::size_t index = _catalog->indexOf(seatID);
+        if (index != SeatCatalog::npos) {
+            bits[index / 64] |= std::uint64_t{1} << (index % 64);
+        }
+    }
+}
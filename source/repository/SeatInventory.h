@@ -0,0 +1,151 @@
+/**
+ * @file SeatInventory.h
+ * @brief In-memory per-showtime seat availability index
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef _SEATINVENTORY_H_
+#define _SEATINVENTORY_H_
+#include "SeatView.h"
+#include "SeatCatalog.h"
+#include "../database/DatabaseConnection.h"
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class SeatInventory
+ * @brief Keeps a bitset of booked seats per showtime over a SeatCatalog
+ *
+ * Seat @c i is the catalog entry at index @c i (SeatID order). Each
+ * showtime owns a vector of 64-bit words in which bit @c i is set when
+ * seat @c i is booked, so building a seat map or counting free seats
+ * is a walk over seats/64 words with no SQL involved.
+ *
+ * SQLite stays the durable store: the inventory is warmed from it with
+ * load() and must be told about every committed booking via markBooked().
+ *
+ * @details
+ * - Showtimes without any booking have no bitset and read as all available
+ * - Showtime IDs are AUTOINCREMENT and never reused, so bits of a deleted
+ *   showtime are simply never read again
+ * - Reads take a shared lock, markBooked() and load() an exclusive one
+ *
+ * @par Usage Example
+ * @code
+ * SeatInventory inventory(SeatCatalog::load(db));
+ * inventory.load(db);
+ *
+ * auto seats = inventory.seatsStatus(showTimeId);      // no SQL
+ * auto taken = inventory.bookedAmong(showTimeId, {"A1", "A2"});
+ *
+ * // After a booking has been committed
+ * inventory.markBooked(showTimeId, {"A1", "A2"});
+ * @endcode
+ *
+ * @warning Bookings written by another process are not seen until load() runs again
+ *
+ * @see BookingRepository
+ * @see SeatCatalog
+ * @see SeatView
+ */
+class SeatInventory {
+private:
+    /**
+     * @brief Seats of the theater; index = bit number in the bitsets
+     */
+    std::shared_ptr<const SeatCatalog> _catalog;
+
+    /**
+     * @brief ShowTimeID -> bitset of booked seats
+     */
+    std::unordered_map<int, std::vector<std::uint64_t>> _booked;
+
+    /**
+     * @brief Guards all members; readers share it
+     */
+    mutable std::shared_mutex _mutex;
+
+    /**
+     * @brief Number of 64-bit words needed for one bitset
+     */
+    std::size_t wordCount() const { return (_catalog->size() + 63) / 64; }
+
+    /**
+     * @brief Bitset of a showtime, or nullptr if nothing is booked for it
+     */
+    const std::vector<std::uint64_t>* bitsFor(int showTimeID) const;
+
+public:
+    /**
+     * @brief Create an empty inventory over a seat catalog
+     *
+     * @param catalog Seats the bitsets refer to
+     */
+    explicit SeatInventory(std::shared_ptr<const SeatCatalog> catalog);
+
+    /**
+     * @brief (Re)build the bitsets from the BOOKING and BOOKSEAT tables
+     *
+     * @param db Open database connection
+     *
+     * @throws std::runtime_error If the tables cannot be read
+     */
+    void load(DatabaseConnection* db);
+
+    /**
+     * @brief Seats the inventory is built on
+     */
+    const SeatCatalog& catalog() const { return *_catalog; }
+
+    /**
+     * @brief Status of every seat for a showtime, in SeatID order
+     *
+     * @param showTimeID Showtime to inspect
+     * @return std::vector<SeatView> One entry per seat, pointing into the catalog
+     */
+    std::vector<SeatView> seatsStatus(int showTimeID) const;
+
+    /**
+     * @brief Check whether a seat is booked for a showtime
+     *
+     * @param showTimeID Showtime to inspect
+     * @param seatID Seat identifier
+     * @return bool False for unknown seats
+     */
+    bool isBooked(int showTimeID, const std::string& seatID) const;
+
+    /**
+     * @brief Filter a seat list down to the seats already booked
+     *
+     * @param showTimeID Showtime to inspect
+     * @param seatIDs Requested seats
+     * @return std::vector<std::string> Booked seats, in the order requested
+     */
+    std::vector<std::string> bookedAmong(int showTimeID, const std::vector<std::string>& seatIDs) const;
+
+    /**
+     * @brief Number of booked seats for a showtime (popcount of its bitset)
+     *
+     * @param showTimeID Showtime to inspect
+     */
+    std::size_t bookedCount(int showTimeID) const;
+
+    /**
+     * @brief Record seats of a committed booking
+     *
+     * @param showTimeID Showtime the seats were booked for
+     * @param seatIDs Booked seats; unknown IDs are ignored
+     *
+     * @note Call only after the transaction has been committed
+     */
+    void markBooked(int showTimeID, const std::vector<std::string>& seatIDs);
+};
+
+#endif
@@ -0,0 +1,77 @@
+/**
+ * @file SeatUnavailableException.h
+ * @brief Exception raised when a booking targets seats that are already taken
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ */
+
+#ifndef _SEATUNAVAILABLEEXCEPTION_H_
+#define _SEATUNAVAILABLEEXCEPTION_H_
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <utility>
+
+/**
+ * @class SeatUnavailableException
+ * @brief Signals that one or more requested seats are no longer free
+ *
+ * Thrown by IBookingRepository::createBooking() when another booking already
+ * holds some of the requested seats for the same showtime. Nothing has been
+ * written when this exception is thrown.
+ *
+ * Usage Example:
+ * @code
+ * try {
+ *     bookingRepo->createBooking(userId, showTimeId, {"A1", "A2"});
+ * } catch (const SeatUnavailableException& e) {
+ *     for (const auto& seat : e.seats()) {
+ *         markSeatAsTaken(seat);
+ *     }
+ * }
+ * @endcode
+ *
+ * @see IBookingRepository::createBooking()
+ */
+class SeatUnavailableException : public std::runtime_error {
+private:
+    /**
+     * @brief Showtime the conflict was detected for
+     */
+    int _showTimeID;
+
+    /**
+     * @brief Requested seats that are already booked
+     */
+    std::vector<std::string> _seats;
+
+    static std::string buildMessage(int showTimeID, const std::vector<std::string>& seats) {
+        std::string message = "Seat(s) already booked for showTimeID " + std::to_string(showTimeID) + ":";
+        for (const auto& seat : seats) {
+            message += " " + seat;
+        }
+        return message;
+    }
+
+public:
+    /**
+     * @brief Construct the exception for a showtime and its conflicting seats
+     *
+     * @param showTimeID Showtime that was being booked
+     * @param seats Seats that are already taken
+     */
+    SeatUnavailableException(int showTimeID, std::vector<std::string> seats)
+        : std::runtime_error(buildMessage(showTimeID, seats)), _showTimeID(showTimeID), _seats(std::move(seats)) {}
+
+    /**
+     * @brief Showtime the conflict was detected for
+     */
+    int showTimeID() const { return _showTimeID; }
+
+    /**
+     * @brief Requested seats that are already booked
+     */
+    const std::vector<std::string>& seats() const { return _seats; }
+};
+
+#endif
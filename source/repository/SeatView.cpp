@@ -1,3 +1,3 @@
 #include "SeatView.h"
 
-SeatView::SeatView(std::shared_ptr<ISeat> seat, const SeatStatus& status) : seat(seat), status(status) {}
\ No newline at end of file
+SeatView::SeatView(const ISeat* seat, const SeatStatus& status) : seat(seat), status(status) {}
\ No newline at end of file
@@ -8,7 +8,6 @@
 #ifndef _SEATVIEW_H_
 #define _SEATVIEW_H_
 #include "../model/ISeat.h"
-#include <memory>
 
 /**
  * @enum SeatStatus
@@ -20,6 +19,7 @@
 enum SeatStatus {
     AVAILABLE, ///< Seat is available for booking
     BOOKED,    ///< Seat has been reserved/booked
+    HELD,      ///< Seat is briefly held by a customer who is still selecting seats
 };
 
 /**
@@ -33,7 +33,7 @@ enum SeatStatus {
  * 
  * @details Key Features:
  * - Combines domain object (ISeat) with status information
- * - Lightweight wrapper for UI presentation
+ * - Lightweight wrapper for UI presentation: a pointer and an enum, no allocation
  * - Immutable design after construction
  * - Thread-safe for read operations
  * 
@@ -45,7 +45,7 @@ enum SeatStatus {
  * Usage Example:
  * @code
  * // Create a seat view for UI display
- * std::shared_ptr<ISeat> seat = seatFactory.createSingleSeat("A1", 100.0);
+ * const ISeat* seat = seatCatalog->find("A1");
  * SeatView seatView(seat, SeatStatus::AVAILABLE);
  * 
  * // Use in UI rendering
@@ -58,6 +58,7 @@ enum SeatStatus {
  * 
  * @see ISeat
  * @see SeatStatus
+ * @see SeatCatalog
  * @since 1.0
  */
 class SeatView {
@@ -65,18 +66,20 @@ public:
     /**
      * @brief The seat domain object containing seat details
      * 
-     * Shared pointer to the underlying seat entity that contains
-     * all the seat-specific information such as ID, type, and price.
+     * Pointer to the shared SeatCatalog entry that contains all the
+     * seat-specific information such as ID, type, and price.
      * 
      * @note This should never be null after construction
+     * @warning Not owning: valid only while the catalog (held by the
+     *          repository that produced this view) is alive
      */
-    std::shared_ptr<ISeat> seat;
+    const ISeat* seat;
     
     /**
      * @brief Current booking status of the seat
      * 
-     * Indicates whether the seat is currently available for booking
-     * or has already been reserved by another customer.
+     * Indicates whether the seat is currently available for booking,
+     * has already been reserved, or is held by a customer selecting seats.
      */
     SeatStatus status;
 
@@ -87,7 +90,7 @@ public:
      * Creates a new view model instance that combines the seat domain
      * object with its current booking status for UI presentation.
      * 
-     * @param seat Shared pointer to the seat entity
+     * @param seat Seat entry of the SeatCatalog
      * @param status Current booking status of the seat
      * 
      * @pre seat must not be null
@@ -97,19 +100,17 @@ public:
      * @throw std::invalid_argument if seat is null
      * 
      * @note The constructor creates a lightweight wrapper without copying seat data
-     * @note The seat object is shared, so modifications to the underlying seat
-     *       will be reflected in this view
      * 
      * Usage:
      * @code
-     * auto seat = std::make_shared<SingleSeat>("B5", 150.0);
-     * SeatView view(seat, SeatStatus::AVAILABLE);
+     * SingleSeat seat("B5", SINGLE, 150.0f);
+     * SeatView view(&seat, SeatStatus::AVAILABLE);
      * 
      * // View is ready for UI binding
      * displaySeat(view);
      * @endcode
      */
-    SeatView(std::shared_ptr<ISeat> seat, const SeatStatus& status);
+    SeatView(const ISeat* seat, const SeatStatus& status);
 };
 
 #endif 
\ No newline at end of file
@@ -0,0 +1,77 @@
+/**
+ * @file ShowTimeOverlapException.h
+ * @brief Exception raised when a new showtime overlaps another one in the same auditorium
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ */
+
+#ifndef _SHOWTIMEOVERLAPEXCEPTION_H_
+#define _SHOWTIMEOVERLAPEXCEPTION_H_
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <utility>
+
+/**
+ * @class ShowTimeOverlapException
+ * @brief Signals that an auditorium is already busy during the requested time
+ *
+ * Thrown by IMovieRepository::addShowTime() when the new showtime would run
+ * at the same time as one or more showtimes already scheduled in the same
+ * auditorium. Showtimes that only touch (one ends when the other starts) do
+ * not overlap. Nothing has been written when this exception is thrown.
+ *
+ * Usage Example:
+ * @code
+ * try {
+ *     movieRepo->addShowTime(movieId, startsAt, endsAt, auditoriumId);
+ * } catch (const ShowTimeOverlapException& e) {
+ *     std::cout << "Auditorium " << e.auditoriumID() << " is busy: "
+ *               << e.showTimes().size() << " showtime(s) in the way\n";
+ * }
+ * @endcode
+ *
+ * @see IMovieRepository::addShowTime()
+ */
+class ShowTimeOverlapException : public std::runtime_error {
+private:
+    /**
+     * @brief Auditorium the conflict was detected in
+     */
+    int _auditoriumID;
+
+    /**
+     * @brief Scheduled showtimes that overlap the requested one
+     */
+    std::vector<int> _showTimes;
+
+    static std::string buildMessage(int auditoriumID, const std::vector<int>& showTimes) {
+        std::string message = "Showtime overlaps showTimeID(s) in auditorium " + std::to_string(auditoriumID) + ":";
+        for (int id : showTimes) {
+            message += " " + std::to_string(id);
+        }
+        return message;
+    }
+
+public:
+    /**
+     * @brief Construct the exception for an auditorium and its conflicting showtimes
+     *
+     * @param auditoriumID Auditorium the showtime was scheduled in
+     * @param showTimes Showtimes already scheduled during that time
+     */
+    ShowTimeOverlapException(int auditoriumID, std::vector<int> showTimes)
+        : std::runtime_error(buildMessage(auditoriumID, showTimes)), _auditoriumID(auditoriumID), _showTimes(std::move(showTimes)) {}
+
+    /**
+     * @brief Auditorium the conflict was detected in
+     */
+    int auditoriumID() const { return _auditoriumID; }
+
+    /**
+     * @brief Scheduled showtimes that overlap the requested one
+     */
+    const std::vector<int>& showTimes() const { return _showTimes; }
+};
+
+#endif
@@ -0,0 +1,43 @@
+/**
+ * @file ShowTimeSpec.h
+ * @brief A showtime to be scheduled: when and where, before it has an ID
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef _SHOWTIMESPEC_H_
+#define _SHOWTIMESPEC_H_
+#include <cstdint>
+
+/**
+ * @struct ShowTimeSpec
+ * @brief Input of IMovieRepository::addShowTimes(): one showtime to insert
+ *
+ * Unlike ShowTime it has no showTimeID (the database assigns it) and it
+ * names the auditorium the showtime is scheduled in.
+ *
+ * @par Usage Example
+ * @code
+ * std::vector<ShowTimeSpec> season;
+ * for (const std::string& day : days) {
+ *     season.emplace_back(*ShowTime::toEpoch(day, "19:30"), *ShowTime::toEpoch(day, "22:00"), 2);
+ * }
+ * repo->addShowTimes(movieId, season);   // one transaction for the whole season
+ * @endcode
+ *
+ * @see IMovieRepository::addShowTimes
+ * @see ShowTime::toEpoch
+ */
+struct ShowTimeSpec {
+    std::int64_t startsAt; ///< Start, in epoch seconds
+    std::int64_t endsAt;   ///< End, in epoch seconds, after startsAt
+    int auditoriumID;      ///< Auditorium the movie is screened in
+
+    ShowTimeSpec(std::int64_t startsAt, std::int64_t endsAt, int auditoriumID)
+        : startsAt(startsAt), endsAt(endsAt), auditoriumID(auditoriumID) {}
+
+    ShowTimeSpec() : startsAt(0), endsAt(0), auditoriumID(0) {}
+};
+
+#endif
@@ -0,0 +1,96 @@
+/**
+ * @file BookingProtocol.h
+ * @brief Wire format spoken between booking clients and BookingServer
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef _BOOKINGPROTOCOL_H_
+#define _BOOKINGPROTOCOL_H_
+#include <SFML/Network/Packet.hpp>
+
+/**
+ * @brief Operations a client can request, one per sf::Packet
+ *
+ * Every request starts with <tt>sf::Uint32 requestID, sf::Uint8 Command</tt>,
+ * followed by the arguments listed below. Integers are sf::Int32, counts are
+ * sf::Uint32, ratings are float and text is std::string, all in sf::Packet
+ * encoding (network byte order, length-prefixed strings).
+ *
+ * | Command         | Arguments                                                  | OK payload |
+ * |-----------------|------------------------------------------------------------|------------|
+ * | LOGIN           | userName, password                                         | userID, userName, role |
+ * | LOGOUT          | -                                                          | - |
+ * | LIST_MOVIES     | -                                                          | count, {id, title, genre, rating} |
+ * | MOVIE_DETAIL    | movieID                                                    | id, title, genre, description, rating |
+ * | LIST_SHOWTIMES  | movieID                                                    | count, {showTimeID, date, startTime, endTime} |
+ * | SEAT_STATUS     | showTimeID                                                 | count, {seatID, Uint8 SeatType, price, Uint8 SeatStatus} |
+ * | HOLD_SEAT       | showTimeID, seatID                                         | - |
+ * | RELEASE_SEAT    | showTimeID, seatID                                         | - |
+ * | CREATE_BOOKING  | showTimeID, count, {seatID}                                | bookingID |
+ * | BOOKING_HISTORY | -                                                          | count, {bookingID, movieID, title, showTimeID, date, startTime, endTime, count, {seatID}, totalPrice} |
+ * | ADD_MOVIE       | title, genre, description, rating, count, {"date,start,end"} | - |
+ * | DELETE_MOVIE    | movieID                                                    | - |
+ * | DELETE_SHOWTIME | movieID, showTimeID                                        | - |
+ *
+ * Booking commands act for the user logged in on the connection; LOGIN is
+ * the only way to become that user.
+ */
+enum class Command : sf::Uint8 {
+    LOGIN = 1,
+    LOGOUT,
+    LIST_MOVIES,
+    MOVIE_DETAIL,
+    LIST_SHOWTIMES,
+    SEAT_STATUS,
+    HOLD_SEAT,
+    RELEASE_SEAT,
+    CREATE_BOOKING,
+    BOOKING_HISTORY,
+    ADD_MOVIE,
+    DELETE_MOVIE,
+    DELETE_SHOWTIME,
+};
+
+/**
+ * @brief Outcome of a request
+ *
+ * Every response starts with <tt>sf::Uint32 requestID, sf::Uint8 Status</tt>,
+ * echoing the request ID so clients may pipeline requests. OK is followed by
+ * the command's payload; any other status by a std::string message.
+ * SEAT_UNAVAILABLE additionally carries <tt>count, {seatID}</tt> with the
+ * seats that are booked or held by someone else.
+ */
+enum class Status : sf::Uint8 {
+    OK = 0,
+    BAD_REQUEST,       ///< Unknown command or malformed arguments
+    UNAUTHORIZED,      ///< The connection's role may not use this service (or bad credentials)
+    NOT_FOUND,         ///< Movie or showtime does not exist
+    SEAT_UNAVAILABLE,  ///< Seats are booked or held by another user
+    SERVER_ERROR,      ///< The service failed; see the message
+};
+
+inline sf::Packet& operator<<(sf::Packet& packet, Command command) {
+    return packet << static_cast<sf::Uint8>(command);
+}
+
+inline sf::Packet& operator>>(sf::Packet& packet, Command& command) {
+    sf::Uint8 value = 0;
+    packet >> value;
+    command = static_cast<Command>(value);
+    return packet;
+}
+
+inline sf::Packet& operator<<(sf::Packet& packet, Status status) {
+    return packet << static_cast<sf::Uint8>(status);
+}
+
+inline sf::Packet& operator>>(sf::Packet& packet, Status& status) {
+    sf::Uint8 value = 0;
+    packet >> value;
+    status = static_cast<Status>(value);
+    return packet;
+}
+
+#endif
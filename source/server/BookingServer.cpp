@@ -0,0 +1,473 @@
+#include "BookingServer.h"
+#include "../visitor/LoginServiceVisitor.h"
+#include "../visitor/BookingServiceVisitor.h"
+#include "../visitor/MovieViewerServiceVisitor.h"
+#include "../visitor/MovieMangerServiceVisitor.h"
+#include "../repository/SeatUnavailableException.h"
+#include "../model/Movie.h"
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+
+template <typename Visitor>
+std::shared_ptr<Visitor> visit(SessionManager& session) {
+    auto visitor = std::make_shared<Visitor>();
+    session.getCurrentContext()->accept(visitor);
+    return visitor;
+}
+
+}
+
+BookingServer::BookingServer(unsigned short port)
+    : port(port), running(false) {}
+
+bool BookingServer::start() {
+    if (listener.listen(port) != sf::Socket::Done) {
+        std::cerr << "[BookingServer] Cannot listen on port " << port << "\n";
+        return false;
+    }
+    selector.add(listener);
+    std::cout << "[BookingServer] Listening on port " << port << "\n";
+    return true;
+}
+
+void BookingServer::run() {
+    running = true;
+    while (running) {
+        // Wake up regularly so stop() takes effect without a client sending anything,
+        // and more often while responses wait for a slow reader
+        bool queued = std::any_of(clients.begin(), clients.end(),
+                                  [](const Client& client) { return !client.outgoing.empty(); });
+        bool ready = selector.wait(sf::milliseconds(queued ? FLUSH_INTERVAL_MS : POLL_INTERVAL_MS));
+
+        if (ready && selector.isReady(listener)) {
+            acceptClient();
+        }
+
+        for (auto it = clients.begin(); it != clients.end();) {
+            bool connected = true;
+            if (ready && selector.isReady(*it->socket)) {
+                connected = serve(*it);
+            }
+            if (connected && !it->outgoing.empty()) {
+                connected = flush(*it);
+            }
+            if (!connected) {
+                disconnect(*it);
+                it = clients.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    for (auto& client : clients) {
+        disconnect(client);
+    }
+    clients.clear();
+    selector.clear();
+    listener.close();
+    std::cout << "[BookingServer] Stopped.\n";
+}
+
+void BookingServer::stop() {
+    running = false;
+}
+
+std::size_t BookingServer::clientCount() const {
+    return clients.size();
+}
+
+void BookingServer::acceptClient() {
+    auto socket = std::make_unique<sf::TcpSocket>();
+    if (listener.accept(*socket) != sf::Socket::Done) {
+        return;
+    }
+    socket->setBlocking(false);
+    selector.add(*socket);
+    Client client;
+    client.socket = std::move(socket);
+    client.session = std::make_unique<SessionManager>();
+    clients.push_back(std::move(client));
+}
+
+bool BookingServer::serve(Client& client) {
+    while (true) {
+        sf::Packet request;
+        sf::Socket::Status status = client.socket->receive(request);
+        if (status == sf::Socket::NotReady || status == sf::Socket::Partial) {
+            // SFML keeps the partial packet inside the socket until the rest arrives
+            return true;
+        }
+        if (status != sf::Socket::Done) {
+            return false;
+        }
+
+        sf::Uint32 requestID = 0;
+        sf::Packet response;
+        if (!(request >> requestID)) {
+            response << requestID;
+            fail(response, Status::BAD_REQUEST, "Missing request ID");
+        } else {
+            response << requestID;
+            dispatch(client, request, response);
+        }
+        if (!send(client, response)) {
+            return false;
+        }
+    }
+}
+
+void BookingServer::disconnect(Client& client) {
+    // Seats the user was still choosing become free right away instead of after the hold TTL
+    releaseHeldSeats(client);
+    selector.remove(*client.socket);
+    client.socket->disconnect();
+}
+
+void BookingServer::releaseHeldSeats(Client& client) {
+    if (client.heldSeats.empty() || !client.session->isUserAuthenticated()) {
+        client.heldSeats.clear();
+        return;
+    }
+    auto bookingService = visit<BookingServiceVisitor>(*client.session)->getBookingService();
+    const int userID = client.session->getCurrentAccount().userID;
+    for (const auto& [showTimeID, seatID] : client.heldSeats) {
+        // Holds belong to the user: keep a seat the same user also picked on another kiosk
+        bool heldElsewhere = std::any_of(clients.begin(), clients.end(), [&](const Client& other) {
+            return &other != &client && other.session->isUserAuthenticated() &&
+                   other.session->getCurrentAccount().userID == userID &&
+                   other.heldSeats.count({showTimeID, seatID}) > 0;
+        });
+        if (bookingService && !heldElsewhere) {
+            bookingService->releaseSeat(userID, showTimeID, seatID);
+        }
+    }
+    client.heldSeats.clear();
+}
+
+bool BookingServer::send(Client& client, const sf::Packet& packet) {
+    if (client.outgoing.size() >= MAX_QUEUED_RESPONSES) {
+        std::cerr << "[BookingServer] Client does not read its responses; disconnecting\n";
+        return false;
+    }
+    if (client.outgoing.empty()) {
+        client.lastSendProgress = std::chrono::steady_clock::now();
+    }
+    client.outgoing.push_back(packet);
+    return flush(client);
+}
+
+bool BookingServer::flush(Client& client) {
+    while (!client.outgoing.empty()) {
+        // A Partial packet must be sent again as is; SFML tracks how much already went out
+        sf::Socket::Status status = client.socket->send(client.outgoing.front());
+        if (status == sf::Socket::Done) {
+            client.outgoing.pop_front();
+            client.lastSendProgress = std::chrono::steady_clock::now();
+        } else if (status == sf::Socket::Partial) {
+            client.lastSendProgress = std::chrono::steady_clock::now();
+            return true;
+        } else if (status == sf::Socket::NotReady) {
+            if (std::chrono::steady_clock::now() - client.lastSendProgress > std::chrono::milliseconds(SEND_TIMEOUT_MS)) {
+                std::cerr << "[BookingServer] Client stopped reading for " << SEND_TIMEOUT_MS / 1000
+                          << " s; disconnecting\n";
+                return false;
+            }
+            return true;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+void BookingServer::dispatch(Client& client, sf::Packet& request, sf::Packet& response) {
+    Command command;
+    if (!(request >> command)) {
+        fail(response, Status::BAD_REQUEST, "Missing command");
+        return;
+    }
+
+    try {
+        switch (command) {
+        case Command::LOGIN:           login(client, request, response); break;
+        case Command::LOGOUT:          logout(client, response); break;
+        case Command::LIST_MOVIES:     listMovies(client, response); break;
+        case Command::MOVIE_DETAIL:    movieDetail(client, request, response); break;
+        case Command::LIST_SHOWTIMES:  listShowTimes(client, request, response); break;
+        case Command::SEAT_STATUS:     seatStatus(client, request, response); break;
+        case Command::HOLD_SEAT:       holdSeat(client, request, response); break;
+        case Command::RELEASE_SEAT:    releaseSeat(client, request, response); break;
+        case Command::CREATE_BOOKING:  createBooking(client, request, response); break;
+        case Command::BOOKING_HISTORY: bookingHistory(client, response); break;
+        case Command::ADD_MOVIE:       addMovie(client, request, response); break;
+        case Command::DELETE_MOVIE:    deleteMovie(client, request, response); break;
+        case Command::DELETE_SHOWTIME: deleteShowTime(client, request, response); break;
+        default:
+            fail(response, Status::BAD_REQUEST, "Unknown command");
+        }
+    } catch (const SeatUnavailableException& e) {
+        response << Status::SEAT_UNAVAILABLE << std::string(e.what())
+                 << static_cast<sf::Uint32>(e.seats().size());
+        for (const auto& seat : e.seats()) {
+            response << seat;
+        }
+    } catch (const std::invalid_argument& e) {
+        fail(response, Status::BAD_REQUEST, e.what());
+    } catch (const std::exception& e) {
+        std::cerr << "[BookingServer] Request failed: " << e.what() << "\n";
+        fail(response, Status::SERVER_ERROR, e.what());
+    }
+}
+
+void BookingServer::login(Client& client, sf::Packet& request, sf::Packet& response) {
+    std::string userName, password;
+    if (!(request >> userName >> password)) {
+        fail(response, Status::BAD_REQUEST, "LOGIN expects user name and password");
+        return;
+    }
+    auto loginService = visit<LoginServiceVisitor>(*client.session)->getLoginService();
+    if (!loginService) {
+        fail(response, Status::UNAUTHORIZED, "Already logged in");
+        return;
+    }
+    auto account = loginService->authenticate(userName, password);
+    if (!account.has_value()) {
+        fail(response, Status::UNAUTHORIZED, "Invalid credentials");
+        return;
+    }
+    client.session->setUserContext(account.value());
+    response << Status::OK << static_cast<sf::Int32>(account->userID) << account->userName << account->role;
+}
+
+void BookingServer::logout(Client& client, sf::Packet& response) {
+    if (!client.session->isUserAuthenticated()) {
+        fail(response, Status::UNAUTHORIZED, "Not logged in");
+        return;
+    }
+    releaseHeldSeats(client);
+    client.session->logout();
+    response << Status::OK;
+}
+
+void BookingServer::listMovies(Client& client, sf::Packet& response) {
+    auto movieService = visit<MovieViewerServiceVisitor>(*client.session)->getMovieViewerService();
+    if (!movieService) {
+        fail(response, Status::UNAUTHORIZED, "Movie catalog not available");
+        return;
+    }
+    auto movies = movieService->showAllMovies();
+    response << Status::OK << static_cast<sf::Uint32>(movies.size());
+    for (const auto& movie : movies) {
+        response << static_cast<sf::Int32>(movie.id) << movie.title << movie.genre << movie.rating;
+    }
+}
+
+void BookingServer::movieDetail(Client& client, sf::Packet& request, sf::Packet& response) {
+    sf::Int32 movieID = 0;
+    if (!(request >> movieID)) {
+        fail(response, Status::BAD_REQUEST, "MOVIE_DETAIL expects a movie ID");
+        return;
+    }
+    auto movieService = visit<MovieViewerServiceVisitor>(*client.session)->getMovieViewerService();
+    if (!movieService) {
+        fail(response, Status::UNAUTHORIZED, "Movie catalog not available");
+        return;
+    }
+    auto movie = movieService->showMovieDetail(movieID);
+    if (!movie) {
+        fail(response, Status::NOT_FOUND, "Movie not found");
+        return;
+    }
+    response << Status::OK << static_cast<sf::Int32>(movie->getId()) << movie->getTitle()
+             << movie->getGenre() << movie->getDescription() << movie->getRating();
+}
+
+void BookingServer::listShowTimes(Client& client, sf::Packet& request, sf::Packet& response) {
+    sf::Int32 movieID = 0;
+    if (!(request >> movieID)) {
+        fail(response, Status::BAD_REQUEST, "LIST_SHOWTIMES expects a movie ID");
+        return;
+    }
+    auto movieService = visit<MovieViewerServiceVisitor>(*client.session)->getMovieViewerService();
+    if (!movieService) {
+        fail(response, Status::UNAUTHORIZED, "Movie catalog not available");
+        return;
+    }
+    auto showTimes = movieService->showMovieShowTimes(movieID);
+    response << Status::OK << static_cast<sf::Uint32>(showTimes.size());
+    for (const auto& showTime : showTimes) {
+        response << static_cast<sf::Int32>(showTime.showTimeID) << showTime.date()
+                 << showTime.startTime() << showTime.endTime();
+    }
+}
+
+void BookingServer::seatStatus(Client& client, sf::Packet& request, sf::Packet& response) {
+    sf::Int32 showTimeID = 0;
+    if (!(request >> showTimeID)) {
+        fail(response, Status::BAD_REQUEST, "SEAT_STATUS expects a showtime ID");
+        return;
+    }
+    auto bookingService = visit<BookingServiceVisitor>(*client.session)->getBookingService();
+    if (!bookingService) {
+        fail(response, Status::UNAUTHORIZED, "Log in to see seats");
+        return;
+    }
+    auto seats = bookingService->viewSeatsStatus(showTimeID);
+    response << Status::OK << static_cast<sf::Uint32>(seats.size());
+    for (const auto& view : seats) {
+        response << view.seat->id() << static_cast<sf::Uint8>(view.seat->type())
+                 << view.seat->price() << static_cast<sf::Uint8>(view.status);
+    }
+}
+
+void BookingServer::holdSeat(Client& client, sf::Packet& request, sf::Packet& response) {
+    sf::Int32 showTimeID = 0;
+    std::string seatID;
+    if (!(request >> showTimeID >> seatID)) {
+        fail(response, Status::BAD_REQUEST, "HOLD_SEAT expects a showtime ID and a seat ID");
+        return;
+    }
+    auto bookingService = visit<BookingServiceVisitor>(*client.session)->getBookingService();
+    if (!bookingService) {
+        fail(response, Status::UNAUTHORIZED, "Log in to book seats");
+        return;
+    }
+    if (!bookingService->holdSeat(client.session->getCurrentAccount().userID, showTimeID, seatID)) {
+        response << Status::SEAT_UNAVAILABLE << std::string("Seat is booked or held by another customer")
+                 << sf::Uint32(1) << seatID;
+        return;
+    }
+    client.heldSeats.emplace(showTimeID, seatID);
+    response << Status::OK;
+}
+
+void BookingServer::releaseSeat(Client& client, sf::Packet& request, sf::Packet& response) {
+    sf::Int32 showTimeID = 0;
+    std::string seatID;
+    if (!(request >> showTimeID >> seatID)) {
+        fail(response, Status::BAD_REQUEST, "RELEASE_SEAT expects a showtime ID and a seat ID");
+        return;
+    }
+    auto bookingService = visit<BookingServiceVisitor>(*client.session)->getBookingService();
+    if (!bookingService) {
+        fail(response, Status::UNAUTHORIZED, "Log in to book seats");
+        return;
+    }
+    bookingService->releaseSeat(client.session->getCurrentAccount().userID, showTimeID, seatID);
+    client.heldSeats.erase({showTimeID, seatID});
+    response << Status::OK;
+}
+
+void BookingServer::createBooking(Client& client, sf::Packet& request, sf::Packet& response) {
+    sf::Int32 showTimeID = 0;
+    sf::Uint32 count = 0;
+    if (!(request >> showTimeID >> count)) {
+        fail(response, Status::BAD_REQUEST, "CREATE_BOOKING expects a showtime ID and seats");
+        return;
+    }
+    // The count comes from the client: read seats one by one instead of reserving it
+    std::vector<std::string> seats;
+    for (sf::Uint32 i = 0; i < count; ++i) {
+        std::string seatID;
+        if (!(request >> seatID)) {
+            fail(response, Status::BAD_REQUEST, "Seat list is shorter than its count");
+            return;
+        }
+        seats.push_back(std::move(seatID));
+    }
+    auto bookingService = visit<BookingServiceVisitor>(*client.session)->getBookingService();
+    if (!bookingService) {
+        fail(response, Status::UNAUTHORIZED, "Log in to book seats");
+        return;
+    }
+    int bookingID = bookingService->createBooking(client.session->getCurrentAccount().userID, showTimeID, seats);
+    // Booked seats are no longer this connection's holds
+    for (const auto& seatID : seats) {
+        client.heldSeats.erase({showTimeID, seatID});
+    }
+    response << Status::OK << static_cast<sf::Int32>(bookingID);
+}
+
+void BookingServer::bookingHistory(Client& client, sf::Packet& response) {
+    auto bookingService = visit<BookingServiceVisitor>(*client.session)->getBookingService();
+    if (!bookingService) {
+        fail(response, Status::UNAUTHORIZED, "Log in to see bookings");
+        return;
+    }
+    auto bookings = bookingService->viewBookingHistory(client.session->getCurrentAccount().userID);
+    response << Status::OK << static_cast<sf::Uint32>(bookings.size());
+    for (const auto& booking : bookings) {
+        response << static_cast<sf::Int32>(booking.bookingID) << static_cast<sf::Int32>(booking.movieID)
+                 << booking.movieTitle << static_cast<sf::Int32>(booking.showTime.showTimeID)
+                 << booking.showTime.date() << booking.showTime.startTime() << booking.showTime.endTime()
+                 << static_cast<sf::Uint32>(booking.bookedSeats.size());
+        for (const ISeat* seat : booking.bookedSeats) {
+            response << seat->id();
+        }
+        response << booking.totalPrice;
+    }
+}
+
+void BookingServer::addMovie(Client& client, sf::Packet& request, sf::Packet& response) {
+    std::string title, genre, description;
+    float rating = 0.0f;
+    sf::Uint32 count = 0;
+    if (!(request >> title >> genre >> description >> rating >> count)) {
+        fail(response, Status::BAD_REQUEST, "ADD_MOVIE expects title, genre, description, rating and showtimes");
+        return;
+    }
+    std::vector<std::string> showTimes;
+    for (sf::Uint32 i = 0; i < count; ++i) {
+        std::string showTime;
+        if (!(request >> showTime)) {
+            fail(response, Status::BAD_REQUEST, "Showtime list is shorter than its count");
+            return;
+        }
+        showTimes.push_back(std::move(showTime));
+    }
+    auto managerService = visit<MovieManagerServiceVisitor>(*client.session)->getMovieManagerService();
+    if (!managerService) {
+        fail(response, Status::UNAUTHORIZED, "Only administrators can add movies");
+        return;
+    }
+    managerService->addMovie(std::make_shared<Movie>(title, genre, description, rating), showTimes);
+    response << Status::OK;
+}
+
+void BookingServer::deleteMovie(Client& client, sf::Packet& request, sf::Packet& response) {
+    sf::Int32 movieID = 0;
+    if (!(request >> movieID)) {
+        fail(response, Status::BAD_REQUEST, "DELETE_MOVIE expects a movie ID");
+        return;
+    }
+    auto managerService = visit<MovieManagerServiceVisitor>(*client.session)->getMovieManagerService();
+    if (!managerService) {
+        fail(response, Status::UNAUTHORIZED, "Only administrators can delete movies");
+        return;
+    }
+    managerService->deleteMovie(movieID);
+    response << Status::OK;
+}
+
+void BookingServer::deleteShowTime(Client& client, sf::Packet& request, sf::Packet& response) {
+    sf::Int32 movieID = 0, showTimeID = 0;
+    if (!(request >> movieID >> showTimeID)) {
+        fail(response, Status::BAD_REQUEST, "DELETE_SHOWTIME expects a movie ID and a showtime ID");
+        return;
+    }
+    auto managerService = visit<MovieManagerServiceVisitor>(*client.session)->getMovieManagerService();
+    if (!managerService) {
+        fail(response, Status::UNAUTHORIZED, "Only administrators can delete showtimes");
+        return;
+    }
+    managerService->deleteShowTime(movieID, showTimeID);
+    response << Status::OK;
+}
+
+void BookingServer::fail(sf::Packet& response, Status status, const std::string& message) {
+    response << status << message;
+}
@@ -0,0 +1,211 @@
+/**
+ * @file BookingServer.h
+ * @brief Headless TCP front end for the booking services
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef _BOOKINGSERVER_H_
+#define _BOOKINGSERVER_H_
+#include "BookingProtocol.h"
+#include "../SessionManager.h"
+#include <SFML/Network.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @class BookingServer
+ * @brief Serves IBookingService, IMovieViewerService and IMovieManagerService over TCP
+ *
+ * The server uses the services registered by ServiceBootstrap, so every
+ * client books against the same ConnectionPool, SeatInventory and seat holds
+ * as the other clients. Requests and responses are sf::Packet frames as
+ * described in BookingProtocol.h.
+ *
+ * Each connection owns a SessionManager and starts as a guest. Access is
+ * checked exactly like in the UI: the session's context accepts a service
+ * visitor, and a null service means the role may not use it (UNAUTHORIZED).
+ *
+ * @details
+ * - One thread runs an sf::SocketSelector loop over the listener and all clients
+ * - Sockets are non-blocking, so a client sending half a packet stalls nobody
+ * - Responses wait in a per-client queue that is flushed whenever the socket
+ *   takes more; a client that stops reading is dropped after SEND_TIMEOUT_MS
+ *   or MAX_QUEUED_RESPONSES instead of holding up the loop
+ * - Seat holds taken through a connection are released when it logs out or
+ *   closes; holds of the same user on another connection are kept
+ *
+ * @par Usage Example
+ * @code
+ * auto services = ServiceBootstrap::initialize("database.db", "./database/database.sql",
+ *                                              ConnectionProfile::server());
+ * BookingServer server(53000);
+ * if (server.start()) {
+ *     server.run();          // returns after stop()
+ * }
+ * @endcode
+ *
+ * @note The services and the pool are thread-safe; requests are handled on
+ *       one thread only because SQLite admits a single writer anyway
+ * @see BookingProtocol.h
+ * @see ServiceBootstrap
+ */
+class BookingServer {
+public:
+    /**
+     * @brief Default TCP port
+     */
+    static constexpr unsigned short DEFAULT_PORT = 53000;
+
+    /**
+     * @brief Create a server that will listen on a port
+     */
+    explicit BookingServer(unsigned short port = DEFAULT_PORT);
+
+    BookingServer(const BookingServer&) = delete;
+    BookingServer& operator=(const BookingServer&) = delete;
+
+    /**
+     * @brief Start listening
+     *
+     * @return bool False if the port cannot be bound
+     */
+    bool start();
+
+    /**
+     * @brief Accept clients and answer requests until stop() is called
+     */
+    void run();
+
+    /**
+     * @brief Ask run() to return; safe to call from another thread or a signal handler
+     */
+    void stop();
+
+    /**
+     * @brief Number of connected clients
+     */
+    std::size_t clientCount() const;
+
+private:
+    /**
+     * @brief One connection and the session it is logged in with
+     */
+    struct Client {
+        std::unique_ptr<sf::TcpSocket> socket;
+        std::unique_ptr<SessionManager> session;
+        /// (showtime, seat) held through this connection, released when it logs out or closes
+        std::set<std::pair<int, std::string>> heldSeats;
+        /// Responses not yet accepted by the socket; the front one may be partly sent
+        std::deque<sf::Packet> outgoing;
+        /// Last time the socket took (part of) a response, or the queue became non-empty
+        std::chrono::steady_clock::time_point lastSendProgress;
+    };
+
+    /**
+     * @brief How long the selector waits before checking the stop flag
+     */
+    static constexpr int POLL_INTERVAL_MS = 200;
+
+    /**
+     * @brief How long the selector waits while responses are queued (the selector only reports readable sockets)
+     */
+    static constexpr int FLUSH_INTERVAL_MS = 10;
+
+    /**
+     * @brief A client whose socket takes nothing for this long is disconnected
+     */
+    static constexpr int SEND_TIMEOUT_MS = 10000;
+
+    /**
+     * @brief A client with this many unread responses is disconnected
+     */
+    static constexpr std::size_t MAX_QUEUED_RESPONSES = 64;
+
+    void acceptClient();
+
+    /**
+     * @brief Read and answer every complete packet a client has sent
+     *
+     * @return bool False once the client has disconnected
+     */
+    bool serve(Client& client);
+
+    /**
+     * @brief Release the client's seat holds and close its socket
+     */
+    void disconnect(Client& client);
+
+    /**
+     * @brief Release the seats held through this connection
+     *
+     * Seats the same user also holds through another connection stay held.
+     */
+    void releaseHeldSeats(Client& client);
+
+    /**
+     * @brief Queue a response and send as much of the queue as the socket takes
+     *
+     * @return bool False if the client must be disconnected (socket error or too many unread responses)
+     */
+    bool send(Client& client, const sf::Packet& packet);
+
+    /**
+     * @brief Send queued responses until the queue is empty or the socket would block
+     *
+     * Never waits: what the socket does not take now is retried on the next
+     * pass of run().
+     *
+     * @return bool False if the client must be disconnected (socket error or SEND_TIMEOUT_MS without progress)
+     */
+    bool flush(Client& client);
+
+    /**
+     * @brief Decode one request and run it against the client's session
+     *
+     * @param client Connection the request arrived on
+     * @param request Packet positioned after the request ID
+     * @param response Packet positioned after the request ID; receives status and payload
+     */
+    void dispatch(Client& client, sf::Packet& request, sf::Packet& response);
+
+    void login(Client& client, sf::Packet& request, sf::Packet& response);
+    void logout(Client& client, sf::Packet& response);
+    void listMovies(Client& client, sf::Packet& response);
+    void movieDetail(Client& client, sf::Packet& request, sf::Packet& response);
+    void listShowTimes(Client& client, sf::Packet& request, sf::Packet& response);
+    void seatStatus(Client& client, sf::Packet& request, sf::Packet& response);
+    void holdSeat(Client& client, sf::Packet& request, sf::Packet& response);
+    void releaseSeat(Client& client, sf::Packet& request, sf::Packet& response);
+    void createBooking(Client& client, sf::Packet& request, sf::Packet& response);
+    void bookingHistory(Client& client, sf::Packet& response);
+    void addMovie(Client& client, sf::Packet& request, sf::Packet& response);
+    void deleteMovie(Client& client, sf::Packet& request, sf::Packet& response);
+    void deleteShowTime(Client& client, sf::Packet& request, sf::Packet& response);
+
+    /**
+     * @brief Write a non-OK status followed by its message
+     */
+    static void fail(sf::Packet& response, Status status, const std::string& message);
+
+    unsigned short port;
+    sf::TcpListener listener;
+    sf::SocketSelector selector;
+
+    /**
+     * @brief Connected clients; sockets are heap-allocated because the selector keeps their addresses
+     */
+    std::vector<Client> clients;
+
+    std::atomic<bool> running;
+};
+
+#endif
@@ -0,0 +1,48 @@
+#include "BookingServer.h"
+#include "../core/ServiceBootstrap.h"
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace {
+
+BookingServer* activeServer = nullptr;
+
+void handleSignal(int) {
+    if (activeServer) {
+        activeServer->stop();
+    }
+}
+
+}
+
+// Usage: BookingServer [port] [database file]
+int main(int argc, char** argv) {
+    unsigned short port = argc > 1 ? static_cast<unsigned short>(std::atoi(argv[1])) : BookingServer::DEFAULT_PORT;
+    std::string dbFilePath = argc > 2 ? argv[2] : "database.db";
+
+    std::cout << "=== Movie Ticket Booking Server ===" << std::endl;
+    std::cout << "Database: " << dbFilePath << "\n";
+
+    // Server profile: WAL with a larger cache and a longer busy timeout than the kiosk
+    ServiceBootstrap::Services services;
+    try {
+        services = ServiceBootstrap::initialize(dbFilePath, "./database/database.sql", ConnectionProfile::server());
+    } catch (const std::exception& e) {
+        std::cerr << "[Server] Failed to initialize services: " << e.what() << std::endl;
+        return 1;
+    }
+
+    BookingServer server(port);
+    if (!server.start()) {
+        return 1;
+    }
+
+    activeServer = &server;
+    std::signal(SIGINT, handleSignal);
+    std::signal(SIGTERM, handleSignal);
+    server.run();
+    activeServer = nullptr;
+    return 0;
+}
@@ -3,10 +3,20 @@
 BookingService::BookingService(std::shared_ptr<IBookingRepository> repo) : _repo(repo) {
 }
 
-void BookingService::createBooking(const int& userID, const int& showTimeID, const std::vector<std::string>& seats) {
-    _repo->addBooking(userID, showTimeID);
-    int bookingID = _repo->getLatestBookingID(userID);
-    _repo->addBookedSeats(bookingID, seats);
+int BookingService::createBooking(const int& userID, const int& showTimeID, const std::vector<std::string>& seats) {
+    return _repo->createBooking(userID, showTimeID, seats);
+}
+
+bool BookingService::holdSeat(const int& userID, const int& showTimeID, const std::string& seatID) {
+    return _repo->holdSeat(userID, showTimeID, seatID);
+}
+
+bool BookingService::releaseSeat(const int& userID, const int& showTimeID, const std::string& seatID) {
+    return _repo->releaseSeat(userID, showTimeID, seatID);
+}
+
+void BookingService::releaseHolds(const int& userID) {
+    _repo->releaseHolds(userID);
 }
 
 std::vector<SeatView> BookingService::viewSeatsStatus(const int& showTimeID) {
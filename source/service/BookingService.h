@@ -101,6 +101,7 @@ public:
      * @param userID Unique identifier of the user making the booking
      * @param showTimeID Unique identifier of the movie showtime
      * @param seats Vector of seat identifiers to reserve (e.g., "A1", "B5")
+     * @return int ID of the new booking
      * 
      * @pre userID > 0 (valid user identifier)
      * @pre showTimeID > 0 (valid showtime identifier)
@@ -111,18 +112,41 @@ public:
      * @post All specified seats marked as occupied
      * @post User's booking history updated
      * 
-     * @throws std::invalid_argument if any seat is already booked
+     * @throws std::invalid_argument if the seat list is empty or invalid
+     * @throws SeatUnavailableException if any seat is already booked
      * @throws std::runtime_error if database operation fails
      * 
      * @par Transaction Behavior
      * This operation is atomic - either all seats are booked successfully
      * or none are booked if any error occurs.
      * 
-     * @warning Concurrent booking attempts for same seats may conflict
+     * @note Concurrent attempts for the same seats are serialized; the
+     *       later one fails with SeatUnavailableException
      * 
      * @see viewSeatsStatus() to check availability before booking
      */
-    void createBooking(const int& userID, const int& showTimeID, const std::vector<std::string>& seats) override;
+    int createBooking(const int& userID, const int& showTimeID, const std::vector<std::string>& seats) override;
+
+    /**
+     * @brief Hold a seat while the user is selecting seats
+     * 
+     * @see IBookingRepository::holdSeat()
+     */
+    bool holdSeat(const int& userID, const int& showTimeID, const std::string& seatID) override;
+
+    /**
+     * @brief Release a seat the user deselected
+     * 
+     * @see IBookingRepository::releaseSeat()
+     */
+    bool releaseSeat(const int& userID, const int& showTimeID, const std::string& seatID) override;
+
+    /**
+     * @brief Release every seat held by the user
+     * 
+     * @see IBookingRepository::releaseHolds()
+     */
+    void releaseHolds(const int& userID) override;
 
     /**
      * @brief Retrieve user's booking history
@@ -48,6 +48,7 @@ public:
      * @param userID The ID of the user making the booking
      * @param showTimeID The ID of the movie showtime
      * @param seats Vector of seat identifiers to be booked
+     * @return int The ID of the newly created booking
      * 
      * @pre userID must be a valid registered user
      * @pre showTimeID must be a valid future showtime
@@ -55,17 +56,50 @@ public:
      * @post Seats are reserved and marked as unavailable
      * @post Booking record is created in the system
      * 
-     * @throws std::invalid_argument if userID or showTimeID is invalid
-     * @throws std::runtime_error if seats are already booked
+     * @throws std::invalid_argument if the seat list is empty or invalid
+     * @throws SeatUnavailableException if seats are already booked or held by another user
      * @throws std::runtime_error if booking creation fails
      * 
-     * @note This operation should be atomic to prevent double-booking
+     * @note This operation is atomic, so seats cannot be double-booked
      * @warning This method may block during database transactions
      * 
      * @see viewSeatsStatus()
      * @since v1.0
      */
-    virtual void createBooking(const int& userID, const int& showTimeID, const std::vector<std::string>& seats) = 0;
+    virtual int createBooking(const int& userID, const int& showTimeID, const std::vector<std::string>& seats) = 0;
+
+    /**
+     * @brief Holds a seat for a user during seat selection
+     * 
+     * The seat shows as SeatStatus::HELD to other customers and cannot be
+     * booked by them until the hold is released or expires. Holding the
+     * same seat again renews the hold.
+     * 
+     * @param userID The ID of the user selecting the seat
+     * @param showTimeID The ID of the movie showtime
+     * @param seatID The seat identifier
+     * @return bool true if the seat is now held by the user, false if it
+     *         is booked or held by someone else
+     * 
+     * @see releaseSeat()
+     * @since v1.1
+     */
+    virtual bool holdSeat(const int& userID, const int& showTimeID, const std::string& seatID) = 0;
+
+    /**
+     * @brief Releases a seat the user held (seat deselected)
+     * 
+     * @return bool true if the user held the seat
+     * @since v1.1
+     */
+    virtual bool releaseSeat(const int& userID, const int& showTimeID, const std::string& seatID) = 0;
+
+    /**
+     * @brief Releases every seat held by the user (leaving seat selection, logout)
+     * 
+     * @since v1.1
+     */
+    virtual void releaseHolds(const int& userID) = 0;
     
     /**
      * @brief Retrieves booking history for a specific user
@@ -106,7 +140,8 @@ public:
      * 
      * @throws std::invalid_argument if showTimeID is invalid
      * 
-     * @note Seat status reflects real-time availability
+     * @note Seat status reflects real-time availability; seats held by
+     *       customers who are still selecting are reported as HELD
      * @warning Status may change between calls due to concurrent bookings
      * 
      * @see SeatView
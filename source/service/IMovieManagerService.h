@@ -91,7 +91,7 @@ public:
      * 
      * @throw std::invalid_argument if movie is null or showtimes are invalid
      * @throw DuplicateMovieException if movie already exists
-     * @throw ScheduleConflictException if showtimes conflict with existing ones
+     * @throw ShowTimeOverlapException if a showtime overlaps another one in its auditorium
      * @throw std::runtime_error if database operation fails
      * 
      * @note Operation should be atomic - either all data is saved or none
@@ -8,11 +8,14 @@
 #ifndef IMOVIEVIEWERSERVICE_H
 #define IMOVIEVIEWERSERVICE_H
 
+#include <cstddef>
 #include <vector>
 #include "../repository/MovieDTO.h"
+#include "../repository/ScheduledShowTime.h"
 #include "../model/Movie.h"
 #include "../model/ShowTime.h"
 #include <memory>
+#include <string>
 
 /**
  * @interface IMovieViewerService
@@ -107,6 +110,46 @@ public:
      * @endcode
      */
     virtual std::vector<MovieDTO> showAllMovies() = 0;
+
+    /**
+     * @brief Retrieves one page of the catalog, ordered by movie ID
+     * 
+     * Keyset-paginated alternative to showAllMovies() for large catalogs:
+     * pass 0 for the first page and the ID of the last movie received for
+     * each following page.
+     * 
+     * @param afterMovieId ID of the last movie of the previous page, 0 for the first page
+     * @param limit Maximum number of movies in the page
+     * @return Up to @p limit movies; fewer (or none) at the end of the catalog
+     * 
+     * Usage:
+     * @code
+     * auto firstPage = movieViewer->showMoviesPage(0, 20);
+     * auto secondPage = movieViewer->showMoviesPage(firstPage.back().id, 20);
+     * @endcode
+     * 
+     * @see IMovieRepository::getMoviesPage
+     */
+    virtual std::vector<MovieDTO> showMoviesPage(int afterMovieId, std::size_t limit) = 0;
+
+    /**
+     * @brief Searches the catalog by title, genre and description
+     * 
+     * Words are matched as prefixes, ignoring case and accents, so the
+     * query can be run on every keystroke of a search box.
+     * 
+     * @param query Words typed by the user
+     * @param limit Maximum number of movies returned
+     * @return Matching movies, best match first; empty if nothing matches
+     * 
+     * Usage:
+     * @code
+     * auto results = movieViewer->searchMovies("aven", 50);   // finds "Avengers"
+     * @endcode
+     * 
+     * @see IMovieRepository::searchMovies
+     */
+    virtual std::vector<MovieDTO> searchMovies(const std::string& query, std::size_t limit) = 0;
     
     /**
      * @brief Retrieves detailed information for a specific movie
@@ -184,6 +227,28 @@ public:
      * @endcode
      */
     virtual std::vector<ShowTime> showMovieShowTimes(int id) = 0;
+
+    /**
+     * @brief Retrieves everything playing during a time window on one day
+     * 
+     * @param date Day in YYYY-MM-DD format
+     * @param fromTime Start of the window (HH:MM or HH:MM:SS)
+     * @param toTime End of the window (HH:MM or HH:MM:SS), after @p fromTime
+     * @return Showtimes running at some point in the window, with their movie
+     *         and auditorium, ordered by start time
+     * 
+     * @throws std::invalid_argument If the date or a time is invalid, or the window is empty
+     * 
+     * Usage:
+     * @code
+     * // What is playing between 18:00 and 21:00?
+     * auto tonight = movieViewer->showShowTimesBetween("2025-05-10", "18:00", "21:00");
+     * @endcode
+     * 
+     * @see IMovieRepository::getShowTimesBetween
+     */
+    virtual std::vector<ScheduledShowTime> showShowTimesBetween(const std::string& date, const std::string& fromTime,
+                                                                const std::string& toTime) = 0;
 };
 
 #endif // IMOVIEVIEWERSERVICE_H
\ No newline at end of file
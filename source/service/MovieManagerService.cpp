@@ -1,23 +1,59 @@
 #include "MovieManagerService.h"
+#include "../model/ShowTime.h"
+#include "../repository/ShowTimeSpec.h"
+#include <charconv>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+
+namespace {
+
+// Next comma-separated field of `rest`, which is advanced past the comma
+std::string_view nextField(std::string_view& rest) {
+    std::size_t comma = rest.find(',');
+    std::string_view field = rest.substr(0, comma);
+    rest = comma == std::string_view::npos ? std::string_view() : rest.substr(comma + 1);
+    return field;
+}
+
+// "YYYY-MM-DD,HH:MM,HH:MM[,auditorium]"
+ShowTimeSpec parseShowTime(std::string_view text, int defaultAuditoriumId) {
+    std::string_view rest = text;
+    std::string_view date = nextField(rest);
+    std::string_view startTime = nextField(rest);
+    std::string_view endTime = nextField(rest);
+    std::string_view auditorium = rest;
+
+    std::optional<std::int64_t> startsAt = ShowTime::toEpoch(date, startTime);
+    std::optional<std::int64_t> endsAt = ShowTime::toEndEpoch(date, startTime, endTime);
+    if (!startsAt || !endsAt) {
+        throw std::invalid_argument("Invalid date or time format: " + std::string(text));
+    }
+
+    int auditoriumId = defaultAuditoriumId;
+    if (!auditorium.empty()) {
+        auto [end, error] = std::from_chars(auditorium.data(), auditorium.data() + auditorium.size(), auditoriumId);
+        if (error != std::errc() || end != auditorium.data() + auditorium.size() || auditoriumId <= 0) {
+            throw std::invalid_argument("Invalid auditorium: " + std::string(text));
+        }
+    }
+    return ShowTimeSpec(*startsAt, *endsAt, auditoriumId);
+}
+
+} // namespace
 
 MovieManagerService::MovieManagerService(std::shared_ptr<IMovieRepository> r) : repo(r) {}
 
 void MovieManagerService::addMovie(std::shared_ptr<IMovie> movie, std::vector<std::string> ShowTimes) {
-    int newMovieId = repo->addMovie(movie); // Get the new movie ID
-    // movie->setId(newMovieId); // Optionally set the ID back on the movie object if needed by it
-
+    // Parse everything before touching the database, then write the movie and
+    // its showtimes in one transaction
+    std::vector<ShowTimeSpec> schedule;
+    schedule.reserve(ShowTimes.size());
     for (const auto& showTime : ShowTimes) {
-        std::istringstream ss(showTime);
-        std::string date, startTime, endTime;
-        std::getline(ss, date, ',');
-        std::getline(ss, startTime, ',');
-        std::getline(ss, endTime);
-        
-        // std::cout << "[MovieManagerService[DEBUG]] Adding showtime for movie ID " << newMovieId 
-        //      << ": Date: " << date << ", Start: " << startTime << ", End: " << endTime << std::endl;
-
-        repo->addShowTime(newMovieId, date, startTime, endTime);
+        schedule.push_back(parseShowTime(showTime, DEFAULT_AUDITORIUM_ID));
     }
+
+    repo->addMovie(movie, schedule);
 }
 
 void MovieManagerService::deleteMovie(int id) {
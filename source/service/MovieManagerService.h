@@ -46,7 +46,7 @@
  * 
  * Usage Example:
  * @code
- * auto movieRepo = std::make_shared<MovieRepositorySQL>(dbConnection);
+ * auto movieRepo = std::make_shared<MovieRepositorySQL>(connectionPool);
  * auto movieManager = std::make_unique<MovieManagerService>(movieRepo);
  * 
  * // Add a new movie with showtimes
@@ -72,6 +72,11 @@ private:
     std::shared_ptr<IMovieRepository> repo;
 
 public:
+    /**
+     * @brief Auditorium of showtimes that do not name one
+     */
+    static constexpr int DEFAULT_AUDITORIUM_ID = 1;
+
     /**
      * @brief Constructs MovieManagerService with repository dependency
      * 
@@ -109,7 +114,8 @@ public:
      * for conflicts, and ensures transactional consistency.
      * 
      * @param movie Shared pointer to the movie object to add
-     * @param ShowTimes Vector of showtime strings in HH:MM format
+     * @param ShowTimes Vector of "YYYY-MM-DD,HH:MM,HH:MM[,auditorium]" strings
+     *        (date, start, end, and the auditorium, DEFAULT_AUDITORIUM_ID if omitted)
      * 
      * @pre movie must not be null and contain valid data
      * @pre ShowTimes must not be empty and contain valid time formats
@@ -122,10 +128,13 @@ public:
      * @throw std::invalid_argument if movie is null or data is invalid
      * @throw DuplicateMovieException if movie title already exists
      * @throw InvalidShowTimeException if showtime format is invalid
-     * @throw ScheduleConflictException if showtimes conflict
+     * @throw ShowTimeOverlapException if a showtime overlaps another one in its auditorium
      * @throw std::runtime_error if database operation fails
      * 
-     * @note Operation is transactional - either all data is saved or none
+     * @note Operation is transactional - either all data is saved or none:
+     *       every showtime is parsed first, then the movie and all showtimes
+     *       are written in one transaction (IMovieRepository::addMovie with
+     *       a schedule)
      * @note Showtime validation includes format and future date checks
      * @note Movie title uniqueness is enforced at the service level
      * 
@@ -1,6 +1,8 @@
 #include "MovieViewerService.h"
 #include <iostream>
 #include "../model/ShowTime.h"
+#include <optional>
+#include <stdexcept>
 
 MovieViewerService::MovieViewerService(std::shared_ptr<IMovieRepository> r) : repo(std::move(r)) {}
 
@@ -12,6 +14,14 @@ std::vector<MovieDTO> MovieViewerService::showAllMovies() {
     return movies;
 }
 
+std::vector<MovieDTO> MovieViewerService::showMoviesPage(int afterMovieId, std::size_t limit) {
+    return repo->getMoviesPage(afterMovieId, limit);
+}
+
+std::vector<MovieDTO> MovieViewerService::searchMovies(const std::string& query, std::size_t limit) {
+    return repo->searchMovies(query, limit);
+}
+
 std::shared_ptr<IMovie> MovieViewerService::showMovieDetail(int id) {
     std::shared_ptr<IMovie> m = repo->getMovieById(id);
     if (m) {
@@ -30,4 +40,14 @@ std::shared_ptr<IMovie> MovieViewerService::showMovieDetail(int id) {
 
 std::vector<ShowTime> MovieViewerService::showMovieShowTimes(int id) {
     return repo->getShowTimesByMovieId(id);
+}
+
+std::vector<ScheduledShowTime> MovieViewerService::showShowTimesBetween(const std::string& date, const std::string& fromTime,
+                                                                        const std::string& toTime) {
+    std::optional<std::int64_t> from = ShowTime::toEpoch(date, fromTime);
+    std::optional<std::int64_t> to = ShowTime::toEpoch(date, toTime);
+    if (!from || !to) {
+        throw std::invalid_argument("Invalid date or time format");
+    }
+    return repo->getShowTimesBetween(*from, *to);
 }
\ No newline at end of file
@@ -44,7 +44,7 @@
  * 
  * Usage Example:
  * @code
- * auto movieRepo = std::make_shared<MovieRepositorySQL>(dbConnection);
+ * auto movieRepo = std::make_shared<MovieRepositorySQL>(connectionPool);
  * auto movieViewer = std::make_unique<MovieViewerService>(movieRepo);
  * 
  * // Browse available movies
@@ -146,6 +146,24 @@ public:
      * @endcode
      */
     std::vector<MovieDTO> showAllMovies() override;
+
+    /**
+     * @brief Retrieves one page of the catalog after a given movie ID
+     * 
+     * @param afterMovieId ID of the last movie of the previous page, 0 for the first page
+     * @param limit Maximum number of movies in the page
+     * @return Movies ordered by ID, straight from IMovieRepository::getMoviesPage
+     */
+    std::vector<MovieDTO> showMoviesPage(int afterMovieId, std::size_t limit) override;
+
+    /**
+     * @brief Searches the catalog by title, genre and description
+     * 
+     * @param query Words typed by the user
+     * @param limit Maximum number of movies returned
+     * @return Best matches first, straight from IMovieRepository::searchMovies
+     */
+    std::vector<MovieDTO> searchMovies(const std::string& query, std::size_t limit) override;
     
     /**
      * @brief Retrieves detailed information for a specific movie
@@ -250,6 +268,17 @@ public:
      * @endcode
      */
     std::vector<ShowTime> showMovieShowTimes(int id) override;  // Changed to return ShowTime vector
+
+    /**
+     * @brief Retrieves the showtimes running during a time window on one day
+     * 
+     * Parses the date and times into epoch seconds, then asks
+     * IMovieRepository::getShowTimesBetween.
+     * 
+     * @throws std::invalid_argument If the date or a time is invalid
+     */
+    std::vector<ScheduledShowTime> showShowTimesBetween(const std::string& date, const std::string& fromTime,
+                                                        const std::string& toTime) override;
 };
 
 #endif // MOVIEVIEWERSERVICE_H
\ No newline at end of file
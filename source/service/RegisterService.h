@@ -41,7 +41,7 @@
  * 
  * Usage Example:
  * @code
- * auto authRepo = std::make_unique<AuthenticationRepositorySQL>(dbConnection);
+ * auto authRepo = std::make_unique<AuthenticationRepositorySQL>(connectionPool);
  * auto registerService = std::make_unique<RegisterService>(authRepo.get());
  * 
  * AccountInformation newUser("username", "password", "email@example.com");
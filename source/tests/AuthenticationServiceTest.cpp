@@ -96,7 +96,7 @@
 *
 * 12. DEPENDENCIES:
 *     - AuthenticationRepositorySQL class
-*     - DatabaseConnection singleton
+*     - ConnectionPool shared by the repositories
 *     - LoginService and RegisterService
 *     - AccountInformation model
 *     - SQLite database engine
@@ -113,11 +113,13 @@
 #include <filesystem>
 #include "../repository/AuthenticationRepositorySQL.h"
 #include "../database/DatabaseConnection.h"
+#include "../database/ConnectionPool.h"
 #include "../service/LoginService.h"
 #include "../service/RegisterService.h"
 #include "../model/AccountInformation.h"
 
 DatabaseConnection* db = nullptr;
+std::shared_ptr<ConnectionPool> pool;
 AuthenticationRepositorySQL* repo = nullptr;
 
 // TEST(DatabaseConnectionTest, ConnectsToExistingDatabase) {
@@ -130,8 +132,8 @@ AuthenticationRepositorySQL* repo = nullptr;
 class AuthServiceTest : public ::testing::Test {
 protected:
     void SetUp() override {
-        ASSERT_NE(db, nullptr);  // Chắc chắn đã được khởi tạo từ test trước
-        repo = new AuthenticationRepositorySQL(db);
+        ASSERT_NE(pool, nullptr);  // Chắc chắn đã được khởi tạo từ test trước
+        repo = new AuthenticationRepositorySQL(pool);
     }
 
     void TearDown() override {
@@ -164,7 +166,8 @@ TEST_F(AuthServiceTest, LoginFailsWithWrongPassword) {
 
 int main(int argc, char** argv) {
 
-    db = DatabaseConnection::getInstance();
+    DatabaseConnection connection;
+    db = &connection;
 
      const std::string dbPath = "database.db";
     
@@ -180,10 +183,12 @@ int main(int argc, char** argv) {
     }   
 
     db->executeSQLFile("database.sql");
+    pool = std::make_shared<ConnectionPool>(dbPath);
 
     ::testing::InitGoogleTest(&argc, argv);
     int result = RUN_ALL_TESTS();
     
+    pool.reset();
     db->disconnect();
     return result;
 }
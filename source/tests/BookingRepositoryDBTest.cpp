@@ -31,8 +31,31 @@
 *         - Expected output: The latest booking ID is 3.
 *         - Condition: Previous booking operations have been performed.
 *
+*    2.5. CanStreamBookings:
+*         - Description: Test streaming the booking history of a user through forEachBooking.
+*         - Input: UserID = 1.
+*         - Expected output: Bookings 1 and 3 are visited in order, each with its own seats and total price.
+*         - Condition: Booking 3 with seats A3 and B3 has been created in test case 2.3.
+*
+*    2.6. CanCreateBookingAtomically:
+*         - Description: Test creating a booking and its seats in one transaction.
+*         - Input: UserID = 2, ShowTimeID = 2, seats A1 and B2.
+*         - Expected output: The returned booking ID is 4 and A1, B2 have status BOOKED.
+*
+*    2.7. CreateBookingRejectsTakenSeats:
+*         - Description: Test that a booking containing an already booked seat is rejected as a whole.
+*         - Input: UserID = 2, ShowTimeID = 1, seats A3 (free) and A1 (booked).
+*         - Expected output: SeatUnavailableException listing A1, A3 stays AVAILABLE and no booking is created.
+*
+*    2.8. HeldSeatsBlockOtherUsers:
+*         - Description: User 1 holds A3 of showtime 1, then user 2 and user 1 try to book it.
+*         - Input: UserID = 1 and 2, ShowTimeID = 1, seat A3 (free) and A1 (booked).
+*         - Expected output: A3 reads as HELD, user 2 gets SeatUnavailableException listing A3, user 1 books it
+*           as booking 5; booked seats cannot be held and releaseHolds() frees the remaining holds.
+*
 * 3. TEST ENVIRONMENT SETUP:
-*    - Each test run, the database will be recreated from the SQL file.
+*    - Each test run, the database will be recreated from the SQL file and migrated
+*      to the latest schema version (showtimes as epoch seconds), as ServiceBootstrap does.
 *    - Use fixture to initialize the repository before each test.
 *    - The database will be closed after all tests are completed.
 *
@@ -47,6 +70,7 @@
 #include "../repository/BookingView.h"
 #include "../repository/SeatView.h"
 #include "../database/DatabaseConnection.h"
+#include "../database/SchemaMigrator.h"
 #include <cstdio>
 #include <string>
 #include <iostream>
@@ -74,9 +98,9 @@ TEST_F(BookingRepositoryDBTest, CanViewBookings) {
     ASSERT_FALSE(bookings.empty());      // Step 3: Check the number of bookings and details of the first booking
     EXPECT_EQ(bookings.size(), 1);
     EXPECT_EQ(bookings[0].bookingID, 1) << "BookingID should be 1";
-    EXPECT_EQ(bookings[0].showTime.date, "2025-05-10") << "Show date should be 2025-05-10";
-    EXPECT_EQ(bookings[0].showTime.startTime, "18:00") << "Start time should be 18:00";
-    EXPECT_EQ(bookings[0].showTime.endTime, "20:30") << "End time should be 20:30";
+    EXPECT_EQ(bookings[0].showTime.date(), "2025-05-10") << "Show date should be 2025-05-10";
+    EXPECT_EQ(bookings[0].showTime.startTime(), "18:00") << "Start time should be 18:00";
+    EXPECT_EQ(bookings[0].showTime.endTime(), "20:30") << "End time should be 20:30";
     EXPECT_EQ(bookings[0].movieID, 1) << "MovieID should be 1";
     EXPECT_EQ(bookings[0].movieTitle, "Avengers") << "Movie title should be Avengers";
       // Step 4: Check booked seat information
@@ -168,11 +192,118 @@ TEST_F(BookingRepositoryDBTest, CanGetLatestBookingID) {
     // Step 2: Check that the latest ID is correct (based on previous test cases)
     EXPECT_EQ(latestBookingId, 3) << "The latest booking ID should be 3";
 }
-   
+
+// Test Case 2.5: Test streaming the booking history
+TEST_F(BookingRepositoryDBTest, CanStreamBookings) {
+    // Step 1: Collect the bookings handed to the visitor
+    std::vector<BookingView> visited;
+    repo->forEachBooking(1, [&visited](BookingView&& booking) {
+        visited.push_back(std::move(booking));
+    });
+
+    // Step 2: Check that both bookings of user 1 were visited in order
+    ASSERT_EQ(visited.size(), 2);
+    EXPECT_EQ(visited[0].bookingID, 1);
+    EXPECT_EQ(visited[1].bookingID, 3);
+
+    // Step 3: Check that seats were grouped into the right booking
+    ASSERT_EQ(visited[0].getSeatCount(), 2);
+    ASSERT_EQ(visited[1].getSeatCount(), 2);
+    EXPECT_EQ(visited[1].bookedSeats[0]->id(), "A3");
+    EXPECT_EQ(visited[1].bookedSeats[1]->id(), "B3");
+    EXPECT_FLOAT_EQ(visited[1].totalPrice, 140.0f) << "A3 (Single) + B3 (Couple) should cost 140";
+}
+
+// Test Case 2.6: Test the atomic booking path
+TEST_F(BookingRepositoryDBTest, CanCreateBookingAtomically) {
+    // Step 1: Book A1 and B2 for user 2 on showtime 2
+    int bookingId = repo->createBooking(2, 2, {"A1", "B2"});
+
+    // Step 2: The ID comes back from the insert itself
+    EXPECT_EQ(bookingId, 4) << "Bookings 1-3 already exist, so the new ID should be 4";
+    EXPECT_EQ(repo->getLatestBookingID(2), bookingId);
+
+    // Step 3: Both seats are booked for showtime 2
+    int booked = 0;
+    for (const auto& seat : repo->viewSeatsStatus(2)) {
+        if (seat.seat->id() == "A1" || seat.seat->id() == "B2") {
+            EXPECT_EQ(seat.status, BOOKED) << "Seat " << seat.seat->id() << " should be BOOKED";
+            ++booked;
+        }
+    }
+    EXPECT_EQ(booked, 2);
+}
+
+// Test Case 2.7: Test that a conflicting booking leaves nothing behind
+TEST_F(BookingRepositoryDBTest, CreateBookingRejectsTakenSeats) {
+    // Step 1: A1 is already booked for showtime 1 in the sample data
+    try {
+        repo->createBooking(2, 1, {"A3", "A1"});
+        FAIL() << "Booking an already booked seat should throw";
+    } catch (const SeatUnavailableException& e) {
+        EXPECT_EQ(e.showTimeID(), 1);
+        EXPECT_EQ(e.seats(), (std::vector<std::string>{"A1"}));
+    }
+
+    // Step 2: The free seat was not booked either
+    for (const auto& seat : repo->viewSeatsStatus(1)) {
+        if (seat.seat->id() == "A3") {
+            EXPECT_EQ(seat.status, AVAILABLE) << "A3 must stay AVAILABLE when the booking is rejected";
+        }
+    }
+
+    // Step 3: No booking row was left behind
+    EXPECT_EQ(repo->getLatestBookingID(2), 4);
+
+    // Step 4: Invalid seat lists are rejected before touching the database
+    EXPECT_THROW(repo->createBooking(2, 1, {}), std::invalid_argument);
+    EXPECT_THROW(repo->createBooking(2, 1, {"B2", "B2"}), std::invalid_argument);
+    EXPECT_THROW(repo->createBooking(2, 1, {"Z99"}), std::invalid_argument);
+    EXPECT_EQ(repo->getLatestBookingID(2), 4);
+}
+
+// Test Case 2.8: Test that seats held during selection are kept for their holder
+TEST_F(BookingRepositoryDBTest, HeldSeatsBlockOtherUsers) {
+    auto statusOf = [this](const std::string& seatId) {
+        for (const auto& seat : repo->viewSeatsStatus(1)) {
+            if (seat.seat->id() == seatId) {
+                return seat.status;
+            }
+        }
+        return AVAILABLE;
+    };
+
+    // Step 1: User 1 selects A3, user 2 cannot select it any more
+    ASSERT_TRUE(repo->holdSeat(1, 1, "A3"));
+    EXPECT_FALSE(repo->holdSeat(2, 1, "A3"));
+    EXPECT_FALSE(repo->holdSeat(2, 1, "A1")) << "Booked seats cannot be held";
+    EXPECT_EQ(statusOf("A3"), HELD);
+
+    // Step 2: User 2's booking fails before any write
+    try {
+        repo->createBooking(2, 1, {"A3"});
+        FAIL() << "Booking a seat held by another user should throw";
+    } catch (const SeatUnavailableException& e) {
+        EXPECT_EQ(e.seats(), (std::vector<std::string>{"A3"}));
+    }
+    EXPECT_EQ(repo->getLatestBookingID(2), 4);
+
+    // Step 3: The holder books it, and the hold gives way to the booking
+    EXPECT_EQ(repo->createBooking(1, 1, {"A3"}), 5);
+    EXPECT_EQ(statusOf("A3"), BOOKED);
+
+    // Step 4: Holds can be released one by one or all at once
+    ASSERT_TRUE(repo->holdSeat(2, 1, "B2"));
+    ASSERT_TRUE(repo->holdSeat(2, 1, "B3"));
+    EXPECT_TRUE(repo->releaseSeat(2, 1, "B2"));
+    EXPECT_EQ(statusOf("B2"), AVAILABLE);
+    repo->releaseHolds(2);
+    EXPECT_EQ(statusOf("B3"), AVAILABLE);
+}
 
 int main(int argc, char** argv) {
 
-    auto db = DatabaseConnection::getInstance();
+    DatabaseConnection db;
 
      const std::string dbPath = "database.db";
     
@@ -182,17 +313,18 @@ int main(int argc, char** argv) {
         std::filesystem::remove(dbPath);
     }
 
-    if (!db->connect(dbPath)) {
+    if (!db.connect(dbPath)) {
         std::cerr << "Failed to connect to database" << std::endl;
         return 1;
     }   
 
-    db->executeSQLFile("database.sql");
+    db.executeSQLFile("database.sql");
+    SchemaMigrator(&db).migrate();
 
     ::testing::InitGoogleTest(&argc, argv);
     int result = RUN_ALL_TESTS();
     
-    db->disconnect();
+    db.disconnect();
     return result;
 }
 
@@ -33,7 +33,8 @@
 *         - Condition: User has at least one booking in the system.
 *
 * 3. TEST ENVIRONMENT SETUP:
-*    - Each test run, the database will be recreated from the SQL file.
+*    - Each test run, the database will be recreated from the SQL file and migrated
+*      to the latest schema version (showtimes as epoch seconds), as ServiceBootstrap does.
 *    - BookingService is initialized with an instance of BookingRepository for each test case.
 *    - The database will be closed after completing all tests.
 *
@@ -52,6 +53,8 @@
 #include "../service/IBookingService.h"
 #include "../service/BookingService.h"
 #include "../repository/SeatView.h"
+#include "../database/DatabaseConnection.h"
+#include "../database/SchemaMigrator.h"
 #include <iostream>
 #include <string>
 #include <filesystem>
@@ -138,8 +141,8 @@ TEST(BookingServiceTest, CanViewBookingHistory) {
     std::cout << "Booking history for userID " << userID << ": " << std::endl;
     for (const auto& booking : bookings) {
         std::cout << "Booking ID: " << booking.bookingID << ", Movie Title: " << booking.movieTitle
-                  << ", Date: " << booking.showTime.date << ", Start Time: " << booking.showTime.startTime
-                  << ", End Time: " << booking.showTime.endTime << ", Seats: ";
+                  << ", Date: " << booking.showTime.date() << ", Start Time: " << booking.showTime.startTime()
+                  << ", End Time: " << booking.showTime.endTime() << ", Seats: ";
         for (const auto& seat : booking.bookedSeats) {
             std::cout << seat->id() << " ";
         }
@@ -150,7 +153,7 @@ TEST(BookingServiceTest, CanViewBookingHistory) {
 }
 
 int main(int argc, char **argv) {
-    auto db = DatabaseConnection::getInstance();
+    DatabaseConnection db;
 
      const std::string dbPath = "database.db";
     
@@ -161,16 +164,17 @@ int main(int argc, char **argv) {
     }
 
 
-    if (!db->connect(dbPath)) {
+    if (!db.connect(dbPath)) {
         std::cerr << "Failed to connect to database" << std::endl;
         return 1;
     }   
 
-    db->executeSQLFile("database.sql");
+    db.executeSQLFile("database.sql");
+    SchemaMigrator(&db).migrate();
 
     ::testing::InitGoogleTest(&argc, argv);
     int result = RUN_ALL_TESTS();
 
-    db->disconnect();
+    db.disconnect();
     return result;
 }
\ No newline at end of file
@@ -0,0 +1,426 @@
+/*
+* TEST PLAN FOR CATALOG IMPORT AND EXPORT
+* ---------------------------------------
+*
+* 1. PURPOSE:
+*    - Verify the CSV and JSON readers used by CatalogTool on well-formed and malformed feeds
+*    - Ensure that CatalogImporter validates a whole feed before writing and loads it through IMovieRepository
+*    - Validate that exported catalogs can be read back by the importer's readers
+*
+* 2. TEST CASES:
+*    2.1. CsvReaderSplitsQuotedFields:
+*         - Description: CsvReader splits RFC 4180 records in place
+*         - Input: A byte order mark, CRLF and LF line ends, blank lines, quoted commas, "" and line breaks;
+*           then an unterminated quote and text after a closing quote
+*         - Expected output: Exact fields and record lines; fields without "" point into the input;
+*           malformed records throw CatalogFormatError with the line they start on
+*
+*    2.2. JsonTokenizerDecodesEscapes:
+*         - Description: JsonCatalogReader reads movie objects and hands out one row per showtime
+*         - Input: Escapes (\n, \", é, a surrogate pair), unknown keys with nested values, a movie
+*           without showtimes; then a raw line break in a string, a bad escape and trailing text
+*         - Expected output: Decoded UTF-8 text; unknown keys are ignored; errors name the right line
+*
+*    2.3. ImporterRejectsBadFeedBeforeWriting:
+*         - Description: CatalogImporter::read validates every row before commit writes anything
+*         - Input: Feeds with an impossible date, an end equal to the start, a rating of 11, auditorium 0,
+*           a missing title and a header without "title"
+*         - Expected output: CatalogFormatError on the offending line; the catalog is unchanged
+*
+*    2.4. ImportAddsMoviesAndShowTimes:
+*         - Description: commit() adds new titles with their schedule and adds showtimes to known titles
+*         - Input: A CSV feed with a new movie (3 showtimes, one in auditorium 2) and a showtime for
+*           Avengers; a JSON feed whose second movie overlaps the first one's showtime
+*         - Expected output: Correct statistics and stored rows; the overlap aborts with the title in the
+*           message after the movie before it was stored; the overlapping movie leaves nothing behind
+*
+*    2.5. ExportReadsBackAsTheSameCatalog:
+*         - Description: exportCatalogCsv and exportCatalogJson write what the readers read
+*         - Input: The whole catalog, including a description with a comma, quotes and a line break
+*         - Expected output: Both exports parse without errors into the same rows, which match the
+*           repository's movies and showtimes
+*
+*    2.6. LateShowSurvivesExportAndImport:
+*         - Description: Export the catalog with a show running past midnight, import it into an empty schedule
+*         - Input: A 22:00-00:30 showtime stored through the repository, exported as CSV and as JSON
+*         - Expected output: The late show is written as 22:00 to 00:30 on its start date; importing either
+*           export recreates every showtime with the same start, end and auditorium
+*
+* 3. TEST ENVIRONMENT SETUP:
+*    - Each test run, the database will be used with sample data from database.sql,
+*      migrated to the latest schema version as ServiceBootstrap does
+*    - Feeds are in-memory strings; the readers do not care whether the text is a MappedFile
+*
+* 4. ASSUMPTIONS:
+*    - The database.sql file contains Avengers (2025-05-10 18:00-20:30) and Titanic
+*    - The test cases run in the order they are written
+*/
+
+#include <gtest/gtest.h>
+#include "../tools/CatalogIO.h"
+#include "../repository/MovieRepositorySQL.h"
+#include "../model/Movie.h"
+#include "../model/ShowTime.h"
+#include "../database/DatabaseConnection.h"
+#include "../database/SchemaMigrator.h"
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+int findMovieId(IMovieRepository& repo, const std::string& title) {
+    for (const MovieDTO& movie : repo.getAllMovies()) {
+        if (movie.title == title) {
+            return movie.id;
+        }
+    }
+    return 0;
+}
+
+std::size_t lineOfError(CatalogReader& reader, IMovieRepository& repo) {
+    CatalogImporter importer(repo);
+    try {
+        importer.read(reader);
+    } catch (const CatalogFormatError& e) {
+        return e.line();
+    }
+    return 0;
+}
+
+using RowTuple = std::tuple<std::string, std::string, std::string, std::string, std::string, std::string, std::string>;
+
+std::vector<RowTuple> readAll(CatalogReader& reader) {
+    std::vector<RowTuple> rows;
+    CatalogRow row;
+    while (reader.next(row)) {
+        rows.emplace_back(std::string(row.title), std::string(row.description), std::string(row.rating),
+                          std::string(row.date), std::string(row.startTime), std::string(row.endTime),
+                          std::string(row.auditorium));
+    }
+    return rows;
+}
+
+}
+
+class CatalogIOTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MovieRepositorySQL> repo;
+
+    void SetUp() override {
+        repo = std::make_shared<MovieRepositorySQL>("database.db");
+    }
+};
+
+// Test Case 2.1: CSV records are split in place, quotes included
+TEST_F(CatalogIOTest, CsvReaderSplitsQuotedFields) {
+    const std::string text =
+        "\xEF\xBB\xBF" "a,b,c\r\n"
+        "\r\n"
+        "plain,\"with, comma\",\"say \"\"hi\"\"\"\n"
+        "\"two\nlines\",,last\n"
+        "\n"
+        "end,only";
+    CsvReader reader(text);
+    std::vector<std::string_view> fields;
+
+    ASSERT_TRUE(reader.next(fields));
+    EXPECT_EQ(fields, (std::vector<std::string_view>{"a", "b", "c"}));
+    EXPECT_EQ(reader.recordLine(), 1u);
+
+    ASSERT_TRUE(reader.next(fields));
+    EXPECT_EQ(fields, (std::vector<std::string_view>{"plain", "with, comma", "say \"hi\""}));
+    EXPECT_EQ(reader.recordLine(), 3u);
+    // Zero-copy: only the field that contained "" lives outside the input
+    auto inInput = [&](std::string_view field) {
+        return field.data() >= text.data() && field.data() < text.data() + text.size();
+    };
+    EXPECT_TRUE(inInput(fields[0]));
+    EXPECT_TRUE(inInput(fields[1]));
+    EXPECT_FALSE(inInput(fields[2]));
+
+    ASSERT_TRUE(reader.next(fields));
+    EXPECT_EQ(fields, (std::vector<std::string_view>{"two\nlines", "", "last"}));
+    EXPECT_EQ(reader.recordLine(), 4u);
+
+    ASSERT_TRUE(reader.next(fields));
+    EXPECT_EQ(fields, (std::vector<std::string_view>{"end", "only"}));
+    EXPECT_EQ(reader.recordLine(), 7u);
+    EXPECT_FALSE(reader.next(fields));
+
+    CsvReader unterminated("a,b\nx,\"never closed\ny,z\n");
+    ASSERT_TRUE(unterminated.next(fields));
+    try {
+        unterminated.next(fields);
+        FAIL() << "Unterminated quote should throw";
+    } catch (const CatalogFormatError& e) {
+        EXPECT_EQ(e.line(), 2u);
+    }
+
+    CsvReader trailing("\"quoted\"text,b\n");
+    EXPECT_THROW(trailing.next(fields), CatalogFormatError);
+}
+
+// Test Case 2.2: JSON strings are decoded, unknown keys skipped
+TEST_F(CatalogIOTest, JsonTokenizerDecodesEscapes) {
+    const std::string text =
+        "[\n"
+        "  {\"title\": \"Caf\\u00e9 \\\"Noir\\\"\", \"extra\": {\"nested\": [1, {\"deep\": true}]},\n"
+        "   \"description\": \"line1\\nline2 \\ud83d\\ude00\", \"rating\": 7.5,\n"
+        "   \"showtimes\": [\n"
+        "     {\"date\": \"2026-01-02\", \"start\": \"10:00\", \"end\": \"12:00\", \"auditorium\": 3, \"note\": null},\n"
+        "     {\"date\": \"2026-01-03\", \"start\": \"10:00\", \"end\": \"12:00\"}\n"
+        "   ]},\n"
+        "  {\"title\": \"Plain\", \"genre\": \"Drama\"}\n"
+        "]\n";
+    JsonCatalogReader reader(text);
+    CatalogRow row;
+
+    ASSERT_TRUE(reader.next(row));
+    EXPECT_EQ(row.title, "Caf\xC3\xA9 \"Noir\"");
+    EXPECT_EQ(row.description, "line1\nline2 \xF0\x9F\x98\x80");
+    EXPECT_EQ(row.rating, "7.5");
+    EXPECT_EQ(row.date, "2026-01-02");
+    EXPECT_EQ(row.auditorium, "3");
+    EXPECT_EQ(row.line, 5u);
+
+    ASSERT_TRUE(reader.next(row));
+    EXPECT_EQ(row.title, "Caf\xC3\xA9 \"Noir\"");
+    EXPECT_EQ(row.date, "2026-01-03");
+    EXPECT_TRUE(row.auditorium.empty());
+
+    ASSERT_TRUE(reader.next(row));
+    EXPECT_EQ(row.title, "Plain");
+    EXPECT_EQ(row.genre, "Drama");
+    EXPECT_TRUE(row.date.empty());
+    EXPECT_FALSE(reader.next(row));
+
+    auto errorLine = [](const std::string& json) -> std::size_t {
+        try {
+            JsonCatalogReader bad(json);
+            CatalogRow ignored;
+            while (bad.next(ignored)) {
+            }
+        } catch (const CatalogFormatError& e) {
+            return e.line();
+        }
+        return 0;
+    };
+    EXPECT_EQ(errorLine("[\n{\"title\": \"broken\nstring\"}]"), 2u);
+    EXPECT_EQ(errorLine("[\n{\"title\": \"x\"},\n{\"title\": \"bad \\q escape\"}]"), 3u);
+    EXPECT_EQ(errorLine("[{\"title\": \"x\"}]\n\n{}"), 3u);
+    EXPECT_EQ(errorLine("{\"title\": \"not an array\"}"), 1u);
+}
+
+// Test Case 2.3: A malformed feed is rejected before anything is written
+TEST_F(CatalogIOTest, ImporterRejectsBadFeedBeforeWriting) {
+    const std::size_t before = repo->getAllMovies().size();
+    const std::string header = "title,genre,rating,date,start,end,auditorium\n";
+    const std::string good = "Rejected Feed,Drama,7,2026-03-01,10:00,12:00,1\n";
+
+    for (const std::string& bad : {
+             std::string("Rejected Feed,Drama,7,2026-02-30,10:00,12:00,1\n"),
+             std::string("Rejected Feed,Drama,7,2026-03-02,10:00,10:00,1\n"),
+             std::string("Eleven Feed,Drama,11,2026-03-02,10:00,12:00,1\n"),
+             std::string("Other Feed,Drama,abc,,,,\n"),
+             std::string("Rejected Feed,Drama,7,2026-03-02,10:00,12:00,0\n"),
+             std::string(",Drama,7,2026-03-02,10:00,12:00,1\n")}) {
+        std::string feed = header + good + good + bad;
+        CsvCatalogReader reader(feed);
+        EXPECT_EQ(lineOfError(reader, *repo), 4u) << bad;
+    }
+
+    EXPECT_THROW(CsvCatalogReader("genre,date,start,end\nDrama,,,\n"), CatalogFormatError);
+    EXPECT_THROW(CsvCatalogReader("title,date,start\nX,2026-03-01,10:00\n"), CatalogFormatError);
+    EXPECT_THROW(CsvCatalogReader(""), CatalogFormatError);
+
+    EXPECT_EQ(repo->getAllMovies().size(), before);
+    EXPECT_EQ(findMovieId(*repo, "Rejected Feed"), 0);
+}
+
+// Test Case 2.4: New titles get their schedule, known titles get more showtimes
+TEST_F(CatalogIOTest, ImportAddsMoviesAndShowTimes) {
+    const std::string csv =
+        "Title,Genre,Description,Rating,Date,Start,End,Auditorium\n"
+        "Dune Imported,Sci-Fi,\"Sand, spice\",8.25,2026-04-01,18:00,20:45,1\n"
+        "Dune Imported,,,,2026-04-01,18:00,20:45,2\n"
+        "Dune Imported,,,,2026-04-02,18:00:30,20:45,1\n"
+        "Avengers,,,,2026-04-03,09:00,11:00,1\n";
+    CsvCatalogReader reader(csv);
+    CatalogImporter importer(*repo);
+    importer.read(reader);
+    EXPECT_EQ(importer.pending().rows, 4u);
+    EXPECT_EQ(importer.pending().showTimes, 4u);
+
+    CatalogImportStats stats = importer.commit();
+    EXPECT_EQ(stats.moviesAdded, 1u);
+    EXPECT_EQ(stats.moviesMatched, 1u);
+    EXPECT_EQ(stats.showTimes, 4u);
+    EXPECT_EQ(importer.pending().rows, 0u);
+
+    int duneId = findMovieId(*repo, "Dune Imported");
+    ASSERT_GT(duneId, 0);
+    auto dune = repo->getMovieById(duneId);
+    ASSERT_NE(dune, nullptr);
+    EXPECT_EQ(dune->getGenre(), "Sci-Fi");
+    EXPECT_EQ(dune->getDescription(), "Sand, spice");
+    EXPECT_FLOAT_EQ(dune->getRating(), 8.25f);
+
+    auto showTimes = repo->getShowTimesByMovieId(duneId);
+    ASSERT_EQ(showTimes.size(), 3u);
+    EXPECT_EQ(showTimes[2].date(), "2026-04-02");
+    EXPECT_EQ(showTimes[2].startTime(), "18:00:30");
+
+    auto evening = repo->getShowTimesBetween(*ShowTime::toEpoch("2026-04-01", "19:00"),
+                                             *ShowTime::toEpoch("2026-04-01", "19:30"));
+    ASSERT_EQ(evening.size(), 2u);
+    EXPECT_EQ(evening[0].auditoriumID + evening[1].auditoriumID, 3);
+
+    auto avengers = repo->getShowTimesByMovieId(1);
+    ASSERT_EQ(avengers.size(), 2u);
+    EXPECT_EQ(avengers[1].date(), "2026-04-03");
+
+    // The second movie overlaps Dune in auditorium 1: the first one stays, the second writes nothing
+    const std::string json =
+        "[{\"title\": \"Json Before\", \"genre\": \"Drama\", \"showtimes\": "
+        "[{\"date\": \"2026-05-01\", \"start\": \"10:00\", \"end\": \"12:00\"}]},\n"
+        " {\"title\": \"Json Overlap\", \"genre\": \"Drama\", \"showtimes\": "
+        "[{\"date\": \"2026-05-02\", \"start\": \"10:00\", \"end\": \"12:00\"},"
+        " {\"date\": \"2026-04-01\", \"start\": \"20:00\", \"end\": \"22:00\", \"auditorium\": 1}]}]";
+    JsonCatalogReader jsonReader(json);
+    CatalogImporter overlapping(*repo);
+    overlapping.read(jsonReader);
+    try {
+        overlapping.commit();
+        FAIL() << "Overlapping showtime should abort the import";
+    } catch (const std::runtime_error& e) {
+        std::string message = e.what();
+        EXPECT_NE(message.find("Json Overlap"), std::string::npos) << message;
+        EXPECT_NE(message.find("line 2"), std::string::npos) << message;
+    }
+    EXPECT_GT(findMovieId(*repo, "Json Before"), 0);
+    EXPECT_EQ(findMovieId(*repo, "Json Overlap"), 0);
+}
+
+// Test Case 2.5: Both export formats read back as the catalog they came from
+TEST_F(CatalogIOTest, ExportReadsBackAsTheSameCatalog) {
+    repo->addMovie(std::make_shared<Movie>("Quoted \"Export\"", "Comedy", "Commas, \"quotes\"\nand lines", 6.5f));
+
+    std::ostringstream csv;
+    std::ostringstream json;
+    std::size_t csvMovies = exportCatalogCsv(*repo, csv);
+    std::size_t jsonMovies = exportCatalogJson(*repo, json);
+    EXPECT_EQ(csvMovies, repo->getAllMovies().size());
+    EXPECT_EQ(jsonMovies, csvMovies);
+
+    const std::string csvText = csv.str();
+    const std::string jsonText = json.str();
+    CsvCatalogReader csvReader(csvText);
+    JsonCatalogReader jsonReader(jsonText);
+    std::vector<RowTuple> csvRows = readAll(csvReader);
+    std::vector<RowTuple> jsonRows = readAll(jsonReader);
+    EXPECT_EQ(csvRows, jsonRows);
+
+    // One row per showtime, plus one per movie without showtimes
+    std::size_t expected = 0;
+    for (const MovieDTO& movie : repo->getAllMovies()) {
+        expected += std::max<std::size_t>(1, repo->getShowTimesByMovieId(movie.id).size());
+    }
+    EXPECT_EQ(csvRows.size(), expected);
+
+    auto quoted = std::find_if(csvRows.begin(), csvRows.end(),
+                               [](const RowTuple& row) { return std::get<0>(row) == "Quoted \"Export\""; });
+    ASSERT_NE(quoted, csvRows.end());
+    EXPECT_EQ(std::get<1>(*quoted), "Commas, \"quotes\"\nand lines");
+    EXPECT_EQ(std::get<2>(*quoted), "6.5");
+    EXPECT_TRUE(std::get<3>(*quoted).empty());
+
+    auto dune = std::find_if(csvRows.begin(), csvRows.end(), [](const RowTuple& row) {
+        return std::get<0>(row) == "Dune Imported" && std::get<6>(row) == "2";
+    });
+    ASSERT_NE(dune, csvRows.end());
+    EXPECT_EQ(std::get<3>(*dune), "2026-04-01");
+    EXPECT_EQ(std::get<4>(*dune), "18:00");
+    EXPECT_EQ(std::get<5>(*dune), "20:45");
+}
+
+// Test Case 2.6: A show ending after midnight exports as an earlier end time and imports as the next day
+TEST_F(CatalogIOTest, LateShowSurvivesExportAndImport) {
+    const std::int64_t lateStart = *ShowTime::toEpoch("2026-07-01", "22:00");
+    repo->addMovie(std::make_shared<Movie>("Late Export", "Horror", "After hours", 7.0f),
+                   std::vector<ShowTimeSpec>{{lateStart, lateStart + 150 * 60, 4}});
+
+    using Slot = std::tuple<std::string, std::int64_t, std::int64_t, int>;
+    auto schedule = [](IMovieRepository& source) {
+        std::vector<Slot> slots;
+        for (const ScheduledShowTime& entry : source.getShowTimesBetween(0, *ShowTime::toEpoch("2100-01-01", "00:00"))) {
+            slots.emplace_back(entry.movieTitle, entry.showTime.startsAt, entry.showTime.endsAt, entry.auditoriumID);
+        }
+        std::sort(slots.begin(), slots.end());
+        return slots;
+    };
+    const std::vector<Slot> expected = schedule(*repo);
+
+    std::ostringstream csv;
+    std::ostringstream json;
+    exportCatalogCsv(*repo, csv);
+    exportCatalogJson(*repo, json);
+    const std::string csvText = csv.str();
+    const std::string jsonText = json.str();
+    EXPECT_NE(csvText.find("2026-07-01,22:00,00:30,4"), std::string::npos) << csvText;
+
+    for (bool useJson : {false, true}) {
+        // Same titles, no showtimes: everything the feed schedules must fit again
+        const std::string path = "roundtrip.db";
+        std::filesystem::remove(path);
+        {
+            DatabaseConnection db;
+            ASSERT_TRUE(db.connect(path));
+            ASSERT_TRUE(db.executeSQLFile("database.sql"));
+            SchemaMigrator(&db).migrate();
+            db.executeNonQuery("DELETE FROM BOOKSEAT");
+            db.executeNonQuery("DELETE FROM BOOKING");
+            db.executeNonQuery("DELETE FROM SHOWTIME");
+        }
+        MovieRepositorySQL target(path);
+        std::unique_ptr<CatalogReader> reader;
+        if (useJson) {
+            reader = std::make_unique<JsonCatalogReader>(jsonText);
+        } else {
+            reader = std::make_unique<CsvCatalogReader>(csvText);
+        }
+        CatalogImporter importer(target);
+        importer.read(*reader);
+        importer.commit();
+        EXPECT_EQ(schedule(target), expected) << (useJson ? "JSON" : "CSV");
+    }
+    std::filesystem::remove("roundtrip.db");
+}
+
+int main(int argc, char** argv) {
+    DatabaseConnection db;
+
+    const std::string dbPath = "database.db";
+
+    // Remove the existing database file if it exists
+    if (std::filesystem::exists(dbPath)) {
+        std::cout << "Removing existing database file..." << std::endl;
+        std::filesystem::remove(dbPath);
+    }
+
+    if (!db.connect(dbPath)) {
+        std::cerr << "Failed to connect to database" << std::endl;
+        return 1;
+    }
+
+    db.executeSQLFile("database.sql");
+    SchemaMigrator(&db).migrate();
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,445 @@
+/*
+* TEST PLAN FOR DATABASECONNECTION
+* --------------------------------
+*
+* 1. PURPOSE:
+*    - Verify the prepared-statement cache of the DatabaseConnection class.
+*    - Ensure that cached statements are reset and rebound correctly between executions.
+*    - Verify typed column access through QueryCursor.
+*    - Verify that connection profiles apply their pragmas and let readers run alongside a writer.
+*    - Verify that the connection pool lends readers in parallel and a single writer at a time.
+*
+* 2. TEST CASES:
+*    2.1. RepeatedQueryHitsCache:
+*         - Description: Run the same SELECT twice with different parameters.
+*         - Expected output: First run is a miss, second run is a hit, both return the right row.
+*
+*    2.2. NonQueryReusesStatement:
+*         - Description: Run the same INSERT twice, then read the rows back.
+*         - Expected output: One miss, one hit, both rows are inserted with their own parameters.
+*
+*    2.3. CacheEvictsLeastRecentlyUsed:
+*         - Description: Shrink the capacity to 2 and run three different queries.
+*         - Expected output: The first query is evicted and counted, the cache never exceeds 2 entries.
+*
+*    2.4. CursorReadsTypedColumns:
+*         - Description: Read MovieID, Title and Rating of movie 1 through QueryCursor.
+*         - Expected output: Integer, text and real values match the sample data without string conversion.
+*
+*    2.5. NestedCursorsWithSameSql:
+*         - Description: Open a second cursor with the same SQL while the first one is still stepping.
+*         - Expected output: Both cursors return their own rows and the statement is returned to the cache.
+*
+*    2.6. ForEachRowStreamsRows:
+*         - Description: Sum seat prices with forEachRow and iterate a cursor as a range.
+*         - Expected output: Every row is visited exactly once, in order.
+*
+*    2.7. SqlWithTrailingTextIsCached:
+*         - Description: Run an INSERT whose SQL ends in "; " twice, then empty the cache.
+*         - Expected output: The second run is a hit and every cached statement is finalized exactly once.
+*
+*    2.8. ServerProfileAppliesPragmas:
+*         - Description: Connect to a scratch file with the server profile, then reconnect without a profile.
+*         - Expected output: journal_mode, synchronous, temp_store, cache_size, mmap_size and busy_timeout
+*           match the profile on both connections.
+*
+*    2.9. DefaultProfileKeepsJournalMode:
+*         - Description: Put a scratch file in WAL mode with the kiosk profile, then reconnect with defaults().
+*         - Expected output: The file stays in WAL mode and no unset pragma is changed.
+*
+*    2.10. WalReaderIsNotBlockedByWriter:
+*         - Description: Hold an open write transaction on a second handle while reading through DatabaseConnection.
+*         - Expected output: The read succeeds and sees the last committed data, not the pending insert.
+*
+*    2.11. ReadersAreLeasedConcurrently:
+*         - Description: Hold every reader of a pool at the same time from separate threads.
+*         - Expected output: Each thread gets its own connection and its query succeeds.
+*
+*    2.12. ReaderSeesOnlyCommittedWrites:
+*         - Description: Insert through the writer inside an open transaction, read through a reader, then commit.
+*         - Expected output: The reader sees the old row count before the commit and the new one after.
+*
+*    2.13. WriterIsExclusive:
+*         - Description: Request the writer from a second thread while the first lease is held.
+*         - Expected output: The second thread waits until the first lease is released; a pool without readers is rejected.
+*
+* 3. TEST ENVIRONMENT SETUP:
+*    - Each test run, the database will be recreated from the SQL file.
+*    - Counters are reset before each test.
+*    - Profile and pool tests use their own scratch files and connections.
+*
+* 4. ASSUMPTIONS:
+*    - The database.sql file contains the necessary sample data for the test cases.
+*/
+
+#include <gtest/gtest.h>
+#include "../database/DatabaseConnection.h"
+#include "../database/ConnectionPool.h"
+#include "../database/Transaction.h"
+#include <string>
+#include <iostream>
+#include <filesystem>
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <thread>
+
+// Connection to database.db, opened in main()
+DatabaseConnection* connection = nullptr;
+
+class DatabaseConnectionTest : public ::testing::Test {
+protected:
+    DatabaseConnection* db;
+
+    void SetUp() override {
+        db = connection;
+        db->setStatementCacheCapacity(DatabaseConnection::DEFAULT_STATEMENT_CACHE_CAPACITY);
+        db->resetStatementCacheStats();
+    }
+};
+
+// Test Case 2.1: Test that a repeated query is served from the cache
+TEST_F(DatabaseConnectionTest, RepeatedQueryHitsCache) {
+    const std::string sql = "SELECT Title FROM MOVIE WHERE MovieID = ?";
+
+    auto first = db->executeQuery(sql, {"1"});
+    auto second = db->executeQuery(sql, {"2"});
+
+    ASSERT_EQ(first.size(), 1);
+    ASSERT_EQ(second.size(), 1);
+    EXPECT_EQ(first[0].at("Title"), "Avengers");
+    EXPECT_EQ(second[0].at("Title"), "Titanic") << "Cached statement should be rebound with the new parameter";
+
+    auto stats = db->getStatementCacheStats();
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.hits, 1);
+}
+
+// Test Case 2.2: Test that INSERT statements are reused with fresh bindings
+TEST_F(DatabaseConnectionTest, NonQueryReusesStatement) {
+    const std::string sql = "INSERT INTO SEATTYPE (SeatType, Price) VALUES (?, ?)";
+
+    EXPECT_TRUE(db->executeNonQuery(sql, {"Vip", "120.0"}));
+    EXPECT_TRUE(db->executeNonQuery(sql, {"Sweetbox", "150.0"}));
+
+    auto stats = db->getStatementCacheStats();
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.hits, 1);
+
+    auto rows = db->executeQuery("SELECT SeatType FROM SEATTYPE WHERE Price > ? ORDER BY Price", {"100"});
+    ASSERT_EQ(rows.size(), 2);
+    EXPECT_EQ(rows[0].at("SeatType"), "Vip");
+    EXPECT_EQ(rows[1].at("SeatType"), "Sweetbox");
+}
+
+// Test Case 2.3: Test least-recently-used eviction
+TEST_F(DatabaseConnectionTest, CacheEvictsLeastRecentlyUsed) {
+    // Drop statements cached by previous tests, then keep at most two
+    db->setStatementCacheCapacity(0);
+    db->setStatementCacheCapacity(2);
+    db->resetStatementCacheStats();
+
+    db->executeQuery("SELECT COUNT(*) FROM MOVIE");
+    db->executeQuery("SELECT COUNT(*) FROM SHOWTIME");
+    db->executeQuery("SELECT COUNT(*) FROM SEAT");
+
+    auto stats = db->getStatementCacheStats();
+    EXPECT_EQ(stats.size, 2);
+    EXPECT_EQ(stats.evictions, 1);
+
+    // The MOVIE query was the least recently used one, so it has to be compiled again
+    db->executeQuery("SELECT COUNT(*) FROM MOVIE");
+    stats = db->getStatementCacheStats();
+    EXPECT_EQ(stats.misses, 4);
+    EXPECT_EQ(stats.hits, 0);
+}
+
+// Test Case 2.4: Test typed column access
+TEST_F(DatabaseConnectionTest, CursorReadsTypedColumns) {
+    auto cursor = db->query("SELECT MovieID, Title, Rating, NULL FROM MOVIE WHERE MovieID = ?", {"1"});
+
+    ASSERT_TRUE(cursor.next());
+    const ResultRow& row = cursor.row();
+    EXPECT_EQ(row.columnCount(), 4);
+    EXPECT_EQ(row.getInt64(0), 1);
+    EXPECT_EQ(row.getText(1), "Avengers");
+    EXPECT_DOUBLE_EQ(row.getDouble(2), 8.5);
+    EXPECT_TRUE(row.isNull(3));
+    EXPECT_TRUE(row.getText(3).empty());
+
+    EXPECT_FALSE(cursor.next()) << "Only one movie has MovieID = 1";
+    EXPECT_TRUE(cursor.ok());
+}
+
+// Test Case 2.5: Test two live cursors sharing the same SQL text
+TEST_F(DatabaseConnectionTest, NestedCursorsWithSameSql) {
+    const std::string sql = "SELECT Title FROM MOVIE WHERE MovieID = ?";
+    {
+        auto outer = db->query(sql, {"1"});
+        ASSERT_TRUE(outer.next());
+
+        auto inner = db->query(sql, {"2"});
+        ASSERT_TRUE(inner.next());
+
+        EXPECT_EQ(outer.row().getText(0), "Avengers");
+        EXPECT_EQ(inner.row().getText(0), "Titanic");
+    }
+
+    // The cached copy is idle again, so the next run is a hit
+    db->resetStatementCacheStats();
+    auto again = db->query(sql, {"2"});
+    ASSERT_TRUE(again.next());
+    EXPECT_EQ(again.row().getText(0), "Titanic");
+    EXPECT_EQ(db->getStatementCacheStats().hits, 1);
+}
+
+// Test Case 2.6: Test streaming rows through a visitor and a range-for loop
+TEST_F(DatabaseConnectionTest, ForEachRowStreamsRows) {
+    int rows = 0;
+    double total = 0;
+    bool ok = db->forEachRow("SELECT Price FROM SEAT WHERE SeatID IN (?, ?)", {"A1", "B1"},
+        [&](const ResultRow& row) {
+            ++rows;
+            total += row.getDouble(0);
+        });
+
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(rows, 2);
+    EXPECT_DOUBLE_EQ(total, 140.0);
+
+    std::vector<int> ids;
+    for (const ResultRow& row : db->query("SELECT MovieID FROM MOVIE ORDER BY MovieID")) {
+        ids.push_back(row.getInt(0));
+    }
+    EXPECT_EQ(ids, (std::vector<int>{1, 2}));
+}
+
+// Test Case 2.7: Test that SQL with text after the statement is returned to its cache entry
+TEST_F(DatabaseConnectionTest, SqlWithTrailingTextIsCached) {
+    // sqlite3_sql() of this statement stops before the "; ", so it differs from the cache key
+    const std::string sql = "INSERT INTO SEATTYPE (SeatType, Price) VALUES (?, ?); ";
+
+    EXPECT_TRUE(db->executeNonQuery(sql, {"Balcony", "70.0"}));
+    EXPECT_TRUE(db->executeNonQuery(sql, {"Recliner", "80.0"}));
+
+    auto stats = db->getStatementCacheStats();
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.hits, 1) << "The statement must be idle in the cache, not finalized behind its back";
+
+    auto rows = db->executeQuery("SELECT SeatType FROM SEATTYPE WHERE Price BETWEEN ? AND ? ORDER BY Price", {"60", "85"});
+    ASSERT_EQ(rows.size(), 2);
+    EXPECT_EQ(rows[0].at("SeatType"), "Balcony");
+    EXPECT_EQ(rows[1].at("SeatType"), "Recliner");
+
+    // Emptying the cache finalizes the statement once (a second finalize is a double free under ASan)
+    db->setStatementCacheCapacity(0);
+    EXPECT_EQ(db->getStatementCacheStats().size, 0);
+}
+
+// Scratch database for the connection profile tests
+class ConnectionProfileTest : public ::testing::Test {
+protected:
+    std::unique_ptr<DatabaseConnection> owned;
+    DatabaseConnection* db;
+    const std::string path = "profile_test.db";
+
+    std::int64_t pragma(const std::string& name) {
+        auto cursor = db->query("PRAGMA " + name);
+        return cursor.next() ? cursor.row().getInt64(0) : -1;
+    }
+
+    void SetUp() override {
+        removeFiles();
+        owned = std::make_unique<DatabaseConnection>();
+        db = owned.get();
+    }
+
+    void TearDown() override {
+        owned.reset();
+        removeFiles();
+    }
+
+    void removeFiles() {
+        for (const char* suffix : {"", "-wal", "-shm"}) {
+            std::filesystem::remove(path + suffix);
+        }
+    }
+};
+
+// Test Case 2.8: Test that a profile's pragmas are applied and kept on reconnect
+TEST_F(ConnectionProfileTest, ServerProfileAppliesPragmas) {
+    ConnectionProfile server = ConnectionProfile::server();
+    ASSERT_TRUE(db->connect(path, server));
+
+    for (int pass = 0; pass < 2; ++pass) {
+        {
+            auto mode = db->query("PRAGMA journal_mode");
+            ASSERT_TRUE(mode.next());
+            EXPECT_EQ(mode.row().getText(0), "wal");
+        }
+        EXPECT_EQ(pragma("synchronous"), 1) << "1 = NORMAL";
+        EXPECT_EQ(pragma("temp_store"), 2) << "2 = MEMORY";
+        EXPECT_EQ(pragma("cache_size"), -*server.cacheSizeKiB);
+        EXPECT_EQ(pragma("mmap_size"), *server.mmapSize);
+        EXPECT_EQ(pragma("busy_timeout"), server.busyTimeoutMs);
+
+        // connect() without a profile keeps the one given last; the tuning must survive that
+        ASSERT_TRUE(db->connect(path));
+    }
+}
+
+// Test Case 2.9: Test that a profile without settings leaves the file and SQLite's defaults alone
+TEST_F(ConnectionProfileTest, DefaultProfileKeepsJournalMode) {
+    ASSERT_TRUE(db->connect(path, ConnectionProfile::kiosk()));
+    db->disconnect();
+
+    ASSERT_TRUE(db->connect(path, ConnectionProfile::defaults()));
+    {
+        auto mode = db->query("PRAGMA journal_mode");
+        ASSERT_TRUE(mode.next());
+        EXPECT_EQ(mode.row().getText(0), "wal") << "A plain connect must not switch a WAL database back to rollback";
+    }
+    EXPECT_EQ(pragma("temp_store"), 0) << "0 = DEFAULT, not set";
+    EXPECT_EQ(pragma("busy_timeout"), 0);
+}
+
+// Test Case 2.10: Test that WAL lets a reader proceed while another connection writes
+TEST_F(ConnectionProfileTest, WalReaderIsNotBlockedByWriter) {
+    ASSERT_TRUE(db->connect(path, ConnectionProfile::kiosk()));
+    ASSERT_TRUE(db->executeNonQuery("CREATE TABLE SEATLOG (SeatID TEXT)"));
+    ASSERT_TRUE(db->executeNonQuery("INSERT INTO SEATLOG VALUES ('A1')"));
+
+    sqlite3* writer = nullptr;
+    ASSERT_EQ(sqlite3_open(path.c_str(), &writer), SQLITE_OK);
+    ASSERT_EQ(sqlite3_exec(writer, "BEGIN IMMEDIATE; INSERT INTO SEATLOG VALUES ('A2');", nullptr, nullptr, nullptr), SQLITE_OK);
+
+    auto cursor = db->query("SELECT COUNT(*) FROM SEATLOG");
+    ASSERT_TRUE(cursor.next()) << "The reader must not get SQLITE_BUSY while the writer holds its lock";
+    EXPECT_EQ(cursor.row().getInt(0), 1) << "Uncommitted rows are not visible";
+    EXPECT_TRUE(cursor.ok());
+
+    sqlite3_exec(writer, "ROLLBACK", nullptr, nullptr, nullptr);
+    sqlite3_close(writer);
+}
+
+// Scratch database for the connection pool tests
+class ConnectionPoolTest : public ::testing::Test {
+protected:
+    const std::string path = "pool_test.db";
+    std::unique_ptr<ConnectionPool> pool;
+
+    void SetUp() override {
+        removeFiles();
+        pool = std::make_unique<ConnectionPool>(path, 3, ConnectionProfile::kiosk());
+        auto db = pool->writer();
+        ASSERT_TRUE(db->executeNonQuery("CREATE TABLE SEATLOG (SeatID TEXT)"));
+        ASSERT_TRUE(db->executeNonQuery("INSERT INTO SEATLOG VALUES ('A1')"));
+    }
+
+    void TearDown() override {
+        pool.reset();
+        removeFiles();
+    }
+
+    void removeFiles() {
+        for (const char* suffix : {"", "-wal", "-shm"}) {
+            std::filesystem::remove(path + suffix);
+        }
+    }
+
+    int countRows(DatabaseConnection* db) {
+        auto cursor = db->query("SELECT COUNT(*) FROM SEATLOG");
+        return cursor.next() ? cursor.row().getInt(0) : -1;
+    }
+};
+
+// Test Case 2.11: Test that every reader can be in use at the same time
+TEST_F(ConnectionPoolTest, ReadersAreLeasedConcurrently) {
+    ASSERT_EQ(pool->readerCount(), 3u);
+
+    std::atomic<int> holding{0};
+    std::mutex seenMutex;
+    std::set<DatabaseConnection*> seen;
+    std::vector<int> counts(pool->readerCount(), 0);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < pool->readerCount(); ++i) {
+        threads.emplace_back([&, i] {
+            auto db = pool->reader();
+            {
+                std::lock_guard<std::mutex> lock(seenMutex);
+                seen.insert(db.get());
+            }
+            // Keep the lease until every thread holds one
+            ++holding;
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (holding < static_cast<int>(pool->readerCount()) && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::yield();
+            }
+            counts[i] = countRows(db.get());
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(holding, 3);
+    EXPECT_EQ(seen.size(), 3u) << "Each concurrent lease must get its own connection";
+    EXPECT_EQ(counts, (std::vector<int>{1, 1, 1}));
+}
+
+// Test Case 2.12: Test that readers see the writer's rows only once committed
+TEST_F(ConnectionPoolTest, ReaderSeesOnlyCommittedWrites) {
+    auto writer = pool->writer();
+    Transaction transaction(writer.get(), Transaction::Mode::IMMEDIATE);
+    ASSERT_TRUE(writer->executeNonQuery("INSERT INTO SEATLOG VALUES ('A2')"));
+
+    EXPECT_EQ(countRows(pool->reader().get()), 1) << "The reader must not wait for or see the open transaction";
+
+    transaction.commit();
+    EXPECT_EQ(countRows(pool->reader().get()), 2);
+}
+
+// Test Case 2.13: Test that only one thread writes at a time
+TEST_F(ConnectionPoolTest, WriterIsExclusive) {
+    std::atomic<bool> acquired{false};
+    std::thread second;
+    {
+        auto first = pool->writer();
+        second = std::thread([&] {
+            auto db = pool->writer();
+            acquired = true;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_FALSE(acquired) << "The writer must not be lent twice";
+    }
+    second.join();
+    EXPECT_TRUE(acquired);
+
+    EXPECT_THROW(ConnectionPool(path, 0), std::invalid_argument);
+}
+
+int main(int argc, char** argv) {
+    DatabaseConnection db;
+    connection = &db;
+
+    const std::string dbPath = "database.db";
+
+    // Remove the existing database file if it exists
+    if (std::filesystem::exists(dbPath)) {
+        std::cout << "Removing existing database file..." << std::endl;
+        std::filesystem::remove(dbPath);
+    }
+
+    if (!db.connect(dbPath)) {
+        std::cerr << "Failed to connect to database" << std::endl;
+        return 1;
+    }
+
+    db.executeSQLFile("database.sql");
+
+    ::testing::InitGoogleTest(&argc, argv);
+    int result = RUN_ALL_TESTS();
+
+    db.disconnect();
+    return result;
+}
@@ -31,8 +31,75 @@
 *         - Expected output: List of showtime strings with correct format
 *         - Condition: Database has showtimes for the movie with ID 1
 *
+*    2.5. CachedCatalogServesRepeatedReads:
+*         - Description: MovieViewerService over a CachedMovieRepository answers repeated reads from memory
+*         - Input: Movie list, movie 1, showtimes of movie 1 and unknown movie 999, each read twice
+*         - Expected output: Same results as without cache; 4 misses then 4 hits; a returned
+*           movie can be modified without changing the cached one
+*
+*    2.6. CachedCatalogInvalidatesOnManagerWrites:
+*         - Description: Writes through MovieManagerService drop exactly the affected cache entries
+*         - Input: Add a movie with two showtimes, delete one showtime, delete the movie
+*         - Expected output: Every read after a write sees the write; the cached detail of
+*           movie 2 stays a hit throughout
+*
+*    2.7. DetailsViewModelQueriesOnlyOnLoad:
+*         - Description: The movie details screen reads a MovieDetailsViewModel for 10 seconds of frames
+*         - Input: Load movie 1, read every field 600 times, invalidate, load unknown movie 999
+*         - Expected output: Two service calls in total for movie 1 (detail, showtimes); the fields match
+*           the service; long descriptions are wrapped at word boundaries; 999 leaves it unloaded
+*
+*    2.8. MoviesPagesFollowKeysetOrder:
+*         - Description: showMoviesPage returns the catalog in pages, each starting after the last ID of the previous one
+*         - Input: 9 extra movies, pages of 4 through a CachedMovieRepository, a movie added in between
+*         - Expected output: The pages concatenate to showAllMovies(); the last page is short; paging
+*           after the last ID returns nothing; the added movie appears on the last page
+*
+*    2.9. MovieListPagerKeepsBoundedWindow:
+*         - Description: The virtualized movie list scrolls through the whole catalog with a few pages in memory
+*         - Input: MovieListPager with pages of 2 and at most 3 cached pages, scrolled down and back up
+*         - Expected output: Every visible row matches showAllMovies(); never more than 3 pages loaded;
+*           reading rows never calls the service; the total is known once the end was reached
+*
+*    2.10. SearchMoviesRanksPrefixMatches:
+*         - Description: showMoviesPage's full-text counterpart, searchMovies
+*         - Input: Prefixes, upper case, unaccented spelling, FTS5 operators and quotes typed as text;
+*           movies added and deleted through a CachedMovieRepository
+*         - Expected output: Prefix, case- and accent-insensitive matches; title matches rank above
+*           description matches; operators never cause an error; the index follows inserts and deletes
+*
+*    2.11. ShowTimesCannotOverlapInAnAuditorium:
+*         - Description: addShowTime checks the auditorium's schedule through the SHOWTIME_RTREE interval index
+*         - Input: 18:00-20:00 in auditorium 1, then showtimes overlapping it, touching it, in auditorium 2,
+*           and time-window queries over the same evening
+*         - Expected output: Overlaps (also by seconds) throw ShowTimeOverlapException naming the showtime
+*           in the way and write nothing; touching showtimes and other auditoriums are accepted; window
+*           queries return what runs during the window, ordered by start time
+*
+*    2.12. ShowTimeParsesAndFormatsEpochSeconds:
+*         - Description: ShowTime keeps start and end as epoch seconds; text is parsed and formatted by hand
+*         - Input: Known dates and times, leap days, impossible dates (2030-02-30) and times (24:00),
+*           malformed text, times before 1970, and showtimes added out of order through MovieManagerService
+*         - Expected output: Exact epoch values; invalid text is rejected; formatting round-trips
+*           ("HH:MM", seconds only when not zero); showtimes come back ordered by start time
+*
+*    2.13. BatchedShowTimesAreAllOrNothing:
+*         - Description: addShowTimes and addMovie with a schedule write in one transaction
+*         - Input: A movie with a year of daily showtimes; batches overlapping themselves or ending before
+*           they start; MovieManagerService::addMovie with an overlapping, malformed or bad-auditorium showtime
+*         - Expected output: The season is stored in full; failed batches write nothing; a failed addMovie
+*           leaves no movie behind; the cached catalog follows every successful write
+*
+*    2.14. FailedReadsAreNotEmptyResults:
+*         - Description: Catalog reads on a database whose tables are missing report the failure
+*         - Input: A scratch database file with no tables, read through a CachedMovieRepository;
+*           a database created from database.sql but not migrated (no MOVIE_FTS, no SHOWTIME_RTREE)
+*         - Expected output: getMoviesPage, searchMovies and getShowTimesBetween throw std::runtime_error
+*           instead of returning an empty result, and nothing is cached for them
+*
 * 3. TEST ENVIRONMENT SETUP:
-*    - Each test run, the database will be used with sample data from database.sql
+*    - Each test run, the database will be used with sample data from database.sql,
+*      migrated to the latest schema version as ServiceBootstrap does
 *    - MovieViewerService is initialized with an instance of MovieRepositorySQL for each test
 *    - The database connection will be closed after completing all tests
 *
@@ -44,11 +111,21 @@
 #include <gtest/gtest.h>
 #include "../service/MovieViewerService.h"
 #include "../repository/MovieRepositorySQL.h"
+#include "../repository/CachedMovieRepository.h"
+#include "../repository/ShowTimeOverlapException.h"
+#include "../repository/ShowTimeSpec.h"
+#include "../service/MovieManagerService.h"
+#include "../UI/MovieDetailsViewModel.h"
+#include "../UI/MovieListPager.h"
 #include "../model/Movie.h"
 #include "../model/ShowTime.h"
 #include "../repository/IMovieRepository.h"
 #include "../database/DatabaseConnection.h"
+#include "../database/SchemaMigrator.h"
+#include <algorithm>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <vector>
 #include <string>
 #include <iostream>
@@ -147,10 +224,511 @@ TEST_F(MovieViewerServiceDBTest, CanShowMovieShowTimes) {
    
 }
 
+// Test Case 2.5: Repeated catalog reads are served from the cache
+TEST_F(MovieViewerServiceDBTest, CachedCatalogServesRepeatedReads) {
+    auto cache = std::make_shared<CachedMovieRepository>(repo);
+    MovieViewerService cachedService(cache);
+
+    for (int round = 0; round < 2; ++round) {
+        auto movies = cachedService.showAllMovies();
+        EXPECT_EQ(movies.size(), service->showAllMovies().size());
+
+        auto movie = cachedService.showMovieDetail(1);
+        ASSERT_NE(movie, nullptr);
+        EXPECT_EQ(movie->getTitle(), "Avengers");
+        // Callers get their own copy
+        movie->setTitle("Changed by caller");
+
+        EXPECT_EQ(cachedService.showMovieShowTimes(1).size(), service->showMovieShowTimes(1).size());
+
+        testing::internal::CaptureStdout();
+        EXPECT_EQ(cachedService.showMovieDetail(999), nullptr);
+        testing::internal::GetCapturedStdout();
+    }
+
+    auto stats = cache->stats();
+    EXPECT_EQ(stats.misses, 4u);
+    EXPECT_EQ(stats.hits, 4u);
+    EXPECT_EQ(stats.version, 0u);
+}
+
+// Test Case 2.6: Admin writes invalidate exactly the affected entries
+TEST_F(MovieViewerServiceDBTest, CachedCatalogInvalidatesOnManagerWrites) {
+    auto cache = std::make_shared<CachedMovieRepository>(repo);
+    MovieViewerService viewer(cache);
+    MovieManagerService manager(cache);
+
+    auto titles = [&viewer]() {
+        std::vector<std::string> result;
+        for (const auto& movie : viewer.showAllMovies()) {
+            result.push_back(movie.title);
+        }
+        return result;
+    };
+    auto listed = [&titles](const std::string& title) {
+        auto all = titles();
+        return std::find(all.begin(), all.end(), title) != all.end();
+    };
+
+    ASSERT_FALSE(listed("Dune"));
+    ASSERT_NE(viewer.showMovieDetail(2), nullptr);
+
+    manager.addMovie(std::make_shared<Movie>("Dune", "Sci-Fi", "Desert planet", 8.0f),
+                     {"2030-06-01,18:00,20:30", "2030-06-02,18:00,20:30"});
+    ASSERT_TRUE(listed("Dune"));
+
+    int duneId = 0;
+    for (const auto& movie : viewer.showAllMovies()) {
+        if (movie.title == "Dune") {
+            duneId = movie.id;
+        }
+    }
+    auto showTimes = viewer.showMovieShowTimes(duneId);
+    ASSERT_EQ(showTimes.size(), 2u);
+
+    manager.deleteShowTime(duneId, showTimes[0].showTimeID);
+    ASSERT_EQ(viewer.showMovieShowTimes(duneId).size(), 1u);
+
+    auto before = cache->stats();
+    ASSERT_NE(viewer.showMovieDetail(2), nullptr);
+    EXPECT_EQ(cache->stats().hits, before.hits + 1) << "Movie 2 was not affected by the writes";
+
+    manager.deleteMovie(duneId);
+    EXPECT_FALSE(listed("Dune"));
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(viewer.showMovieDetail(duneId), nullptr);
+    testing::internal::GetCapturedStdout();
+    EXPECT_TRUE(viewer.showMovieShowTimes(duneId).empty());
+    EXPECT_GT(cache->stats().invalidations, 0u);
+}
+
+// Counts how often the UI reaches the service layer
+class CountingViewerService : public IMovieViewerService {
+public:
+    explicit CountingViewerService(IMovieViewerService& inner) : inner(inner) {}
+
+    std::vector<MovieDTO> showAllMovies() override { ++calls; return inner.showAllMovies(); }
+    std::shared_ptr<IMovie> showMovieDetail(int id) override { ++calls; return inner.showMovieDetail(id); }
+    std::vector<ShowTime> showMovieShowTimes(int id) override { ++calls; return inner.showMovieShowTimes(id); }
+    std::vector<MovieDTO> showMoviesPage(int afterMovieId, std::size_t limit) override {
+        ++calls;
+        return inner.showMoviesPage(afterMovieId, limit);
+    }
+    std::vector<MovieDTO> searchMovies(const std::string& query, std::size_t limit) override {
+        ++calls;
+        return inner.searchMovies(query, limit);
+    }
+    std::vector<ScheduledShowTime> showShowTimesBetween(const std::string& date, const std::string& fromTime,
+                                                        const std::string& toTime) override {
+        ++calls;
+        return inner.showShowTimesBetween(date, fromTime, toTime);
+    }
+
+    int calls = 0;
+
+private:
+    IMovieViewerService& inner;
+};
+
+// Test Case 2.7: Rendering the details screen never queries the service
+TEST_F(MovieViewerServiceDBTest, DetailsViewModelQueriesOnlyOnLoad) {
+    CountingViewerService counting(*service);
+    MovieDetailsViewModel details;
+    ASSERT_FALSE(details.isLoaded());
+
+    ASSERT_TRUE(details.load(&counting, 1));
+    EXPECT_EQ(counting.calls, 2);
+
+    // 10 seconds at 60 FPS
+    std::size_t drawn = 0;
+    for (int frame = 0; frame < 600; ++frame) {
+        ASSERT_TRUE(details.isLoaded());
+        drawn += details.getTitle().size() + details.getGenre().size() +
+                 details.getWrappedDescription().size() + details.getShowTimes().size();
+    }
+    EXPECT_GT(drawn, 0u);
+    EXPECT_EQ(counting.calls, 2) << "Frames must be drawn from the view-model";
+
+    EXPECT_EQ(details.getMovieId(), 1);
+    EXPECT_EQ(details.getTitle(), "Avengers");
+    EXPECT_FLOAT_EQ(details.getRating(), 8.5f);
+    EXPECT_EQ(details.getShowTimes().size(), service->showMovieShowTimes(1).size());
+
+    details.invalidate();
+    EXPECT_FALSE(details.isLoaded());
+    EXPECT_TRUE(details.getShowTimes().empty());
+
+    testing::internal::CaptureStdout();
+    EXPECT_FALSE(details.load(&counting, 999));
+    testing::internal::GetCapturedStdout();
+    EXPECT_FALSE(details.isLoaded());
+    EXPECT_FALSE(details.load(nullptr, 1));
+
+    std::string longText;
+    for (int i = 0; i < 40; ++i) {
+        longText += "word ";
+    }
+    std::string wrapped = MovieDetailsViewModel::wrapText(longText, MovieDetailsViewModel::DESCRIPTION_LINE_LENGTH);
+    EXPECT_NE(wrapped.find('\n'), std::string::npos);
+    EXPECT_LE(wrapped.find('\n'), MovieDetailsViewModel::DESCRIPTION_LINE_LENGTH);
+    EXPECT_EQ(MovieDetailsViewModel::wrapText("short", 85), "short");
+}
+
+// Adds movies "Paged 1".."Paged n" and removes them when the test ends
+class PagedMovies {
+public:
+    PagedMovies(MovieManagerService& manager, IMovieViewerService& viewer, int count) : manager(manager) {
+        for (int i = 1; i <= count; ++i) {
+            manager.addMovie(std::make_shared<Movie>("Paged " + std::to_string(i), "Drama", "Paging", 7.0f), {});
+        }
+        for (const auto& movie : viewer.showAllMovies()) {
+            if (movie.title.rfind("Paged ", 0) == 0) {
+                ids.push_back(movie.id);
+            }
+        }
+    }
+    ~PagedMovies() {
+        for (int id : ids) {
+            manager.deleteMovie(id);
+        }
+    }
+
+private:
+    MovieManagerService& manager;
+    std::vector<int> ids;
+};
+
+// Test Case 2.8: Keyset pages cover the catalog exactly once, in ID order
+TEST_F(MovieViewerServiceDBTest, MoviesPagesFollowKeysetOrder) {
+    auto cache = std::make_shared<CachedMovieRepository>(repo);
+    MovieViewerService viewer(cache);
+    MovieManagerService manager(cache);
+    PagedMovies extra(manager, viewer, 9);
+
+    auto all = viewer.showAllMovies();
+    ASSERT_EQ(all.size(), 11u);
+
+    std::vector<MovieDTO> paged;
+    int after = 0;
+    std::size_t pageCount = 0;
+    while (true) {
+        auto page = viewer.showMoviesPage(after, 4);
+        ASSERT_LE(page.size(), 4u);
+        if (page.empty()) {
+            break;
+        }
+        ++pageCount;
+        paged.insert(paged.end(), page.begin(), page.end());
+        after = page.back().id;
+    }
+    EXPECT_EQ(pageCount, 3u);
+    ASSERT_EQ(paged.size(), all.size());
+    for (std::size_t i = 0; i < all.size(); ++i) {
+        EXPECT_EQ(paged[i].id, all[i].id);
+        EXPECT_EQ(paged[i].title, all[i].title);
+        if (i > 0) {
+            EXPECT_LT(paged[i - 1].id, paged[i].id);
+        }
+    }
+    EXPECT_EQ(viewer.showMoviesPage(all[7].id, 4).size(), 3u);
+    EXPECT_TRUE(viewer.showMoviesPage(all.back().id, 4).empty());
+
+    // Cached pages are dropped when a movie is added
+    auto before = cache->stats();
+    viewer.showMoviesPage(all[7].id, 4);
+    EXPECT_EQ(cache->stats().hits, before.hits + 1);
+
+    manager.addMovie(std::make_shared<Movie>("Late", "Drama", "Added while paging", 6.0f), {});
+    auto last = viewer.showMoviesPage(all[7].id, 4);
+    ASSERT_EQ(last.size(), 4u);
+    EXPECT_EQ(last.back().title, "Late");
+    manager.deleteMovie(last.back().id);
+}
+
+// Test Case 2.9: The virtualized list only keeps the pages around the visible rows
+TEST_F(MovieViewerServiceDBTest, MovieListPagerKeepsBoundedWindow) {
+    MovieManagerService manager(repo);
+    PagedMovies extra(manager, *service, 9);
+    auto all = service->showAllMovies();
+    ASSERT_EQ(all.size(), 11u);
+
+    CountingViewerService counting(*service);
+    MovieListPager pager(2, 3);
+    pager.reset([&counting](int after, std::size_t limit) { return counting.showMoviesPage(after, limit); });
+    EXPECT_EQ(counting.calls, 1);
+    EXPECT_FALSE(pager.reachedEnd());
+
+    const std::size_t visible = 3;
+    auto checkWindow = [&](std::size_t offset) {
+        pager.ensureLoaded(offset, visible);
+        EXPECT_LE(pager.loadedPageCount(), 3u);
+
+        int callsBefore = counting.calls;
+        for (std::size_t i = offset; i < offset + visible && i < all.size(); ++i) {
+            const MovieDTO* movie = pager.at(i);
+            ASSERT_NE(movie, nullptr) << "row " << i;
+            EXPECT_EQ(movie->id, all[i].id);
+        }
+        EXPECT_EQ(counting.calls, callsBefore) << "Reading rows must not load pages";
+    };
+
+    std::size_t offset = 0;
+    checkWindow(offset);
+    while (pager.hasRowsFrom(offset + visible)) {
+        checkWindow(++offset);
+    }
+    EXPECT_EQ(offset + visible, all.size());
+    EXPECT_TRUE(pager.reachedEnd());
+    EXPECT_EQ(pager.knownRowCount(), all.size());
+    EXPECT_EQ(pager.at(all.size()), nullptr);
+
+    // Scrolling back reloads the dropped pages
+    while (offset > 0) {
+        checkWindow(--offset);
+    }
+    EXPECT_EQ(pager.at(all.size() - 1), nullptr) << "Pages far from the window are dropped";
+
+    pager.clear();
+    EXPECT_EQ(pager.loadedPageCount(), 0u);
+    EXPECT_FALSE(pager.hasRowsFrom(0));
+    EXPECT_THROW(MovieListPager(0), std::invalid_argument);
+}
+
+// Test Case 2.10: Ranked prefix search through the full-text index
+TEST_F(MovieViewerServiceDBTest, SearchMoviesRanksPrefixMatches) {
+    auto cache = std::make_shared<CachedMovieRepository>(repo);
+    MovieViewerService viewer(cache);
+    MovieManagerService manager(cache);
+
+    auto titles = [&viewer](const std::string& query, std::size_t limit = 10) {
+        std::vector<std::string> result;
+        for (const auto& movie : viewer.searchMovies(query, limit)) {
+            result.push_back(movie.title);
+        }
+        return result;
+    };
+
+    EXPECT_EQ(titles("aven"), (std::vector<std::string>{"Avengers"}));
+    EXPECT_EQ(titles("AVENGERS"), (std::vector<std::string>{"Avengers"}));
+    EXPECT_EQ(titles("romance"), (std::vector<std::string>{"Titanic"})) << "Genres are searched";
+    EXPECT_EQ(titles("tragic sh"), (std::vector<std::string>{"Titanic"})) << "Every word must match";
+    EXPECT_TRUE(titles("tragic avengers").empty());
+
+    // Typed text is never FTS5 syntax
+    EXPECT_TRUE(titles("").empty());
+    EXPECT_TRUE(titles("  \"*( ").empty());
+    EXPECT_EQ(titles("aven OR \"titanic"), std::vector<std::string>{}) << "OR is a word, not an operator";
+    EXPECT_EQ(titles("NEAR(aven"), std::vector<std::string>{});
+    EXPECT_EQ(titles("\"avengers\""), (std::vector<std::string>{"Avengers"}));
+
+    // The triggers index new movies; titles rank above descriptions
+    manager.addMovie(std::make_shared<Movie>("Love Actually", "Comedy", "Eight couples at Christmas", 7.6f), {});
+    manager.addMovie(std::make_shared<Movie>("Amélie", "Comedy", "A shy waitress in Paris", 8.3f), {});
+    EXPECT_EQ(titles("love"), (std::vector<std::string>{"Love Actually", "Titanic"}));
+    EXPECT_EQ(titles("amelie"), (std::vector<std::string>{"Amélie"}));
+    EXPECT_EQ(titles("comedy", 1).size(), 1u);
+
+    for (const auto& movie : viewer.searchMovies("comedy", 10)) {
+        manager.deleteMovie(movie.id);
+    }
+    EXPECT_TRUE(titles("amelie").empty());
+    EXPECT_EQ(titles("love"), (std::vector<std::string>{"Titanic"}));
+}
+
+// Test Case 2.11: The interval index keeps each auditorium's schedule free of overlaps
+TEST_F(MovieViewerServiceDBTest, ShowTimesCannotOverlapInAnAuditorium) {
+    MovieManagerService manager(repo);
+    manager.addMovie(std::make_shared<Movie>("Overlap Probe", "Drama", "Scheduling", 7.0f),
+                     {"2030-01-01,18:00,20:00"});
+    int movieId = service->showAllMovies().back().id;
+    auto first = service->showMovieShowTimes(movieId);
+    ASSERT_EQ(first.size(), 1u);
+    EXPECT_EQ(first[0].startTime(), "18:00");
+
+    auto add = [this, movieId](const std::string& date, const std::string& start, const std::string& end,
+                               int auditorium) {
+        ShowTime slot(0, date, start, end);
+        repo->addShowTime(movieId, slot.startsAt, slot.endsAt, auditorium);
+    };
+
+    try {
+        add("2030-01-01", "19:00", "21:00", 1);
+        FAIL() << "Expected ShowTimeOverlapException";
+    } catch (const ShowTimeOverlapException& e) {
+        EXPECT_EQ(e.auditoriumID(), 1);
+        EXPECT_EQ(e.showTimes(), std::vector<int>{first[0].showTimeID});
+    }
+    EXPECT_THROW(add("2030-01-01", "17:59:30", "18:00:30", 1), ShowTimeOverlapException) << "Seconds count";
+    EXPECT_THROW(add("2030-01-01", "18:30", "19:00", 1), ShowTimeOverlapException);
+    EXPECT_EQ(service->showMovieShowTimes(movieId).size(), 1u) << "Rejected showtimes are not written";
+
+    add("2030-01-01", "20:00", "22:00", 1);   // starts when the first one ends
+    add("2030-01-01", "17:00", "18:00", 1);   // ends when it starts
+    add("2030-01-01", "19:00", "21:00", 2);   // another auditorium
+    EXPECT_EQ(service->showMovieShowTimes(movieId).size(), 4u);
+    EXPECT_THROW(add("2030-13-01", "10:00", "11:00", 1), std::invalid_argument);
+    EXPECT_THROW(add("2030-01-02", "11:00", "11:00", 1), std::invalid_argument) << "An earlier end is the next day";
+
+    auto playing = service->showShowTimesBetween("2030-01-01", "18:30", "19:00");
+    ASSERT_EQ(playing.size(), 1u);
+    EXPECT_EQ(playing[0].showTime.showTimeID, first[0].showTimeID);
+    EXPECT_EQ(playing[0].movieTitle, "Overlap Probe");
+    EXPECT_EQ(playing[0].auditoriumID, 1);
+
+    playing = service->showShowTimesBetween("2030-01-01", "20:00", "20:30");
+    ASSERT_EQ(playing.size(), 2u);
+    EXPECT_EQ(playing[0].showTime.startTime(), "19:00");
+    EXPECT_EQ(playing[0].auditoriumID, 2);
+    EXPECT_EQ(playing[1].showTime.startTime(), "20:00");
+    EXPECT_EQ(playing[1].auditoriumID, 1);
+
+    EXPECT_EQ(service->showShowTimesBetween("2030-01-01", "00:00", "23:59").size(), 4u);
+    EXPECT_THROW(service->showShowTimesBetween("2030-01-01", "21:00", "20:00"), std::invalid_argument);
+
+    // Showtimes that existed before the index was created are indexed as well
+    playing = service->showShowTimesBetween("2025-05-10", "19:00", "19:30");
+    ASSERT_EQ(playing.size(), 1u);
+    EXPECT_EQ(playing[0].movieTitle, "Avengers");
+
+    manager.deleteMovie(movieId);
+    EXPECT_TRUE(service->showShowTimesBetween("2030-01-01", "00:00", "23:59").empty());
+}
+
+// Test Case 2.12: Showtimes are stored as epoch seconds and only parsed and formatted at the edges
+TEST_F(MovieViewerServiceDBTest, ShowTimeParsesAndFormatsEpochSeconds) {
+    EXPECT_EQ(ShowTime::toEpoch("1970-01-01", "00:00"), std::optional<std::int64_t>(0));
+    EXPECT_EQ(ShowTime::toEpoch("2025-05-10", "18:00"), std::optional<std::int64_t>(1746900000));
+    EXPECT_EQ(ShowTime::toEpoch("2024-02-29", "23:59:59"), std::optional<std::int64_t>(1709251199));
+    EXPECT_EQ(ShowTime::toEpoch("1969-12-31", "23:00"), std::optional<std::int64_t>(-3600));
+
+    // Well formed but not real, or not the expected shape
+    for (const char* date : {"2030-02-29", "2030-02-30", "2030-04-31", "2030-00-10", "2030-13-01",
+                             "2030-1-01", "2030/01/01", "20300101", "2030-01-01 ", "2030-01-0x", ""}) {
+        EXPECT_FALSE(ShowTime::parseDate(date).has_value()) << date;
+    }
+    for (const char* time : {"24:00", "12:60", "12:00:60", "9:00", "12:0", "12-00", "12:00:", "1200", "-1:00", ""}) {
+        EXPECT_FALSE(ShowTime::parseTimeOfDay(time).has_value()) << time;
+    }
+    EXPECT_TRUE(ShowTime::parseDate("2000-02-29").has_value()) << "Divisible by 400 is a leap year";
+    EXPECT_FALSE(ShowTime::parseDate("1900-02-29").has_value()) << "Divisible by 100 is not";
+
+    ShowTime matinee(7, "2025-12-31", "09:05", "23:59:30");
+    EXPECT_EQ(matinee.date(), "2025-12-31");
+    EXPECT_EQ(matinee.startTime(), "09:05");
+    EXPECT_EQ(matinee.endTime(), "23:59:30");
+    EXPECT_EQ(matinee.endsAt - matinee.startsAt, 14 * 3600 + 54 * 60 + 30);
+    EXPECT_EQ(ShowTime::formatDate(-1), "1969-12-31");
+    EXPECT_EQ(ShowTime::formatTime(-1), "23:59:59");
+    EXPECT_THROW(ShowTime(1, "2025-12-32", "09:00", "10:00"), std::invalid_argument);
+
+    // The repository reads back exactly what was written, in start order
+    MovieManagerService manager(repo);
+    manager.addMovie(std::make_shared<Movie>("Epoch Probe", "Drama", "Scheduling", 7.0f),
+                     {"2031-03-02,09:00,11:00", "2031-03-01,21:30:15,23:45", "2031-03-01,12:00,14:00,2"});
+    int movieId = service->showAllMovies().back().id;
+    auto showTimes = service->showMovieShowTimes(movieId);
+    ASSERT_EQ(showTimes.size(), 3u);
+    EXPECT_EQ(showTimes[0].date() + " " + showTimes[0].startTime(), "2031-03-01 12:00");
+    EXPECT_EQ(showTimes[1].date() + " " + showTimes[1].startTime(), "2031-03-01 21:30:15");
+    EXPECT_EQ(showTimes[1].endTime(), "23:45");
+    EXPECT_EQ(showTimes[2].date() + " " + showTimes[2].startTime(), "2031-03-02 09:00");
+
+    manager.deleteMovie(movieId);
+}
+
+// Test Case 2.13: A movie and its whole schedule are written in one transaction, or not at all
+TEST_F(MovieViewerServiceDBTest, BatchedShowTimesAreAllOrNothing) {
+    auto cached = std::make_shared<CachedMovieRepository>(repo);
+    MovieManagerService manager(cached);
+    MovieViewerService viewer(cached);
+    const std::size_t moviesBefore = viewer.showAllMovies().size();
+    const std::int64_t day = 24 * 3600;
+    const std::int64_t firstEvening = *ShowTime::toEpoch("2032-01-01", "19:00");
+
+    // A season: one evening showtime a day, alternating between two auditoriums
+    std::vector<ShowTimeSpec> season;
+    for (int i = 0; i < 365; ++i) {
+        season.emplace_back(firstEvening + i * day, firstEvening + i * day + 2 * 3600, 3 + i % 2);
+    }
+    int movieId = cached->addMovie(std::make_shared<Movie>("Season Probe", "Drama", "Every night", 7.0f), season);
+    EXPECT_EQ(viewer.showAllMovies().size(), moviesBefore + 1) << "The cached list sees the new movie";
+    EXPECT_EQ(viewer.showMovieShowTimes(movieId).size(), 365u);
+
+    // Overlapping inside the batch: the second entry is checked against the first
+    std::vector<ShowTimeSpec> clash{
+        {firstEvening - day, firstEvening - day + 3600, 3},
+        {firstEvening - day + 1800, firstEvening - day + 5400, 3}
+    };
+    EXPECT_THROW(cached->addShowTimes(movieId, clash), ShowTimeOverlapException);
+    // A bad entry at the end is caught before anything is written
+    std::vector<ShowTimeSpec> backwards{
+        {firstEvening - day, firstEvening - day + 3600, 5},
+        {firstEvening - day + 7200, firstEvening - day + 3600, 5}
+    };
+    EXPECT_THROW(cached->addShowTimes(movieId, backwards), std::invalid_argument);
+    EXPECT_EQ(viewer.showMovieShowTimes(movieId).size(), 365u) << "Failed batches write nothing";
+
+    clash.pop_back();
+    cached->addShowTimes(movieId, clash);
+    EXPECT_EQ(viewer.showMovieShowTimes(movieId).size(), 366u) << "The cache follows a batch insert";
+
+    // The movie is rolled back with its showtimes, whatever fails
+    EXPECT_THROW(manager.addMovie(std::make_shared<Movie>("Atomic Probe", "Drama", "", 5.0f),
+                                  {"2032-06-01,10:00,12:00,6", "2032-01-01,20:00,21:00,3"}),
+                 ShowTimeOverlapException);
+    EXPECT_THROW(manager.addMovie(std::make_shared<Movie>("Atomic Probe", "Drama", "", 5.0f),
+                                  {"2032-06-01,10:00,12:00,6", "2032-06-01,13:00"}),
+                 std::invalid_argument);
+    EXPECT_THROW(manager.addMovie(std::make_shared<Movie>("Atomic Probe", "Drama", "", 5.0f),
+                                  {"2032-06-01,10:00,12:00,B"}),
+                 std::invalid_argument);
+    EXPECT_EQ(viewer.showAllMovies().size(), moviesBefore + 1);
+    EXPECT_TRUE(viewer.searchMovies("atomic probe", 10).empty());
+
+    manager.deleteMovie(movieId);
+    EXPECT_EQ(viewer.showAllMovies().size(), moviesBefore);
+}
+
+// Test Case 2.14: A query that fails is an error, not an empty result the cache could keep
+TEST_F(MovieViewerServiceDBTest, FailedReadsAreNotEmptyResults) {
+    const std::string path = "no_tables.db";
+    std::filesystem::remove(path);
+    {
+        auto broken = std::make_shared<MovieRepositorySQL>(path);
+        auto cached = std::make_shared<CachedMovieRepository>(broken);
+
+        EXPECT_THROW(broken->getMoviesPage(0, 10), std::runtime_error);
+        EXPECT_THROW(cached->getMoviesPage(0, 10), std::runtime_error);
+        EXPECT_THROW(cached->getMoviesPage(0, 10), std::runtime_error) << "The failure must not be cached";
+    }
+    std::filesystem::remove(path);
+
+    const std::string unmigratedPath = "unmigrated.db";
+    std::filesystem::remove(unmigratedPath);
+    {
+        DatabaseConnection db;
+        ASSERT_TRUE(db.connect(unmigratedPath));
+        ASSERT_TRUE(db.executeSQLFile("database.sql"));
+    }
+    {
+        auto unmigrated = std::make_shared<MovieRepositorySQL>(unmigratedPath);
+        auto cached = std::make_shared<CachedMovieRepository>(unmigrated);
+
+        EXPECT_EQ(unmigrated->getMoviesPage(0, 10).size(), 2u) << "MOVIE itself is there";
+        EXPECT_THROW(unmigrated->searchMovies("avengers", 10), std::runtime_error);
+        EXPECT_THROW(cached->searchMovies("avengers", 10), std::runtime_error);
+        EXPECT_THROW(cached->searchMovies("avengers", 10), std::runtime_error) << "The failure must not be cached";
+        EXPECT_THROW(unmigrated->getShowTimesBetween(*ShowTime::toEpoch("2025-05-10", "00:00"),
+                                                     *ShowTime::toEpoch("2025-05-11", "00:00")),
+                     std::runtime_error);
+    }
+    std::filesystem::remove(unmigratedPath);
+}
+
 int main(int argc, char **argv) {
     // Reset database
     
-    auto db = DatabaseConnection::getInstance();
+    DatabaseConnection db;
 
     const std::string dbPath = "database.db";
     
@@ -160,12 +738,14 @@ int main(int argc, char **argv) {
         std::filesystem::remove(dbPath);
     }
 
-    if (!db->connect(dbPath)) {
+    if (!db.connect(dbPath)) {
         std::cerr << "Failed to connect to database" << std::endl;
         return 1;
     }   
 
-    db->executeSQLFile("database.sql");
+    db.executeSQLFile("database.sql");
+    // Full-text and showtime interval indexes
+    SchemaMigrator(&db).migrate();
 
     // Initialize Google Test
 
@@ -0,0 +1,282 @@
+/*
+* TEST PLAN FOR SCHEMAMIGRATOR
+* ----------------------------
+*
+* 1. PURPOSE:
+*    - Verify that a database created from database.sql is upgraded in place to the latest schema version.
+*    - Ensure that the hot-path queries are answered through the new indexes.
+*    - Verify that a failing migration leaves the database at the last good version.
+*
+* 2. TEST CASES:
+*    2.1. FreshDatabaseStartsAtVersionZero:
+*         - Description: Read the version of a database created from the SQL file.
+*         - Expected output: Current version is 0, latest version is 6.
+*
+*    2.2. MigrateAppliesPendingMigrations:
+*         - Description: Run migrate() twice.
+*         - Expected output: The first run applies 6 migrations and creates the indexes, the movie
+*           full-text table, the showtime interval index and their triggers, and converts the showtime
+*           TEXT columns to epoch seconds; the second run applies none.
+*
+*    2.3. HotQueriesUseIndexes:
+*         - Description: Inspect EXPLAIN QUERY PLAN for the login, booking history, showtime and schedule queries.
+*         - Expected output: Each plan searches one of the new indexes instead of scanning the table.
+*
+*    2.4. DuplicateUserNameIsRejected:
+*         - Description: Register an account with a user name that already exists.
+*         - Expected output: The repository throws and RegisterService reports failure.
+*
+*    2.5. FailedMigrationRollsBack:
+*         - Description: Append a migration whose second statement is invalid.
+*         - Expected output: migrate() throws, the version stays 6 and the first statement is rolled back.
+*
+*    2.6. ShowTimePastMidnightDoesNotBlockMigration:
+*         - Description: Migrate a v4 database holding a 22:00-00:30 showtime and one with unparsable times.
+*         - Expected output: migrate() reaches 6; the late show ends at 00:30 the next day and is in
+*           SHOWTIME_RTREE; the unparsable one is kept but not indexed; inserting a row whose end is
+*           before its start afterwards is accepted without an R*Tree constraint error.
+*
+*    2.7. DuplicateUserNamesDoNotBlockMigration:
+*         - Description: Migrate a v2 database in which three accounts share one user name.
+*         - Expected output: migrate() reaches 6; the oldest account keeps the name, the others are
+*           renamed to "name#UserID" and can still log in under that name.
+*
+* 3. TEST ENVIRONMENT SETUP:
+*    - Each test run, the database will be recreated from the SQL file.
+*    - Test cases run in order and build on each other.
+*
+* 4. ASSUMPTIONS:
+*    - The database.sql file contains the necessary sample data for the test cases.
+*/
+
+#include <gtest/gtest.h>
+#include "../database/SchemaMigrator.h"
+#include "../database/DatabaseConnection.h"
+#include "../database/ConnectionPool.h"
+#include "../repository/AuthenticationRepositorySQL.h"
+#include "../service/RegisterService.h"
+#include <string>
+#include <iostream>
+#include <filesystem>
+#include <memory>
+
+// Connection to database.db, opened in main()
+DatabaseConnection* connection = nullptr;
+
+class SchemaMigratorTest : public ::testing::Test {
+protected:
+    DatabaseConnection* db;
+
+    void SetUp() override {
+        db = connection;
+    }
+
+    // Concatenated "detail" column of EXPLAIN QUERY PLAN
+    std::string queryPlan(const std::string& sql, const std::vector<std::string>& params) {
+        std::string plan;
+        db->forEachRow("EXPLAIN QUERY PLAN " + sql, params, [&plan](const ResultRow& row) {
+            plan += row.getString(3) + "\n";
+        });
+        return plan;
+    }
+};
+
+// Test Case 2.1: Test the version of a freshly created database
+TEST_F(SchemaMigratorTest, FreshDatabaseStartsAtVersionZero) {
+    SchemaMigrator migrator(db);
+    EXPECT_EQ(migrator.currentVersion(), 0);
+    EXPECT_EQ(migrator.latestVersion(), 6);
+}
+
+// Test Case 2.2: Test applying the migrations
+TEST_F(SchemaMigratorTest, MigrateAppliesPendingMigrations) {
+    SchemaMigrator migrator(db);
+    EXPECT_EQ(migrator.migrate(), 6);
+    EXPECT_EQ(migrator.currentVersion(), 6);
+
+    auto indexes = db->executeQuery("SELECT name FROM sqlite_master WHERE type = 'index' AND name LIKE 'idx_%' ORDER BY name");
+    std::vector<std::string> names;
+    for (const auto& row : indexes) {
+        names.push_back(row.at("name"));
+    }
+    EXPECT_EQ(names, (std::vector<std::string>{
+        "idx_account_username", "idx_booking_showtime", "idx_booking_user", "idx_bookseat_seat", "idx_showtime_movie_time"
+    }));
+
+    auto triggers = db->executeQuery("SELECT name FROM sqlite_master WHERE type = 'trigger' AND tbl_name = 'MOVIE' ORDER BY name");
+    ASSERT_EQ(triggers.size(), 3u);
+    EXPECT_EQ(triggers[0].at("name"), "movie_fts_delete");
+
+    // Existing movies are indexed by the migration itself
+    auto indexed = db->executeQuery("SELECT rowid FROM MOVIE_FTS WHERE MOVIE_FTS MATCH 'titanic'");
+    ASSERT_EQ(indexed.size(), 1u);
+    EXPECT_EQ(indexed[0].at("rowid"), "2");
+
+    // ...and so are existing showtimes, all in auditorium 1
+    auto showTimes = db->executeQuery("SELECT count(*) AS n FROM SHOWTIME WHERE AuditoriumID = 1");
+    auto boxes = db->executeQuery("SELECT count(*) AS n FROM SHOWTIME_RTREE");
+    EXPECT_EQ(boxes[0].at("n"), showTimes[0].at("n"));
+    EXPECT_NE(showTimes[0].at("n"), "0");
+
+    // Showtimes are epoch seconds now: 2025-05-10 18:00 - 20:30, and the TEXT columns are gone
+    auto converted = db->executeQuery("SELECT StartsAt, EndsAt, typeof(StartsAt) AS type FROM SHOWTIME WHERE ShowTimeID = 1");
+    ASSERT_EQ(converted.size(), 1u);
+    EXPECT_EQ(converted[0].at("StartsAt"), "1746900000");
+    EXPECT_EQ(converted[0].at("EndsAt"), "1746909000");
+    EXPECT_EQ(converted[0].at("type"), "integer");
+    EXPECT_TRUE(db->executeQuery("SELECT name FROM pragma_table_info('SHOWTIME') "
+                                 "WHERE name IN ('Date', 'StartTime', 'EndTime')").empty());
+
+    EXPECT_EQ(migrator.migrate(), 0) << "An up-to-date database must not be migrated again";
+}
+
+// Test Case 2.3: Test that the hot-path queries no longer scan whole tables
+TEST_F(SchemaMigratorTest, HotQueriesUseIndexes) {
+    std::string login = queryPlan("SELECT * FROM ACCOUNT WHERE UserName = ? AND Password = ?", {"a", "b"});
+    EXPECT_NE(login.find("idx_account_username"), std::string::npos) << login;
+
+    std::string history = queryPlan("SELECT BookingID, ShowTimeID FROM BOOKING WHERE UserID = ?", {"1"});
+    EXPECT_NE(history.find("COVERING INDEX idx_booking_user"), std::string::npos) << history;
+
+    std::string seats = queryPlan("SELECT bs.SeatID FROM BOOKSEAT bs JOIN BOOKING b ON b.BookingID = bs.BookingID "
+                                  "WHERE b.ShowTimeID = ? AND bs.SeatID IN (?, ?)", {"1", "A1", "A2"});
+    EXPECT_EQ(seats.find("SCAN"), std::string::npos) << seats;
+
+    std::string showTimes = queryPlan("SELECT ShowTimeID, StartsAt, EndsAt FROM SHOWTIME "
+                                      "WHERE MovieID = ? AND StartsAt IS NOT NULL ORDER BY StartsAt", {"1"});
+    EXPECT_NE(showTimes.find("COVERING INDEX idx_showtime_movie_time"), std::string::npos) << showTimes;
+    EXPECT_EQ(showTimes.find("TEMP B-TREE"), std::string::npos) << "Already in start order: " << showTimes;
+
+    std::string overlap = queryPlan("SELECT s.ShowTimeID FROM SHOWTIME_RTREE r JOIN SHOWTIME s ON s.ShowTimeID = r.ShowTimeID "
+                                    "WHERE r.MinAuditorium <= 1 AND r.MaxAuditorium >= 1 "
+                                    "AND r.StartMinute < ? AND r.EndMinute > ?", {"100", "50"});
+    EXPECT_NE(overlap.find("VIRTUAL TABLE INDEX"), std::string::npos) << overlap;
+    EXPECT_EQ(overlap.find("SCAN s"), std::string::npos) << overlap;
+}
+
+// Test Case 2.4: Test that user names are unique
+TEST_F(SchemaMigratorTest, DuplicateUserNameIsRejected) {
+    AuthenticationRepositorySQL repo(std::make_shared<ConnectionPool>("database.db", 1));
+    AccountInformation acc;
+    acc.userName = "Nguyen Van A";
+    acc.password = "other";
+    acc.phoneNumber = "0000";
+    acc.gmail = "copy@gmail.com";
+    acc.role = "User";
+
+    EXPECT_THROW(repo.addUser(acc), std::runtime_error);
+
+    RegisterService reg(&repo);
+    EXPECT_FALSE(reg.registerUser(acc));
+}
+
+// Test Case 2.5: Test that a broken migration is rolled back
+TEST_F(SchemaMigratorTest, FailedMigrationRollsBack) {
+    auto migrations = SchemaMigrator::defaultMigrations();
+    migrations.push_back({7, "Broken step", {
+        "CREATE TABLE MIGRATION_PROBE (Id INTEGER)",
+        "CREATE INDEX idx_broken ON NO_SUCH_TABLE(Id)"
+    }});
+    SchemaMigrator migrator(db, migrations);
+
+    EXPECT_THROW(migrator.migrate(), std::runtime_error);
+    EXPECT_EQ(migrator.currentVersion(), 6);
+    EXPECT_TRUE(db->executeQuery("SELECT name FROM sqlite_master WHERE name = 'MIGRATION_PROBE'").empty())
+        << "Statements of the failed migration must be rolled back";
+
+    migrations.erase(migrations.begin());
+    EXPECT_THROW(SchemaMigrator(db, migrations), std::invalid_argument);
+}
+
+// Test Case 2.6: Test that a show ending after midnight migrates instead of failing the R*Tree constraint
+TEST_F(SchemaMigratorTest, ShowTimePastMidnightDoesNotBlockMigration) {
+    const std::string path = "midnight_test.db";
+    std::filesystem::remove(path);
+    DatabaseConnection late;
+    ASSERT_TRUE(late.connect(path));
+    ASSERT_TRUE(late.executeSQLFile("database.sql"));
+
+    auto migrations = SchemaMigrator::defaultMigrations();
+    migrations.resize(4);
+    SchemaMigrator(&late, migrations).migrate();
+    late.executeNonQuery("INSERT INTO SHOWTIME (ShowTimeID, MovieID, Date, StartTime, EndTime) "
+                         "VALUES (100, 1, '2025-05-10', '22:00', '00:30'), (101, 2, 'someday', '20:00', '22:00')");
+
+    SchemaMigrator migrator(&late);
+    EXPECT_EQ(migrator.migrate(), 2);
+    EXPECT_EQ(migrator.currentVersion(), 6);
+
+    // 2025-05-10 22:00 UTC, ending 150 minutes later
+    auto lateShow = late.executeQuery("SELECT StartsAt, EndsAt FROM SHOWTIME WHERE ShowTimeID = 100");
+    ASSERT_EQ(lateShow.size(), 1u);
+    EXPECT_EQ(lateShow[0].at("StartsAt"), "1746914400");
+    EXPECT_EQ(lateShow[0].at("EndsAt"), "1746923400");
+    EXPECT_EQ(late.executeQuery("SELECT StartMinute, EndMinute FROM SHOWTIME_RTREE WHERE ShowTimeID = 100").size(), 1u);
+
+    EXPECT_EQ(late.executeQuery("SELECT ShowTimeID FROM SHOWTIME WHERE ShowTimeID = 101").size(), 1u);
+    EXPECT_TRUE(late.executeQuery("SELECT ShowTimeID FROM SHOWTIME_RTREE WHERE ShowTimeID = 101").empty());
+
+    EXPECT_TRUE(late.executeNonQuery("INSERT INTO SHOWTIME (ShowTimeID, MovieID, StartsAt, EndsAt) "
+                                     "VALUES (102, 1, 1746914400, 1746910800)"));
+    EXPECT_TRUE(late.executeQuery("SELECT ShowTimeID FROM SHOWTIME_RTREE WHERE ShowTimeID = 102").empty());
+
+    late.disconnect();
+    std::filesystem::remove(path);
+}
+
+// Test Case 2.7: Test that user names registered twice before v3 are made unique instead of failing the index
+TEST_F(SchemaMigratorTest, DuplicateUserNamesDoNotBlockMigration) {
+    const std::string path = "duplicate_test.db";
+    std::filesystem::remove(path);
+    DatabaseConnection old;
+    ASSERT_TRUE(old.connect(path));
+    ASSERT_TRUE(old.executeSQLFile("database.sql"));
+
+    auto migrations = SchemaMigrator::defaultMigrations();
+    migrations.resize(2);
+    SchemaMigrator(&old, migrations).migrate();
+    ASSERT_TRUE(old.executeNonQuery("INSERT INTO ACCOUNT (UserID, Password, RoleUser, Gmail, PhoneNumber, UserName) "
+                                    "VALUES (10, 'p10', 'User', 'a@x.com', '0900000010', 'Nguyen Van A'), "
+                                    "(11, 'p11', 'User', 'b@x.com', '0900000011', 'Nguyen Van A')"));
+
+    SchemaMigrator migrator(&old);
+    EXPECT_EQ(migrator.migrate(), 4);
+    EXPECT_EQ(migrator.currentVersion(), 6);
+
+    auto accounts = old.executeQuery("SELECT UserID, UserName FROM ACCOUNT WHERE UserName LIKE 'Nguyen Van A%' ORDER BY UserID");
+    ASSERT_EQ(accounts.size(), 3u);
+    EXPECT_EQ(accounts[0].at("UserName"), "Nguyen Van A") << "The oldest account keeps its name";
+    EXPECT_EQ(accounts[1].at("UserName"), "Nguyen Van A#10");
+    EXPECT_EQ(accounts[2].at("UserName"), "Nguyen Van A#11");
+    EXPECT_EQ(old.executeQuery("SELECT UserID FROM ACCOUNT WHERE UserName = ? AND Password = ?",
+                               {"Nguyen Van A#11", "p11"}).size(), 1u);
+
+    old.disconnect();
+    std::filesystem::remove(path);
+}
+
+int main(int argc, char** argv) {
+    DatabaseConnection db;
+    connection = &db;
+
+    const std::string dbPath = "database.db";
+
+    // Remove the existing database file if it exists
+    if (std::filesystem::exists(dbPath)) {
+        std::cout << "Removing existing database file..." << std::endl;
+        std::filesystem::remove(dbPath);
+    }
+
+    if (!db.connect(dbPath)) {
+        std::cerr << "Failed to connect to database" << std::endl;
+        return 1;
+    }
+
+    db.executeSQLFile("database.sql");
+
+    ::testing::InitGoogleTest(&argc, argv);
+    int result = RUN_ALL_TESTS();
+
+    db.disconnect();
+    return result;
+}
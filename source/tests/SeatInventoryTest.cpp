@@ -0,0 +1,246 @@
+/*
+* TEST PLAN FOR SEATINVENTORY
+* ---------------------------
+*
+* 1. PURPOSE:
+*    - Verify that the seat catalog and the in-memory seat inventory mirror the SEAT, BOOKING and BOOKSEAT tables.
+*    - Ensure that booked-seat bitsets are updated correctly and work across 64-bit word boundaries.
+*    - Verify that seat holds block other customers and expire on the timer wheel.
+*
+* 2. TEST CASES:
+*    2.1. LoadsSeatsAndBookings:
+*         - Description: Load the inventory from the sample data.
+*         - Expected output: 6 seats in SeatID order, A1/A2 booked for showtime 1, B1 booked for showtime 2,
+*           every seat available for an unknown showtime.
+*
+*    2.2. MarkBookedUpdatesStatus:
+*         - Description: Mark B2 booked for showtime 1 together with an unknown seat.
+*         - Expected output: B2 reads as booked, the unknown seat is ignored, the booked count is 3.
+*
+*    2.3. BitsetSpansSeveralWords:
+*         - Description: Add 70 seats so the bitset needs two words, then book a seat in the second word.
+*         - Expected output: Only that seat reads as booked and the seat map keeps SeatID order.
+*
+*    2.4. CatalogSharesSeatObjects:
+*         - Description: Build two seat maps and compare their seat pointers; add a seat without a price.
+*         - Expected output: Both maps point at the same catalog entries, the new seat takes its SEATTYPE price.
+*
+*    2.5. HoldsBlockOtherHolders:
+*         - Description: Hold seats for two users on the same and on different showtimes, then release them.
+*         - Expected output: A held seat is refused to the other user, reads as HELD in the seat map and is
+*           freed by release() and releaseAll().
+*
+*    2.6. HoldsExpireOnTimerWheel:
+*         - Description: Drive a 3-tick TTL with a fake clock, renew a hold, then let the clock jump an hour.
+*         - Expected output: Holds live exactly 3 ticks after their last renewal and all are gone after the jump.
+*
+* 3. TEST ENVIRONMENT SETUP:
+*    - Each test run, the database will be recreated from the SQL file.
+*    - Each test loads a fresh catalog and inventory.
+*
+* 4. ASSUMPTIONS:
+*    - The database.sql file contains the necessary sample data for the test cases.
+*/
+
+#include <gtest/gtest.h>
+#include "../repository/SeatCatalog.h"
+#include "../repository/SeatInventory.h"
+#include "../repository/SeatHoldManager.h"
+#include "../database/DatabaseConnection.h"
+#include <string>
+#include <iostream>
+#include <filesystem>
+#include <memory>
+#include <chrono>
+
+// Connection to database.db, opened in main()
+DatabaseConnection* connection = nullptr;
+
+class SeatInventoryTest : public ::testing::Test {
+protected:
+    DatabaseConnection* db;
+    std::shared_ptr<const SeatCatalog> catalog;
+    std::unique_ptr<SeatInventory> inventory;
+
+    void SetUp() override {
+        db = connection;
+        reload();
+    }
+
+    void reload() {
+        catalog = SeatCatalog::load(db);
+        inventory = std::make_unique<SeatInventory>(catalog);
+        inventory->load(db);
+    }
+};
+
+// Test Case 2.1: Test warming the inventory from the database
+TEST_F(SeatInventoryTest, LoadsSeatsAndBookings) {
+    EXPECT_EQ(catalog->size(), 6);
+    EXPECT_NE(catalog->find("B3"), nullptr);
+    EXPECT_EQ(catalog->find("Z9"), nullptr);
+    EXPECT_EQ(catalog->indexOf("Z9"), SeatCatalog::npos);
+
+    auto seats = inventory->seatsStatus(1);
+    ASSERT_EQ(seats.size(), 6);
+    EXPECT_EQ(seats[0].seat->id(), "A1");
+    EXPECT_EQ(seats[0].status, BOOKED);
+    EXPECT_EQ(seats[1].status, BOOKED);
+    EXPECT_EQ(seats[2].status, AVAILABLE);
+    EXPECT_EQ(seats[3].seat->id(), "B1");
+    EXPECT_EQ(seats[3].seat->type(), COUPLE);
+
+    EXPECT_EQ(inventory->bookedCount(1), 2);
+    EXPECT_EQ(inventory->bookedCount(2), 1);
+    EXPECT_TRUE(inventory->isBooked(2, "B1"));
+    EXPECT_FALSE(inventory->isBooked(2, "A1"));
+
+    EXPECT_EQ(inventory->bookedCount(99), 0) << "A showtime without bookings has no bits set";
+    for (const auto& seat : inventory->seatsStatus(99)) {
+        EXPECT_EQ(seat.status, AVAILABLE);
+    }
+}
+
+// Test Case 2.2: Test recording a committed booking
+TEST_F(SeatInventoryTest, MarkBookedUpdatesStatus) {
+    inventory->markBooked(1, {"B2", "Z9"});
+
+    EXPECT_TRUE(inventory->isBooked(1, "B2"));
+    EXPECT_FALSE(inventory->isBooked(2, "B2")) << "Other showtimes are not affected";
+    EXPECT_EQ(inventory->bookedCount(1), 3);
+    EXPECT_EQ(inventory->bookedAmong(1, {"A3", "B2", "A1"}), (std::vector<std::string>{"B2", "A1"}));
+}
+
+// Test Case 2.3: Test a theater larger than one 64-bit word
+TEST_F(SeatInventoryTest, BitsetSpansSeveralWords) {
+    for (int i = 10; i < 80; ++i) {
+        ASSERT_TRUE(db->executeNonQuery("INSERT INTO SEAT VALUES (?, 'Single', 50.0)", {"C" + std::to_string(i)}));
+    }
+    reload();
+    ASSERT_EQ(catalog->size(), 76);
+
+    // SeatID order: A1..A3, B1..B3, C10..C79, so C70 is seat 66 (second word)
+    inventory->markBooked(5, {"C70"});
+    auto seats = inventory->seatsStatus(5);
+    ASSERT_EQ(seats.size(), 76);
+    for (std::size_t i = 0; i < seats.size(); ++i) {
+        EXPECT_EQ(seats[i].status == BOOKED, seats[i].seat->id() == "C70") << "Seat " << seats[i].seat->id();
+    }
+    EXPECT_EQ(seats[66].seat->id(), "C70");
+    EXPECT_EQ(inventory->bookedCount(5), 1);
+
+    ASSERT_TRUE(db->executeNonQuery("DELETE FROM SEAT WHERE SeatID LIKE 'C%'"));
+}
+
+// Test Case 2.4: Test that seat views share the catalog's seat objects
+TEST_F(SeatInventoryTest, CatalogSharesSeatObjects) {
+    auto first = inventory->seatsStatus(1);
+    auto second = inventory->seatsStatus(2);
+    ASSERT_EQ(first.size(), second.size());
+    for (std::size_t i = 0; i < first.size(); ++i) {
+        EXPECT_EQ(first[i].seat, second[i].seat) << "Seat maps must not allocate their own seats";
+        EXPECT_EQ(first[i].seat, catalog->at(i));
+    }
+    EXPECT_EQ(catalog->find("A1"), first[0].seat);
+
+    // A seat without its own price falls back to the price of its type
+    ASSERT_TRUE(db->executeNonQuery("INSERT INTO SEAT (SeatID, SeatType) VALUES ('D1', 'Couple')"));
+    reload();
+    const ISeat* seat = catalog->find("D1");
+    ASSERT_NE(seat, nullptr);
+    EXPECT_EQ(seat->type(), COUPLE);
+    EXPECT_FLOAT_EQ(seat->price(), 90.0f);
+
+    ASSERT_TRUE(db->executeNonQuery("DELETE FROM SEAT WHERE SeatID = 'D1'"));
+}
+
+// Test Case 2.5: Test that a hold belongs to one user
+TEST_F(SeatInventoryTest, HoldsBlockOtherHolders) {
+    SeatHoldManager holds(catalog);
+
+    EXPECT_TRUE(holds.hold(1, "A3", 10));
+    EXPECT_TRUE(holds.hold(1, "A3", 10)) << "Holding again renews the hold";
+    EXPECT_FALSE(holds.hold(1, "A3", 20)) << "Another user cannot take a held seat";
+    EXPECT_TRUE(holds.hold(2, "A3", 20)) << "Holds are per showtime";
+    EXPECT_FALSE(holds.hold(1, "Z9", 10)) << "Unknown seats cannot be held";
+    EXPECT_TRUE(holds.hold(1, "B2", 10));
+    EXPECT_EQ(holds.size(), 3);
+
+    EXPECT_EQ(holds.heldByOthers(1, {"A1", "A3", "B2"}, 20), (std::vector<std::string>{"A3", "B2"}));
+    EXPECT_TRUE(holds.heldByOthers(1, {"A3", "B2"}, 10).empty()) << "A user's own holds do not block them";
+
+    // Booked seats stay BOOKED, free held seats become HELD
+    auto seats = inventory->seatsStatus(1);
+    holds.markHeld(1, seats);
+    EXPECT_EQ(seats[0].status, BOOKED);
+    EXPECT_EQ(seats[2].status, HELD);
+    EXPECT_EQ(seats[4].status, HELD);
+    EXPECT_EQ(seats[5].status, AVAILABLE);
+
+    EXPECT_FALSE(holds.release(1, "A3", 20)) << "Only the holder can release a hold";
+    EXPECT_TRUE(holds.release(1, "A3", 10));
+    EXPECT_TRUE(holds.hold(1, "A3", 20));
+
+    EXPECT_EQ(holds.releaseAll(20), 2);
+    EXPECT_EQ(holds.size(), 1);
+    EXPECT_EQ(holds.heldByOthers(2, {"A3"}, 10), (std::vector<std::string>{}));
+}
+
+// Test Case 2.6: Test expiry driven by the timer wheel
+TEST_F(SeatInventoryTest, HoldsExpireOnTimerWheel) {
+    using namespace std::chrono_literals;
+    SeatHoldManager::Clock::time_point now{};
+    SeatHoldManager holds(catalog, 3s, 1s, [&now] { return now; });
+
+    ASSERT_TRUE(holds.hold(1, "A3", 10));
+    ASSERT_TRUE(holds.hold(1, "B1", 10));
+    now += 2s;
+    EXPECT_EQ(holds.size(), 2);
+    ASSERT_TRUE(holds.hold(1, "A3", 10)) << "Renew A3 at tick 2, it now expires at tick 5";
+
+    now += 1s;
+    EXPECT_EQ(holds.size(), 1) << "B1 expires at tick 3, the stale A3 entry must be skipped";
+    EXPECT_TRUE(holds.hold(1, "B1", 20)) << "An expired hold frees the seat for everybody";
+
+    now += 1500ms;
+    EXPECT_EQ(holds.heldByOthers(1, {"A3"}, 20), (std::vector<std::string>{"A3"})) << "Tick 4: A3 is still held";
+    now += 500ms;
+    EXPECT_TRUE(holds.heldByOthers(1, {"A3"}, 20).empty()) << "Tick 5: A3 has expired";
+
+    // An idle hour later every slot is visited once and nothing survives
+    for (const char* seat : {"A1", "A2", "B2", "B3"}) {
+        ASSERT_TRUE(holds.hold(3, seat, 30));
+    }
+    now += 1h;
+    EXPECT_EQ(holds.size(), 0);
+    EXPECT_TRUE(holds.hold(3, "A1", 40));
+    EXPECT_EQ(holds.size(), 1);
+
+    EXPECT_THROW(SeatHoldManager(catalog, 0s), std::invalid_argument);
+}
+
+int main(int argc, char** argv) {
+    DatabaseConnection db;
+    connection = &db;
+
+    const std::string dbPath = "database.db";
+
+    // Remove the existing database file if it exists
+    if (std::filesystem::exists(dbPath)) {
+        std::cout << "Removing existing database file..." << std::endl;
+        std::filesystem::remove(dbPath);
+    }
+
+    if (!db.connect(dbPath)) {
+        std::cerr << "Failed to connect to database" << std::endl;
+        return 1;
+    }
+
+    db.executeSQLFile("database.sql");
+
+    ::testing::InitGoogleTest(&argc, argv);
+    int result = RUN_ALL_TESTS();
+
+    db.disconnect();
+    return result;
+}
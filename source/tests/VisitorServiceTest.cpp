@@ -68,6 +68,26 @@
 *           + Proper role-based access control
 *         - Validates: Administrative operations via visitor pattern
 *
+*    3.7. ServiceBootstrapRegistersServices:
+*         - Description: ServiceBootstrap builds the same wiring as the test fixture
+*         - Input: Fresh database file and database.sql
+*         - Expected Behavior:
+*           + Schema is created and migrated on the new file
+*           + Visitors find every registered service for an Admin context
+*           + Registered services read from the bootstrapped database
+*         - Validates: Wiring shared by App and BookingServer
+*
+*    3.8. ServiceRegistryFreezesAfterBootstrap:
+*         - Description: ServiceBootstrap ends the registry's registration phase
+*         - Input: Registry filled by the fixture, then ServiceBootstrap::initialize and 8 threads
+*           looking services up concurrently
+*         - Expected Behavior:
+*           + The fixture's registry is open; after bootstrap it is frozen
+*           + Registering into a frozen registry throws std::logic_error and changes nothing
+*           + Every concurrent lookup returns the bootstrapped instance
+*           + reset() empties the registry and reopens registration
+*         - Validates: Compile-time keyed, lock-free read phase of ServiceRegistry
+*
 * 4. VISITOR PATTERN TESTING:
 *    - Visitor interface implementation validation
 *    - Service delegation through visitor pattern
@@ -135,6 +155,11 @@
 */
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <cstdio>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 #include "../visitor/LoginServiceVisitor.h"
 #include "../visitor/RegisterServiceVisitor.h"
 #include "../visitor/BookingServiceVisitor.h"
@@ -144,11 +169,12 @@
 #include "../model/Guest.h"
 #include "../model/User.h"
 #include "../model/Admin.h"
-#include "../database/DatabaseConnection.h"
+#include "../database/ConnectionPool.h"
 #include "../repository/AuthenticationRepositorySQL.h"
 #include "../repository/BookingRepositorySQL.h"
 #include "../repository/MovieRepositorySQL.h"
 #include "../core/ServiceRegistry.h"
+#include "../core/ServiceBootstrap.h"
 #include "../service/LoginService.h"
 #include "../service/RegisterService.h"
 #include "../service/BookingService.h"
@@ -163,15 +189,14 @@
 class VisitorServiceTest : public ::testing::Test {
 protected:    
 void SetUp() override {
-        // Initialize database connection
-        db = DatabaseConnection::getInstance();
-        db->connect("database.db");        // Create repositories
-        authRepo = new AuthenticationRepositorySQL(db);
-        std::string dbPath = "database.db";
-        auto bookingRepo = std::make_shared<BookingRepository>(dbPath);
-        auto movieRepo = std::make_shared<MovieRepositorySQL>(dbPath);
+        // Initialize database connections
+        pool = std::make_shared<ConnectionPool>("database.db");        // Create repositories
+        authRepo = new AuthenticationRepositorySQL(pool);
+        auto bookingRepo = std::make_shared<BookingRepository>(pool);
+        auto movieRepo = std::make_shared<MovieRepositorySQL>(pool);
         
-        // Register all services in the registry with their repositories
+        // Register all services in the registry with their repositories (a bootstrap may have frozen it)
+        ServiceRegistry::reset();
         ServiceRegistry::addSingleton<ILoginService>(std::make_shared<LoginService>(authRepo));
         ServiceRegistry::addSingleton<IRegisterService>(std::make_shared<RegisterService>(authRepo));
         ServiceRegistry::addSingleton<IBookingService>(std::make_shared<BookingService>(bookingRepo));
@@ -203,10 +228,10 @@ void SetUp() override {
     
     void TearDown() override {
         delete authRepo;
-        db->disconnect();
+        pool.reset();
     }
     
-    DatabaseConnection* db;
+    std::shared_ptr<ConnectionPool> pool;
     AuthenticationRepositorySQL* authRepo;
     std::shared_ptr<Guest> guestContext;
     std::shared_ptr<User> userContext;
@@ -340,6 +365,74 @@ TEST_F(VisitorServiceTest, UserInfoServiceAvailability) {
     EXPECT_NE(adminContext->getUserInformationService(), nullptr);
 }
 
+// Test: ServiceBootstrap creates the schema and registers every service
+TEST_F(VisitorServiceTest, ServiceBootstrapRegistersServices) {
+    std::remove("bootstrap_test.db");
+    std::remove("bootstrap_test.db-wal");
+    std::remove("bootstrap_test.db-shm");
+
+    auto services = ServiceBootstrap::initialize("bootstrap_test.db", "database.sql", ConnectionProfile::kiosk(), 1);
+    ASSERT_NE(services.connectionPool, nullptr);
+    ASSERT_NE(services.bookingRepository, nullptr);
+
+    auto movieViewerVisitor = std::make_shared<MovieViewerServiceVisitor>();
+    adminContext->accept(movieViewerVisitor);
+    auto movieViewerService = movieViewerVisitor->getMovieViewerService();
+    ASSERT_NE(movieViewerService, nullptr);
+    EXPECT_EQ(movieViewerService->showAllMovies().size(), services.movieRepository->getAllMovies().size());
+
+    auto bookingVisitor = std::make_shared<BookingServiceVisitor>();
+    adminContext->accept(bookingVisitor);
+    EXPECT_NE(bookingVisitor->getBookingService(), nullptr);
+
+    auto movieManagerVisitor = std::make_shared<MovieManagerServiceVisitor>();
+    adminContext->accept(movieManagerVisitor);
+    EXPECT_NE(movieManagerVisitor->getMovieManagerService(), nullptr);
+
+    // A second start on the same file finds the tables and only runs pending migrations
+    EXPECT_NO_THROW(ServiceBootstrap::initialize("bootstrap_test.db", "missing.sql", ConnectionProfile::kiosk(), 1));
+}
+
+// Test: After ServiceBootstrap the registry is read-only and safe to share between threads
+TEST_F(VisitorServiceTest, ServiceRegistryFreezesAfterBootstrap) {
+    EXPECT_FALSE(ServiceRegistry::isFrozen());
+    ASSERT_NE(ServiceRegistry::getSingleton<IBookingService>(), nullptr);
+
+    auto services = ServiceBootstrap::initialize("bootstrap_test.db", "database.sql", ConnectionProfile::kiosk(), 1);
+    EXPECT_TRUE(ServiceRegistry::isFrozen());
+    auto bookingService = ServiceRegistry::getSingleton<IBookingService>();
+    ASSERT_NE(bookingService, nullptr);
+
+    EXPECT_THROW(ServiceRegistry::addSingleton<IBookingService>(
+                     std::make_shared<BookingService>(services.bookingRepository)), std::logic_error);
+    EXPECT_EQ(ServiceRegistry::getSingleton<IBookingService>(), bookingService);
+
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 8; ++t) {
+        readers.emplace_back([&]() {
+            for (int i = 0; i < 10000; ++i) {
+                auto visitor = std::make_shared<BookingServiceVisitor>();
+                adminContext->accept(visitor);
+                if (visitor->getBookingService() != bookingService.get() ||
+                    ServiceRegistry::get<IMovieViewerService>() == nullptr) {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(mismatches.load(), 0);
+
+    ServiceRegistry::reset();
+    EXPECT_FALSE(ServiceRegistry::isFrozen());
+    EXPECT_EQ(ServiceRegistry::getSingleton<IBookingService>(), nullptr);
+    ServiceRegistry::addSingleton<IBookingService>(bookingService);
+    EXPECT_EQ(ServiceRegistry::getSingleton<IBookingService>(), bookingService);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
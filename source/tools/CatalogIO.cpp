@@ -0,0 +1,720 @@
+#include "CatalogIO.h"
+#include "../model/Movie.h"
+#include "../model/ShowTime.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+
+namespace {
+
+constexpr std::size_t npos = std::string_view::npos;
+
+// Column names of CatalogRow's fields, in the order of CATALOG_FIELDS
+const std::string_view CATALOG_COLUMNS[] = {
+    "title", "genre", "description", "rating", "date", "start", "end", "auditorium"
+};
+
+std::string_view CatalogRow::* const CATALOG_FIELDS[] = {
+    &CatalogRow::title, &CatalogRow::genre, &CatalogRow::description, &CatalogRow::rating,
+    &CatalogRow::date, &CatalogRow::startTime, &CatalogRow::endTime, &CatalogRow::auditorium
+};
+
+enum CatalogColumn { TITLE, GENRE, DESCRIPTION, RATING, DATE, START, END, AUDITORIUM, COLUMN_COUNT };
+
+std::string_view trim(std::string_view text) {
+    while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && (text.back() == ' ' || text.back() == '\t')) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+        return (x >= 'A' && x <= 'Z' ? x - 'A' + 'a' : x) == y;
+    });
+}
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Four hex digits at text[pos]; -1 if they are not
+long hex4(std::string_view text, std::size_t pos) {
+    if (pos + 4 > text.size()) {
+        return -1;
+    }
+    long value = 0;
+    for (std::size_t i = pos; i < pos + 4; ++i) {
+        int digit = hexValue(text[i]);
+        if (digit < 0) {
+            return -1;
+        }
+        value = value * 16 + digit;
+    }
+    return value;
+}
+
+void appendUtf8(std::string& out, unsigned long codePoint) {
+    if (codePoint < 0x80) {
+        out += static_cast<char>(codePoint);
+    } else if (codePoint < 0x800) {
+        out += static_cast<char>(0xC0 | (codePoint >> 6));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else if (codePoint < 0x10000) {
+        out += static_cast<char>(0xE0 | (codePoint >> 12));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (codePoint >> 18));
+        out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+}
+
+template <typename Number>
+bool parseNumber(std::string_view text, Number& value) {
+    const char* end = text.data() + text.size();
+    auto [stop, error] = std::from_chars(text.data(), end, value);
+    return error == std::errc() && stop == end;
+}
+
+// Every showtime an rtree_i32 box of epoch minutes can hold
+constexpr std::int64_t EARLIEST_EXPORT = static_cast<std::int64_t>(std::numeric_limits<std::int32_t>::min()) * 60;
+constexpr std::int64_t LATEST_EXPORT = static_cast<std::int64_t>(std::numeric_limits<std::int32_t>::max()) * 60;
+constexpr std::size_t EXPORT_PAGE_SIZE = 500;
+
+using ScheduleEntries = std::vector<const ScheduledShowTime*>;
+
+// Calls write(movie, description, showtimes) for every movie, in MovieID order
+template <typename WriteMovie>
+std::size_t forEachCatalogMovie(IMovieRepository& repo, WriteMovie write) {
+    // One window query for the whole schedule (it carries the auditoriums), grouped by movie
+    const std::vector<ScheduledShowTime> schedule = repo.getShowTimesBetween(EARLIEST_EXPORT, LATEST_EXPORT);
+    std::unordered_map<int, ScheduleEntries> byMovie;
+    for (const ScheduledShowTime& entry : schedule) {
+        byMovie[entry.movieID].push_back(&entry);
+    }
+    const ScheduleEntries none;
+
+    std::size_t count = 0;
+    int afterMovieId = 0;
+    while (true) {
+        std::vector<MovieDTO> page = repo.getMoviesPage(afterMovieId, EXPORT_PAGE_SIZE);
+        for (const MovieDTO& movie : page) {
+            std::shared_ptr<IMovie> details = repo.getMovieById(movie.id);
+            auto showTimes = byMovie.find(movie.id);
+            write(movie, details ? details->getDescription() : std::string(),
+                  showTimes == byMovie.end() ? none : showTimes->second);
+            ++count;
+        }
+        if (page.size() < EXPORT_PAGE_SIZE) {
+            return count;
+        }
+        afterMovieId = page.back().id;
+    }
+}
+
+std::string formatRating(float rating) {
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), rating);
+    return std::string(buffer, result.ptr);
+}
+
+void writeCsvField(std::ostream& out, std::string_view field) {
+    if (field.find_first_of(",\"\r\n") == npos) {
+        out << field;
+        return;
+    }
+    out << '"';
+    for (char c : field) {
+        if (c == '"') {
+            out << '"';
+        }
+        out << c;
+    }
+    out << '"';
+}
+
+void writeJsonString(std::ostream& out, std::string_view text) {
+    static const char HEX[] = "0123456789abcdef";
+    out << '"';
+    for (char c : text) {
+        switch (c) {
+            case '"': out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\r': out << "\\r"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out << "\\u00" << HEX[(c >> 4) & 0xF] << HEX[c & 0xF];
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+}
+
+} // namespace
+
+// ---------------------------------------------------------------- CSV
+
+CsvReader::CsvReader(std::string_view text) : text(text), pos(0), line(1), startLine(1) {
+    // Spreadsheet exports often start with a UTF-8 byte order mark
+    if (text.substr(0, 3) == "\xEF\xBB\xBF") {
+        pos = 3;
+    }
+}
+
+bool CsvReader::next(std::vector<std::string_view>& fields) {
+    fields.clear();
+    while (pos < text.size() && (text[pos] == '\n' || text[pos] == '\r')) {
+        line += text[pos] == '\n';
+        ++pos;
+    }
+    if (pos >= text.size()) {
+        return false;
+    }
+
+    startLine = line;
+    while (true) {
+        if (pos < text.size() && text[pos] == '"') {
+            fields.push_back(readQuoted());
+        } else {
+            std::size_t end = std::min(text.find_first_of(",\r\n", pos), text.size());
+            fields.push_back(text.substr(pos, end - pos));
+            pos = end;
+        }
+
+        if (pos < text.size() && text[pos] == ',') {
+            ++pos;
+            continue;
+        }
+        // End of the record: CRLF, LF or the end of the input
+        if (pos < text.size() && text[pos] == '\r') {
+            ++pos;
+        }
+        if (pos < text.size() && text[pos] == '\n') {
+            ++pos;
+            ++line;
+        }
+        return true;
+    }
+}
+
+std::string_view CsvReader::readQuoted() {
+    const std::size_t openLine = line;
+    const std::size_t begin = ++pos;
+    std::size_t chunk = begin;
+    std::string* decodedField = nullptr;
+
+    while (true) {
+        std::size_t quote = text.find('"', pos);
+        if (quote == npos) {
+            throw CatalogFormatError(openLine, "Unterminated quoted field");
+        }
+        line += static_cast<std::size_t>(std::count(text.begin() + static_cast<std::ptrdiff_t>(pos),
+                                                    text.begin() + static_cast<std::ptrdiff_t>(quote), '\n'));
+
+        if (quote + 1 < text.size() && text[quote + 1] == '"') {
+            // "" stands for one quote: only now does the field need its own copy
+            if (!decodedField) {
+                decodedField = &unescaped.emplace_back();
+            }
+            decodedField->append(text.substr(chunk, quote + 1 - chunk));
+            pos = chunk = quote + 2;
+            continue;
+        }
+
+        pos = quote + 1;
+        if (pos < text.size() && text[pos] != ',' && text[pos] != '\r' && text[pos] != '\n') {
+            throw CatalogFormatError(line, "Unexpected text after a closing quote");
+        }
+        if (!decodedField) {
+            return text.substr(begin, quote - begin);
+        }
+        decodedField->append(text.substr(chunk, quote - chunk));
+        return *decodedField;
+    }
+}
+
+CsvCatalogReader::CsvCatalogReader(std::string_view text) : reader(text) {
+    std::fill(std::begin(columns), std::end(columns), npos);
+    if (!reader.next(fields)) {
+        throw CatalogFormatError(1, "Missing header row");
+    }
+    for (std::size_t i = 0; i < fields.size(); ++i) {
+        for (std::size_t c = 0; c < COLUMN_COUNT; ++c) {
+            if (columns[c] == npos && equalsIgnoreCase(trim(fields[i]), CATALOG_COLUMNS[c])) {
+                columns[c] = i;
+            }
+        }
+    }
+
+    if (columns[TITLE] == npos) {
+        throw CatalogFormatError(reader.recordLine(), "Header has no \"title\" column");
+    }
+    bool anyTime = columns[DATE] != npos || columns[START] != npos || columns[END] != npos;
+    bool allTimes = columns[DATE] != npos && columns[START] != npos && columns[END] != npos;
+    if (anyTime && !allTimes) {
+        throw CatalogFormatError(reader.recordLine(), "Header needs all of \"date\", \"start\" and \"end\"");
+    }
+}
+
+bool CsvCatalogReader::next(CatalogRow& row) {
+    while (reader.next(fields)) {
+        row = CatalogRow();
+        row.line = reader.recordLine();
+        bool empty = true;
+        for (std::size_t c = 0; c < COLUMN_COUNT; ++c) {
+            if (columns[c] < fields.size()) {
+                row.*CATALOG_FIELDS[c] = trim(fields[columns[c]]);
+                empty = empty && (row.*CATALOG_FIELDS[c]).empty();
+            }
+        }
+        // ",,,," lines are what spreadsheets leave below the data
+        if (!empty) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------- JSON
+
+JsonTokenizer::JsonTokenizer(std::string_view text) : text(text), pos(0), line(1) {
+    if (text.substr(0, 3) == "\xEF\xBB\xBF") {
+        pos = 3;
+    }
+}
+
+JsonTokenizer::Token JsonTokenizer::next() {
+    while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n' || text[pos] == '\r')) {
+        line += text[pos] == '\n';
+        ++pos;
+    }
+    current = std::string_view();
+    if (pos >= text.size()) {
+        return Token::END;
+    }
+
+    char c = text[pos];
+    switch (c) {
+        case '{': ++pos; return Token::BEGIN_OBJECT;
+        case '}': ++pos; return Token::END_OBJECT;
+        case '[': ++pos; return Token::BEGIN_ARRAY;
+        case ']': ++pos; return Token::END_ARRAY;
+        case ':': ++pos; return Token::COLON;
+        case ',': ++pos; return Token::COMMA;
+        case '"': current = readString(); return Token::STRING;
+        default: break;
+    }
+
+    if (c == '-' || (c >= '0' && c <= '9')) {
+        std::size_t end = text.find_first_not_of("+-.0123456789eE", pos);
+        current = text.substr(pos, std::min(end, text.size()) - pos);
+        pos += current.size();
+        return Token::NUMBER;
+    }
+    if (c >= 'a' && c <= 'z') {
+        std::size_t end = std::min(text.find_first_not_of("abcdefghijklmnopqrstuvwxyz", pos), text.size());
+        current = text.substr(pos, end - pos);
+        if (current == "true" || current == "false" || current == "null") {
+            pos = end;
+            return Token::LITERAL;
+        }
+    }
+    throw CatalogFormatError(line, std::string("Unexpected character '") + c + "'");
+}
+
+std::string_view JsonTokenizer::readString() {
+    const std::size_t begin = ++pos;
+    std::size_t chunk = begin;
+    std::string* out = nullptr;
+
+    while (true) {
+        std::size_t stop = text.find_first_of("\"\\\n", pos);
+        if (stop == npos) {
+            throw CatalogFormatError(line, "Unterminated string");
+        }
+        if (text[stop] == '\n') {
+            throw CatalogFormatError(line, "Line break inside a string");
+        }
+        if (text[stop] == '"') {
+            pos = stop + 1;
+            if (!out) {
+                return text.substr(begin, stop - begin);
+            }
+            out->append(text.substr(chunk, stop - chunk));
+            return *out;
+        }
+
+        // A backslash: from here on the string is decoded into its own copy
+        if (!out) {
+            out = &decoded.emplace_back();
+        }
+        out->append(text.substr(chunk, stop - chunk));
+        if (stop + 1 >= text.size()) {
+            throw CatalogFormatError(line, "Unterminated string");
+        }
+        pos = stop + 2;
+        switch (text[stop + 1]) {
+            case '"': *out += '"'; break;
+            case '\\': *out += '\\'; break;
+            case '/': *out += '/'; break;
+            case 'b': *out += '\b'; break;
+            case 'f': *out += '\f'; break;
+            case 'n': *out += '\n'; break;
+            case 'r': *out += '\r'; break;
+            case 't': *out += '\t'; break;
+            case 'u': {
+                long unit = hex4(text, pos);
+                pos += 4;
+                unsigned long codePoint = static_cast<unsigned long>(unit);
+                if (unit >= 0xD800 && unit <= 0xDBFF) {
+                    // A character outside the BMP: high surrogate, then \uDC00-\uDFFF
+                    long low = text.substr(pos, 2) == "\\u" ? hex4(text, pos + 2) : -1;
+                    if (low < 0xDC00 || low > 0xDFFF) {
+                        throw CatalogFormatError(line, "Unpaired surrogate in \\u escape");
+                    }
+                    codePoint = 0x10000 + ((static_cast<unsigned long>(unit) - 0xD800) << 10)
+                              + (static_cast<unsigned long>(low) - 0xDC00);
+                    pos += 6;
+                } else if (unit < 0 || (unit >= 0xDC00 && unit <= 0xDFFF)) {
+                    throw CatalogFormatError(line, "Invalid \\u escape");
+                }
+                appendUtf8(*out, codePoint);
+                break;
+            }
+            default:
+                throw CatalogFormatError(line, std::string("Invalid escape \\") + text[stop + 1]);
+        }
+        chunk = pos;
+    }
+}
+
+JsonCatalogReader::JsonCatalogReader(std::string_view text)
+    : tokens(text), moviesRead(0), finished(false), pendingPos(0) {
+    if (tokens.next() != JsonTokenizer::Token::BEGIN_ARRAY) {
+        fail("Expected a JSON array of movies");
+    }
+}
+
+bool JsonCatalogReader::next(CatalogRow& row) {
+    while (pendingPos >= pending.size()) {
+        if (finished || !readMovie()) {
+            return false;
+        }
+    }
+    row = pending[pendingPos++];
+    return true;
+}
+
+bool JsonCatalogReader::readMovie() {
+    using Token = JsonTokenizer::Token;
+    Token token = tokens.next();
+    if (moviesRead > 0 && token == Token::COMMA) {
+        token = tokens.next();
+    } else if (token == Token::END_ARRAY) {
+        finished = true;
+        if (tokens.next() != Token::END) {
+            fail("Unexpected text after the array of movies");
+        }
+        return false;
+    } else if (moviesRead > 0) {
+        fail("Expected ',' or ']' after a movie");
+    }
+    if (token != Token::BEGIN_OBJECT) {
+        fail("Expected a movie object");
+    }
+
+    CatalogRow movie;
+    movie.line = tokens.currentLine();
+    pending.clear();
+    pendingPos = 0;
+
+    token = tokens.next();
+    while (token != Token::END_OBJECT) {
+        if (token != Token::STRING) {
+            fail("Expected a key");
+        }
+        std::string_view key = tokens.value();
+        if (tokens.next() != Token::COLON) {
+            fail("Expected ':' after \"" + std::string(key) + "\"");
+        }
+
+        if (key == "title") movie.title = readScalar(key);
+        else if (key == "genre") movie.genre = readScalar(key);
+        else if (key == "description") movie.description = readScalar(key);
+        else if (key == "rating") movie.rating = readScalar(key);
+        else if (key == "showtimes") readShowTimes(pending);
+        else skipValue(tokens.next());
+
+        token = tokens.next();
+        if (token == Token::COMMA) {
+            token = tokens.next();
+        } else if (token != Token::END_OBJECT) {
+            fail("Expected ',' or '}' in a movie");
+        }
+    }
+
+    if (pending.empty()) {
+        pending.push_back(movie);
+    }
+    for (CatalogRow& row : pending) {
+        row.title = movie.title;
+        row.genre = movie.genre;
+        row.description = movie.description;
+        row.rating = movie.rating;
+    }
+    ++moviesRead;
+    return true;
+}
+
+void JsonCatalogReader::readShowTimes(std::vector<CatalogRow>& showTimes) {
+    using Token = JsonTokenizer::Token;
+    Token token = tokens.next();
+    if (token == Token::LITERAL && tokens.value() == "null") {
+        return;
+    }
+    if (token != Token::BEGIN_ARRAY) {
+        fail("Expected an array of showtimes");
+    }
+
+    token = tokens.next();
+    while (token != Token::END_ARRAY) {
+        if (token != Token::BEGIN_OBJECT) {
+            fail("Expected a showtime object");
+        }
+        CatalogRow& row = showTimes.emplace_back();
+        row.line = tokens.currentLine();
+
+        token = tokens.next();
+        while (token != Token::END_OBJECT) {
+            if (token != Token::STRING) {
+                fail("Expected a key");
+            }
+            std::string_view key = tokens.value();
+            if (tokens.next() != Token::COLON) {
+                fail("Expected ':' after \"" + std::string(key) + "\"");
+            }
+
+            if (key == "date") row.date = readScalar(key);
+            else if (key == "start") row.startTime = readScalar(key);
+            else if (key == "end") row.endTime = readScalar(key);
+            else if (key == "auditorium") row.auditorium = readScalar(key);
+            else skipValue(tokens.next());
+
+            token = tokens.next();
+            if (token == Token::COMMA) {
+                token = tokens.next();
+            } else if (token != Token::END_OBJECT) {
+                fail("Expected ',' or '}' in a showtime");
+            }
+        }
+
+        token = tokens.next();
+        if (token == Token::COMMA) {
+            token = tokens.next();
+        } else if (token != Token::END_ARRAY) {
+            fail("Expected ',' or ']' after a showtime");
+        }
+    }
+}
+
+std::string_view JsonCatalogReader::readScalar(std::string_view key) {
+    using Token = JsonTokenizer::Token;
+    Token token = tokens.next();
+    if (token == Token::STRING || token == Token::NUMBER) {
+        return tokens.value();
+    }
+    if (token == Token::LITERAL && tokens.value() == "null") {
+        return std::string_view();
+    }
+    fail("Expected a string or a number for \"" + std::string(key) + "\"");
+}
+
+void JsonCatalogReader::skipValue(JsonTokenizer::Token token) {
+    using Token = JsonTokenizer::Token;
+    if (token == Token::STRING || token == Token::NUMBER || token == Token::LITERAL) {
+        return;
+    }
+    if (token != Token::BEGIN_OBJECT && token != Token::BEGIN_ARRAY) {
+        fail("Expected a value");
+    }
+    for (int depth = 1; depth > 0;) {
+        token = tokens.next();
+        if (token == Token::BEGIN_OBJECT || token == Token::BEGIN_ARRAY) {
+            ++depth;
+        } else if (token == Token::END_OBJECT || token == Token::END_ARRAY) {
+            --depth;
+        } else if (token == Token::END) {
+            fail("Unexpected end of input");
+        }
+    }
+}
+
+void JsonCatalogReader::fail(const std::string& message) const {
+    throw CatalogFormatError(tokens.currentLine(), message);
+}
+
+// ---------------------------------------------------------------- Import
+
+CatalogImporter::CatalogImporter(IMovieRepository& repo) : repo(repo), rows(0), showTimes(0) {
+}
+
+void CatalogImporter::read(CatalogReader& reader) {
+    CatalogRow row;
+    while (reader.next(row)) {
+        add(row);
+    }
+}
+
+void CatalogImporter::add(const CatalogRow& row) {
+    if (row.title.empty()) {
+        throw CatalogFormatError(row.line, "Missing title");
+    }
+    ++rows;
+
+    auto [entry, added] = byTitle.try_emplace(row.title, movies.size());
+    if (added) {
+        PendingMovie& movie = movies.emplace_back();
+        movie.title = row.title;
+        movie.genre = row.genre;
+        movie.description = row.description;
+        movie.line = row.line;
+        if (!row.rating.empty() && (!parseNumber(row.rating, movie.rating) || !std::isfinite(movie.rating)
+                                    || movie.rating < 0.0f || movie.rating > 10.0f)) {
+            throw CatalogFormatError(row.line, "Rating must be a number from 0 to 10: " + std::string(row.rating));
+        }
+    }
+    PendingMovie& movie = movies[entry->second];
+
+    if (row.date.empty() && row.startTime.empty() && row.endTime.empty()) {
+        return;
+    }
+    std::optional<std::int64_t> startsAt = ShowTime::toEpoch(row.date, row.startTime);
+    // An end before the start is after midnight, the way the export writes late shows
+    std::optional<std::int64_t> endsAt = ShowTime::toEndEpoch(row.date, row.startTime, row.endTime);
+    if (!startsAt || !endsAt) {
+        throw CatalogFormatError(row.line, "Invalid date or time: " + std::string(row.date) + " " +
+                                 std::string(row.startTime) + " - " + std::string(row.endTime));
+    }
+    if (*endsAt <= *startsAt) {
+        throw CatalogFormatError(row.line, "Showtime must end after it starts");
+    }
+    int auditoriumId = 1;
+    if (!row.auditorium.empty() && (!parseNumber(row.auditorium, auditoriumId) || auditoriumId <= 0)) {
+        throw CatalogFormatError(row.line, "Invalid auditorium: " + std::string(row.auditorium));
+    }
+    movie.showTimes.emplace_back(*startsAt, *endsAt, auditoriumId);
+    ++showTimes;
+}
+
+CatalogImportStats CatalogImporter::pending() const {
+    CatalogImportStats stats;
+    stats.rows = rows;
+    stats.moviesAdded = movies.size();
+    stats.showTimes = showTimes;
+    return stats;
+}
+
+CatalogImportStats CatalogImporter::commit() {
+    std::unordered_map<std::string, int> catalog;
+    for (const MovieDTO& movie : repo.getAllMovies()) {
+        catalog.try_emplace(movie.title, movie.id);
+    }
+
+    CatalogImportStats stats;
+    stats.rows = rows;
+    for (const PendingMovie& movie : movies) {
+        try {
+            auto existing = catalog.find(std::string(movie.title));
+            if (existing != catalog.end()) {
+                repo.addShowTimes(existing->second, movie.showTimes);
+                ++stats.moviesMatched;
+            } else {
+                repo.addMovie(std::make_shared<Movie>(std::string(movie.title), std::string(movie.genre),
+                                                      std::string(movie.description), movie.rating),
+                              movie.showTimes);
+                ++stats.moviesAdded;
+            }
+            stats.showTimes += movie.showTimes.size();
+        } catch (const std::exception& e) {
+            throw std::runtime_error("\"" + std::string(movie.title) + "\" (line " + std::to_string(movie.line) + "): " +
+                                     e.what() + " [" + std::to_string(stats.moviesAdded + stats.moviesMatched) +
+                                     " movies imported before it]");
+        }
+    }
+
+    movies.clear();
+    byTitle.clear();
+    rows = 0;
+    showTimes = 0;
+    return stats;
+}
+
+// ---------------------------------------------------------------- Export
+
+// Rows give the start date only; a show ending after midnight is written with an end time
+// before its start time, which CatalogImporter reads back as the next day
+
+std::size_t exportCatalogCsv(IMovieRepository& repo, std::ostream& out) {
+    out << "title,genre,description,rating,date,start,end,auditorium\n";
+    return forEachCatalogMovie(repo, [&out](const MovieDTO& movie, const std::string& description,
+                                            const ScheduleEntries& showTimes) {
+        auto writeMovie = [&]() {
+            writeCsvField(out, movie.title);
+            out << ',';
+            writeCsvField(out, movie.genre);
+            out << ',';
+            writeCsvField(out, description);
+            out << ',' << formatRating(movie.rating) << ',';
+        };
+        if (showTimes.empty()) {
+            writeMovie();
+            out << ",,,\n";
+        }
+        for (const ScheduledShowTime* entry : showTimes) {
+            writeMovie();
+            out << entry->showTime.date() << ',' << entry->showTime.startTime() << ','
+                << entry->showTime.endTime() << ',' << entry->auditoriumID << '\n';
+        }
+    });
+}
+
+std::size_t exportCatalogJson(IMovieRepository& repo, std::ostream& out) {
+    out << '[';
+    std::size_t count = forEachCatalogMovie(repo, [&out, first = true](const MovieDTO& movie, const std::string& description,
+                                                                       const ScheduleEntries& showTimes) mutable {
+        out << (first ? "\n  {\"title\": " : ",\n  {\"title\": ");
+        first = false;
+        writeJsonString(out, movie.title);
+        out << ", \"genre\": ";
+        writeJsonString(out, movie.genre);
+        out << ", \"description\": ";
+        writeJsonString(out, description);
+        out << ", \"rating\": " << formatRating(movie.rating) << ", \"showtimes\": [";
+        for (std::size_t i = 0; i < showTimes.size(); ++i) {
+            const ScheduledShowTime& entry = *showTimes[i];
+            out << (i == 0 ? "\n    " : ",\n    ") << "{\"date\": \"" << entry.showTime.date()
+                << "\", \"start\": \"" << entry.showTime.startTime() << "\", \"end\": \"" << entry.showTime.endTime()
+                << "\", \"auditorium\": " << entry.auditoriumID << '}';
+        }
+        out << (showTimes.empty() ? "]}" : "\n  ]}");
+    });
+    out << "\n]\n";
+    return count;
+}
@@ -0,0 +1,349 @@
+/**
+ * @file CatalogIO.h
+ * @brief Bulk import and export of the movie catalog as CSV or JSON
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ *
+ * Distributor feeds list movies with their showtimes. Both formats carry the
+ * same fields, one showtime per CSV row or per JSON "showtimes" entry:
+ *
+ * | Field       | Format                            | Required                      |
+ * |-------------|-----------------------------------|-------------------------------|
+ * | title       | text                              | yes                           |
+ * | genre       | text                              | first row of a movie          |
+ * | description | text                              | no                            |
+ * | rating      | decimal number                    | no (0)                        |
+ * | date        | YYYY-MM-DD                        | with start and end, or absent |
+ * | start, end  | HH:MM or HH:MM:SS                 | with date                     |
+ * | auditorium  | positive integer                  | no (1)                        |
+ *
+ * CSV (RFC 4180: quoted fields may hold commas, quotes as "" and line breaks;
+ * the header names the columns, in any order):
+ * @code
+ * title,genre,description,rating,date,start,end,auditorium
+ * Avengers,Action,"Earth's heroes, assembled",8.5,2025-05-10,18:00,20:30,1
+ * Avengers,,,,2025-05-11,18:00,20:30,2
+ * Titanic,Romance,A ship,7.9,,,,
+ * @endcode
+ *
+ * JSON:
+ * @code
+ * [
+ *   {"title": "Avengers", "genre": "Action", "description": "Earth's heroes, assembled", "rating": 8.5,
+ *    "showtimes": [{"date": "2025-05-10", "start": "18:00", "end": "20:30", "auditorium": 1}]},
+ *   {"title": "Titanic", "genre": "Romance", "description": "A ship", "rating": 7.9, "showtimes": []}
+ * ]
+ * @endcode
+ *
+ * The date is the day the show starts. An end time earlier than the start
+ * time is on the next day (22:00 to 00:30), so a show lasts less than 24
+ * hours; an end equal to the start is rejected.
+ *
+ * Rows of the same title belong to one movie; the first row that names it
+ * gives its genre, description and rating. A row without a date adds the
+ * movie only.
+ *
+ * Readers tokenize in place: every field is a std::string_view into the
+ * input (typically a MappedFile). Only fields containing escapes ("" in CSV,
+ * backslashes in JSON) are decoded into storage owned by the reader.
+ */
+
+#ifndef _CATALOGIO_H_
+#define _CATALOGIO_H_
+#include "../repository/IMovieRepository.h"
+#include "../repository/ShowTimeSpec.h"
+#include <cstddef>
+#include <deque>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class CatalogFormatError
+ * @brief Malformed feed: what is wrong and on which line of the input
+ */
+class CatalogFormatError : public std::runtime_error {
+private:
+    std::size_t _line;
+
+public:
+    CatalogFormatError(std::size_t line, const std::string& message)
+        : std::runtime_error("line " + std::to_string(line) + ": " + message), _line(line) {}
+
+    /**
+     * @brief 1-based line of the input the error was found on
+     */
+    std::size_t line() const { return _line; }
+};
+
+/**
+ * @struct CatalogRow
+ * @brief One showtime of a feed (or one movie without showtimes), as text
+ *
+ * Fields are empty when the feed leaves them out. They point into the
+ * input or into the reader and stay valid as long as both live.
+ */
+struct CatalogRow {
+    std::string_view title;
+    std::string_view genre;
+    std::string_view description;
+    std::string_view rating;
+    std::string_view date;
+    std::string_view startTime;
+    std::string_view endTime;
+    std::string_view auditorium;
+    std::size_t line = 0;  ///< 1-based line the row starts on, for error messages
+};
+
+/**
+ * @class CatalogReader
+ * @brief Pulls the rows of a feed one at a time
+ */
+class CatalogReader {
+public:
+    virtual ~CatalogReader() = default;
+
+    /**
+     * @brief Read the next row into @p row
+     *
+     * @return false at the end of the input
+     * @throws CatalogFormatError If the input is malformed
+     */
+    virtual bool next(CatalogRow& row) = 0;
+};
+
+/**
+ * @class CsvReader
+ * @brief RFC 4180 record splitter over a string_view
+ *
+ * Accepts LF and CRLF line ends, skips a UTF-8 byte order mark and blank
+ * lines. A quoted field that contains "" is the only one copied (into
+ * storage owned by the reader); every other field is a view of the input.
+ */
+class CsvReader {
+public:
+    explicit CsvReader(std::string_view text);
+
+    /**
+     * @brief Split the next record into @p fields
+     *
+     * @return false at the end of the input
+     * @throws CatalogFormatError On an unterminated quote or text after a closing quote
+     */
+    bool next(std::vector<std::string_view>& fields);
+
+    /**
+     * @brief Line the last record returned by next() started on
+     */
+    std::size_t recordLine() const { return startLine; }
+
+private:
+    std::string_view readQuoted();
+
+    std::string_view text;
+    std::size_t pos;
+    std::size_t line;
+    std::size_t startLine;
+    std::deque<std::string> unescaped; ///< Decoded quoted fields; a deque never moves them
+};
+
+/**
+ * @class CsvCatalogReader
+ * @brief CatalogReader for CSV feeds with a header row
+ *
+ * Column names are matched without regard to case; unknown columns are
+ * ignored. "title" is required, and so are "date", "start" and "end" if
+ * any of them is present.
+ */
+class CsvCatalogReader : public CatalogReader {
+public:
+    /**
+     * @throws CatalogFormatError If the header is missing or lacks required columns
+     */
+    explicit CsvCatalogReader(std::string_view text);
+
+    bool next(CatalogRow& row) override;
+
+private:
+    CsvReader reader;
+    std::vector<std::string_view> fields;
+    /// Column index of each CatalogRow field, in declaration order; npos if absent
+    std::size_t columns[8];
+};
+
+/**
+ * @class JsonTokenizer
+ * @brief Minimal pull tokenizer for JSON text
+ *
+ * Strings without escapes are views of the input; strings with escapes
+ * (including \\uXXXX and surrogate pairs) are decoded to UTF-8 into storage
+ * owned by the tokenizer. Numbers are returned as their text.
+ */
+class JsonTokenizer {
+public:
+    enum class Token {
+        BEGIN_OBJECT, END_OBJECT, BEGIN_ARRAY, END_ARRAY, COLON, COMMA,
+        STRING, NUMBER, LITERAL, END
+    };
+
+    explicit JsonTokenizer(std::string_view text);
+
+    /**
+     * @brief Advance to the next token
+     *
+     * @throws CatalogFormatError On text that is not a JSON token
+     */
+    Token next();
+
+    /**
+     * @brief Text of the current STRING, NUMBER or LITERAL (true/false/null)
+     */
+    std::string_view value() const { return current; }
+
+    std::size_t currentLine() const { return line; }
+
+private:
+    std::string_view readString();
+
+    std::string_view text;
+    std::size_t pos;
+    std::size_t line;
+    std::string_view current;
+    std::deque<std::string> decoded;
+};
+
+/**
+ * @class JsonCatalogReader
+ * @brief CatalogReader for a JSON array of movie objects
+ *
+ * Reads one movie object at a time, then hands out a row per entry of its
+ * "showtimes" array (one row without a date if it has none). Unknown keys
+ * are skipped whatever their value. Memory use is bounded by the largest
+ * movie, not by the feed.
+ */
+class JsonCatalogReader : public CatalogReader {
+public:
+    /**
+     * @throws CatalogFormatError If the input does not start with '['
+     */
+    explicit JsonCatalogReader(std::string_view text);
+
+    bool next(CatalogRow& row) override;
+
+private:
+    bool readMovie();
+    void readShowTimes(std::vector<CatalogRow>& showTimes);
+    std::string_view readScalar(std::string_view key);
+    void skipValue(JsonTokenizer::Token token);
+    [[noreturn]] void fail(const std::string& message) const;
+
+    JsonTokenizer tokens;
+    std::size_t moviesRead;
+    bool finished;
+    std::vector<CatalogRow> pending;   ///< Rows of the movie read last
+    std::size_t pendingPos;
+};
+
+/**
+ * @struct CatalogImportStats
+ * @brief What an import wrote
+ */
+struct CatalogImportStats {
+    std::size_t rows = 0;           ///< Rows read from the feed
+    std::size_t moviesAdded = 0;    ///< Titles that were not in the catalog
+    std::size_t moviesMatched = 0;  ///< Titles already in the catalog; only showtimes were added
+    std::size_t showTimes = 0;      ///< Showtimes added
+};
+
+/**
+ * @class CatalogImporter
+ * @brief Validates a whole feed, then loads it movie by movie through IMovieRepository
+ *
+ * add() parses and checks every row (dates, times, rating, auditorium) and
+ * groups showtimes by title, so a malformed feed is rejected before anything
+ * is written. commit() then writes each movie with all its showtimes in one
+ * transaction: IMovieRepository::addMovie(movie, schedule) for new titles,
+ * IMovieRepository::addShowTimes for titles already in the catalog.
+ *
+ * @par Usage Example
+ * @code
+ * MappedFile feed("distributor.csv");
+ * CsvCatalogReader reader(feed.text());
+ * CatalogImporter importer(*movieRepo);
+ * importer.read(reader);                      // nothing written yet
+ * CatalogImportStats stats = importer.commit();
+ * @endcode
+ *
+ * @note Each movie is atomic, the feed as a whole is not: if a showtime
+ *       overlaps the schedule, the movies before it stay imported
+ * @warning Views into the feed are kept until commit(): the reader and its
+ *          input must outlive the importer
+ */
+class CatalogImporter {
+public:
+    explicit CatalogImporter(IMovieRepository& repo);
+
+    /**
+     * @brief Read and validate every row of @p reader
+     *
+     * @throws CatalogFormatError On the first malformed row
+     */
+    void read(CatalogReader& reader);
+
+    /**
+     * @brief Validate one row and queue it under its title
+     *
+     * @throws CatalogFormatError If a field is invalid
+     */
+    void add(const CatalogRow& row);
+
+    /**
+     * @brief Write the queued movies and showtimes
+     *
+     * @throws std::runtime_error Naming the movie and line that failed
+     *         (for instance a ShowTimeOverlapException), after the movies
+     *         before it were written
+     */
+    CatalogImportStats commit();
+
+    /**
+     * @brief Rows, movies and showtimes queued so far (nothing written)
+     */
+    CatalogImportStats pending() const;
+
+private:
+    struct PendingMovie {
+        std::string_view title;
+        std::string_view genre;
+        std::string_view description;
+        float rating = 0.0f;
+        std::size_t line = 0;
+        std::vector<ShowTimeSpec> showTimes;
+    };
+
+    IMovieRepository& repo;
+    std::vector<PendingMovie> movies;                          ///< In order of first appearance
+    std::unordered_map<std::string_view, std::size_t> byTitle; ///< Index into movies
+    std::size_t rows;
+    std::size_t showTimes;
+};
+
+/**
+ * @brief Write the whole catalog as CSV, in the format CsvCatalogReader reads
+ *
+ * @return Number of movies written
+ */
+std::size_t exportCatalogCsv(IMovieRepository& repo, std::ostream& out);
+
+/**
+ * @brief Write the whole catalog as JSON, in the format JsonCatalogReader reads
+ *
+ * @return Number of movies written
+ */
+std::size_t exportCatalogJson(IMovieRepository& repo, std::ostream& out);
+
+#endif
@@ -0,0 +1,61 @@
+/**
+ * @file MappedFile.h
+ * @brief Read-only memory-mapped view of a whole file
+ * @author Movie Ticket Booking System Team
+ * @date 2025
+ * @version 1.0.0
+ */
+
+#ifndef _MAPPEDFILE_H_
+#define _MAPPEDFILE_H_
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * @class MappedFile
+ * @brief Maps a file into memory and exposes it as one std::string_view
+ *
+ * Parsers of large feeds (see CatalogIO.h) tokenize straight out of the
+ * mapping: nothing is read into a buffer or copied line by line, and the
+ * operating system pages the file in as the parser advances. Uses mmap on
+ * POSIX systems and CreateFileMapping/MapViewOfFile on Windows.
+ *
+ * @par Usage Example
+ * @code
+ * MappedFile feed("showtimes.csv");
+ * CsvReader reader(feed.text());
+ * @endcode
+ *
+ * @note Views into text() are valid for the lifetime of the MappedFile
+ * @warning The file must not be truncated while it is mapped
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Map @p filePath read-only
+     *
+     * @throws std::runtime_error If the file cannot be opened or mapped
+     */
+    explicit MappedFile(const std::string& filePath);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile();
+
+    /**
+     * @brief The whole file; empty for an empty file
+     */
+    std::string_view text() const { return std::string_view(data, size); }
+
+private:
+    const char* data;
+    std::size_t size;
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+};
+
+#endif
@@ -7,7 +7,7 @@ BookingServiceVisitor::BookingServiceVisitor() {
     _service = nullptr;
 }
 
-std::shared_ptr<IBookingService> BookingServiceVisitor::getBookingService() {
+IBookingService* BookingServiceVisitor::getBookingService() {
     return _service;
 }
 
@@ -16,10 +16,10 @@ void BookingServiceVisitor::service(std::shared_ptr<Guest> role) {
 }
 
 void BookingServiceVisitor::service(std::shared_ptr<User> role) {
-    _service = ServiceRegistry::getSingleton<IBookingService>();
+    _service = ServiceRegistry::get<IBookingService>();
 }
 
 void BookingServiceVisitor::service(std::shared_ptr<Admin> role) {
-    _service = ServiceRegistry::getSingleton<IBookingService>();
+    _service = ServiceRegistry::get<IBookingService>();
 }
 
@@ -75,11 +75,11 @@ private:
     /**
      * @brief Booking service instance managed by this visitor
      * 
-     * Shared pointer to the booking service obtained from ServiceRegistry.
+     * Booking service obtained from ServiceRegistry, which owns it.
      * This service is made available to authorized roles through the
      * visitor pattern implementation.
      */
-    std::shared_ptr<IBookingService> _service;
+    IBookingService* _service;
     
 public:
     /**
@@ -107,7 +107,7 @@ public:
      * been authorized through a previous visit operation. This method
      * provides access to booking functionality for qualified users.
      * 
-     * @return Shared pointer to booking service if authorized, nullptr otherwise
+     * @return Booking service (owned by ServiceRegistry) if authorized, nullptr otherwise
      * 
      * @post Returns valid service pointer for authorized roles
      * @post Returns nullptr for unauthorized access attempts
@@ -131,7 +131,7 @@ public:
      * }
      * @endcode
      */
-    std::shared_ptr<IBookingService> getBookingService();
+    IBookingService* getBookingService();
     
     /**
      * @brief Processes booking service access for Guest role
@@ -8,7 +8,7 @@ LoginServiceVisitor::LoginServiceVisitor() {
 }
 
 void LoginServiceVisitor::service(std::shared_ptr<Guest> role) {
-    _service = ServiceRegistry::getSingleton<ILoginService>();
+    _service = ServiceRegistry::get<ILoginService>();
 }
 
 void LoginServiceVisitor::service(std::shared_ptr<User> role) {
@@ -19,6 +19,6 @@ void LoginServiceVisitor::service(std::shared_ptr<Admin> role) {
     _service = nullptr;
 }
 
-std::shared_ptr<ILoginService> LoginServiceVisitor::getLoginService() {
+ILoginService* LoginServiceVisitor::getLoginService() {
     return _service;
 }
\ No newline at end of file
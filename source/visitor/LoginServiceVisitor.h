@@ -57,7 +57,7 @@ private:
      * Maintains a reference to the login service obtained from ServiceRegistry.
      * This caching improves performance by avoiding repeated service lookups.
      */
-    std::shared_ptr<ILoginService> _service;
+    ILoginService* _service;
 
 public:
     /**
@@ -77,14 +77,14 @@ public:
      * Provides access to the login service for role-specific authentication operations.
      * This method ensures that all roles interact with the same service instance.
      * 
-     * @return std::shared_ptr<ILoginService> The login service instance
+     * @return ILoginService* The login service instance
      * 
      * @pre LoginServiceVisitor must be properly constructed
      * @post Returns valid login service reference
      * 
      * @see ILoginService
      */
-    std::shared_ptr<ILoginService> getLoginService();
+    ILoginService* getLoginService();
 
     /**
      * @brief Provides login service access for Guest users
@@ -12,14 +12,14 @@ void LogoutServiceVisitor::service(std::shared_ptr<Guest> role) {
 }
 
 void LogoutServiceVisitor::service(std::shared_ptr<User> role) {
-    _service = ServiceRegistry::getSingleton<ILogoutService>();
+    _service = ServiceRegistry::get<ILogoutService>();
 }
 
 void LogoutServiceVisitor::service(std::shared_ptr<Admin> role) {
-    _service = ServiceRegistry::getSingleton<ILogoutService>();
+    _service = ServiceRegistry::get<ILogoutService>();
 }
 
-std::shared_ptr<ILogoutService> LogoutServiceVisitor::getLogoutService() {
+ILogoutService* LogoutServiceVisitor::getLogoutService() {
     return _service;
 }
 
@@ -61,7 +61,7 @@ private:
      * Maintains a reference to the logout service obtained from ServiceRegistry.
      * This caching improves performance by avoiding repeated service lookups.
      */
-    std::shared_ptr<ILogoutService> _service;
+    ILogoutService* _service;
 
 public:
     /**
@@ -81,14 +81,14 @@ public:
      * Provides access to the logout service for role-specific session termination operations.
      * This method ensures that all authenticated roles interact with the same service instance.
      * 
-     * @return std::shared_ptr<ILogoutService> The logout service instance
+     * @return ILogoutService* The logout service instance
      * 
      * @pre LogoutServiceVisitor must be properly constructed
      * @post Returns valid logout service reference
      * 
      * @see ILogoutService
      */
-    std::shared_ptr<ILogoutService> getLogoutService();
+    ILogoutService* getLogoutService();
 
     /**
      * @brief Denies logout service access for Guest users
@@ -7,7 +7,7 @@ MovieManagerServiceVisitor::MovieManagerServiceVisitor() {
     _service = nullptr;
 }
 
-std::shared_ptr<IMovieManagerService> MovieManagerServiceVisitor::getMovieManagerService() {
+IMovieManagerService* MovieManagerServiceVisitor::getMovieManagerService() {
     return _service;
 }
 
@@ -20,5 +20,5 @@ void MovieManagerServiceVisitor::service(std::shared_ptr<User> role) {
 }
 
 void MovieManagerServiceVisitor::service(std::shared_ptr<Admin> role) {
-    _service = ServiceRegistry::getSingleton<IMovieManagerService>();
+    _service = ServiceRegistry::get<IMovieManagerService>();
 }
\ No newline at end of file
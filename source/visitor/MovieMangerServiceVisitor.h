@@ -66,7 +66,7 @@ private:
      * Maintains a reference to the movie management service obtained from ServiceRegistry.
      * This caching improves performance by avoiding repeated service lookups.
      */
-    std::shared_ptr<IMovieManagerService> _service;
+    IMovieManagerService* _service;
 
 public:
     /**
@@ -86,14 +86,14 @@ public:
      * Provides access to the movie management service for administrative operations.
      * This method ensures that only authorized roles interact with the service instance.
      * 
-     * @return std::shared_ptr<IMovieManagerService> The movie management service instance
+     * @return IMovieManagerService* The movie management service instance
      * 
      * @pre MovieManagerServiceVisitor must be properly constructed
      * @post Returns valid movie management service reference
      * 
      * @see IMovieManagerService
      */
-    std::shared_ptr<IMovieManagerService> getMovieManagerService();
+    IMovieManagerService* getMovieManagerService();
 
     /**
      * @brief Denies movie management service access for Guest users
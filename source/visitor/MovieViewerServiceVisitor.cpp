@@ -8,17 +8,17 @@ MovieViewerServiceVisitor::MovieViewerServiceVisitor() {
 }
 
 void MovieViewerServiceVisitor::service(std::shared_ptr<Guest> role) {
-    _service = ServiceRegistry::getSingleton<IMovieViewerService>();
+    _service = ServiceRegistry::get<IMovieViewerService>();
 }
 
 void MovieViewerServiceVisitor::service(std::shared_ptr<User> role) {
-    _service = ServiceRegistry::getSingleton<IMovieViewerService>();
+    _service = ServiceRegistry::get<IMovieViewerService>();
 }
 
 void MovieViewerServiceVisitor::service(std::shared_ptr<Admin> role) {
-    _service = ServiceRegistry::getSingleton<IMovieViewerService>();
+    _service = ServiceRegistry::get<IMovieViewerService>();
 }
 
-std::shared_ptr<IMovieViewerService> MovieViewerServiceVisitor::getMovieViewerService() {
+IMovieViewerService* MovieViewerServiceVisitor::getMovieViewerService() {
     return _service;
 }
\ No newline at end of file
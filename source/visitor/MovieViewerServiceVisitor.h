@@ -69,7 +69,7 @@ private:
      * Maintains a reference to the movie viewing service obtained from ServiceRegistry.
      * This caching improves performance for the high-frequency movie browsing operations.
      */
-    std::shared_ptr<IMovieViewerService> _service;
+    IMovieViewerService* _service;
 
 public:
     /**
@@ -89,14 +89,14 @@ public:
      * Provides access to the movie viewing service for role-appropriate browsing operations.
      * This method ensures consistent service access across all user roles.
      * 
-     * @return std::shared_ptr<IMovieViewerService> The movie viewing service instance
+     * @return IMovieViewerService* The movie viewing service instance
      * 
      * @pre MovieViewerServiceVisitor must be properly constructed
      * @post Returns valid movie viewing service reference
      * 
      * @see IMovieViewerService
      */
-    std::shared_ptr<IMovieViewerService> getMovieViewerService();
+    IMovieViewerService* getMovieViewerService();
 
     /**
      * @brief Provides movie viewing service access for Guest users
@@ -7,12 +7,12 @@ RegisterServiceVisitor::RegisterServiceVisitor() {
     _service = nullptr;
 }
 
-std::shared_ptr<IRegisterService> RegisterServiceVisitor::getRegisterService() {
+IRegisterService* RegisterServiceVisitor::getRegisterService() {
     return _service;
 }
 
 void RegisterServiceVisitor::service(std::shared_ptr<Guest> role) {
-    _service = ServiceRegistry::getSingleton<IRegisterService>();
+    _service = ServiceRegistry::get<IRegisterService>();
 }
 
 void RegisterServiceVisitor::service(std::shared_ptr<User> role) {
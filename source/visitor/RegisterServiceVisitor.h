@@ -71,7 +71,7 @@ private:
      * This caching improves performance by avoiding repeated service lookups during
      * registration workflows.
      */
-    std::shared_ptr<IRegisterService> _service;
+    IRegisterService* _service;
 
 public:
     /**
@@ -91,14 +91,14 @@ public:
      * Provides access to the registration service for account creation operations.
      * This method ensures that authorized roles interact with the same service instance.
      * 
-     * @return std::shared_ptr<IRegisterService> The registration service instance
+     * @return IRegisterService* The registration service instance
      * 
      * @pre RegisterServiceVisitor must be properly constructed
      * @post Returns valid registration service reference
      * 
      * @see IRegisterService
      */
-    std::shared_ptr<IRegisterService> getRegisterService();
+    IRegisterService* getRegisterService();
 
     /**
      * @brief Provides registration service access for Guest users